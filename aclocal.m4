@@ -1176,6 +1176,7 @@ m4_include([m4/ax_prog_cc_mpi.m4])
 m4_include([m4/ax_prog_cxx_mpi.m4])
 m4_include([m4/boost.m4])
 m4_include([m4/check_builtins.m4])
+m4_include([m4/check_pthread_flags.m4])
 m4_include([m4/configure_boost.m4])
 m4_include([m4/configure_eigen.m4])
 m4_include([m4/configure_gsl.m4])
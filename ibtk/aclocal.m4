@@ -1177,6 +1177,8 @@ m4_include([m4/ax_prog_cxx_mpi.m4])
 m4_include([m4/boost.m4])
 m4_include([m4/check_builtins.m4])
 m4_include([m4/check_pragma.m4])
+m4_include([m4/check_pthread_flags.m4])
+m4_include([m4/check_simd_flags.m4])
 m4_include([m4/configure_boost.m4])
 m4_include([m4/configure_doxygen.m4])
 m4_include([m4/configure_eigen.m4])
@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/RegionOfInterestDataWriter.h"
 
 #include "VisItDataWriter.h"
 #include "tbox/Database.h"
@@ -134,6 +135,16 @@ public:
      */
     SAMRAI::tbox::Pointer<LSiloDataWriter> getLSiloDataWriter() const;
 
+    /*!
+     * Return a data writer object to be used to output reduced Cartesian grid
+     * data in regions of interest. The writer is configured by the input
+     * database RegionOfInterestDataWriter, if it exists.
+     *
+     * If the application is not configured to use this writer (via the "ROI"
+     * visualization writer), a NULL pointer will be returned.
+     */
+    SAMRAI::tbox::Pointer<RegionOfInterestDataWriter> getRegionOfInterestDataWriter() const;
+
     /*!
      * Return the ExodusII visualization file name.
      *
@@ -235,6 +246,7 @@ private:
     std::vector<std::string> d_viz_writers;
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_data_writer;
     SAMRAI::tbox::Pointer<LSiloDataWriter> d_silo_data_writer;
+    SAMRAI::tbox::Pointer<RegionOfInterestDataWriter> d_roi_data_writer;
     std::string d_exodus_filename = "output.ex2", d_gmv_filename = "output.gmv";
 
     /*!
@@ -112,8 +112,25 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_hypre_data = FALSE       // keep the hypre grid, matrices, and vectors between
+ initializations
+ solver_setup_reuse_interval = 0 // number of initializations for which the solver setup is reused
+ (only used when reuse_hypre_data is TRUE)
  \endverbatim
  *
+ * When \p reuse_hypre_data is \p TRUE, deallocateSolverState() does not
+ * deallocate the hypre data structures.  If the next call to
+ * initializeSolverState() uses the same patch level configuration, only the
+ * values of the existing hypre matrix are reset, e.g., to account for a change
+ * in the PoissonSpecifications.  Otherwise, the data structures are rebuilt.
+ * Setting up the hypre solver (e.g., computing the PFMG or SMG coarse-grid
+ * operators) can additionally be skipped for up to \p
+ * solver_setup_reuse_interval consecutive reinitializations.  In this case, the
+ * solver or preconditioner uses a setup that was computed from earlier matrix
+ * coefficients, which is generally appropriate only when the coefficients
+ * change slowly, e.g., with variable time step sizes, and which is most robust
+ * when hypre is used as a preconditioner for a Krylov method.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -225,6 +242,9 @@ public:
      * already initialized.  In this case, the solver state is first deallocated
      * and then reinitialized.
      *
+     * \note When hypre data reuse is enabled, the hypre data structures are only
+     * rebuilt when the patch level configuration has changed.
+     *
      * \see deallocateSolverState
      */
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
@@ -276,6 +296,7 @@ private:
      * data structures.
      */
     void allocateHypreData();
+    bool hypreGridMatchesLevel() const;
     void setMatrixCoefficients_aligned();
     void setMatrixCoefficients_nonaligned();
     void setupHypreSolver();
@@ -327,6 +348,16 @@ private:
     int d_skip_relax = 1;
     int d_two_norm = 1;
     //\}
+
+    /*!
+     * \name Data for reusing hypre data structures between initializations.
+     */
+    //\{
+    bool d_reuse_hypre_data = false;
+    int d_solver_setup_reuse_interval = 0;
+    int d_num_solver_setup_reuses = 0;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_hypre_patch_boxes;
+    //\}
 };
 } // namespace IBTK
 
@@ -23,9 +23,12 @@
 #include "ibtk/PoissonFACPreconditioner.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/SinglePrecisionGhostFill.h"
 
 #include "IntVector.h"
 #include "PoissonSpecifications.h"
+#include "RefineAlgorithm.h"
+#include "RefineSchedule.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -95,6 +98,12 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ ghost_cell_width = 1                         // width k of the ghost cell region
+ communication_avoiding_smoothing = FALSE     // see setUseCommunicationAvoidingSmoothing()
+ use_single_precision_ghost_fill = FALSE      // see setUseSinglePrecisionGhostFill()
+ chebyshev_eigenvalue_estimate_iterations = 10  // power iterations used by the "CHEBYSHEV" smoother
+ chebyshev_lower_eigenvalue_factor = 0.1      // see setSmootherType()
+ chebyshev_upper_eigenvalue_factor = 1.1      // see setSmootherType()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -143,6 +152,17 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
+     *
+     * The \c "CHEBYSHEV" smoother performs Chebyshev-accelerated Jacobi
+     * iterations, which require one ghost cell fill per sweep and update all
+     * degrees of freedom independently.  The largest eigenvalue
+     * \f$ \lambda \f$ of the Jacobi-preconditioned operator is estimated on
+     * each level by power iteration the first time that the level is smoothed
+     * after the operator state is initialized, and the Chebyshev polynomial
+     * targets the interval \f$ [a \lambda, b \lambda] \f$, in which \em a and
+     * \em b are set by the input keys \c chebyshev_lower_eigenvalue_factor
+     * and \c chebyshev_upper_eigenvalue_factor.
      */
     void setSmootherType(const std::string& smoother_type) override;
 
@@ -151,6 +171,31 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type) override;
 
+    /*!
+     * \brief Specify whether to perform communication-avoiding smoothing.
+     *
+     * When enabled, red-black Gauss-Seidel smoothing on levels that do not
+     * have coarse-fine interfaces fills a ghost cell region of width \em k, set
+     * by the input key \c ghost_cell_width, once and then performs up to \em k
+     * half-sweeps before filling ghost cells again.  Each half-sweep also
+     * updates the part of the ghost cell region in which the updated values are
+     * still exact, so that the results are identical to those obtained by
+     * filling ghost cells before every half-sweep (unless the ghost cell values
+     * are rounded by single-precision ghost cell fills, see
+     * setUseSinglePrecisionGhostFill()).  This reduces the number of
+     * ghost cell exchanges per smoothing step by a factor of \em k at the cost
+     * of redundant computation near the patch boundaries.
+     *
+     * Other smoothers, levels with coarse-fine interfaces, levels with an odd
+     * number of cells in a periodic direction, and variable diffusion
+     * coefficients always fill ghost cells before every sweep.
+     *
+     * \note The option requires \c ghost_cell_width to be at least 2.  With
+     * narrower ghost cell regions, a warning is emitted and the option has no
+     * effect.
+     */
+    void setUseCommunicationAvoidingSmoothing(bool use_communication_avoiding_smoothing);
+
     //\}
 
     /*!
@@ -250,6 +295,46 @@ private:
      */
     CCPoissonPointRelaxationFACOperator& operator=(const CCPoissonPointRelaxationFACOperator& that) = delete;
 
+    /*!
+     * \brief Perform a given number of Chebyshev-accelerated Jacobi iterations
+     * on the error.
+     */
+    void smoothErrorChebyshev(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                              const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                              int level_num,
+                              int num_sweeps);
+
+    /*!
+     * \brief Estimate the largest eigenvalue of the Jacobi-preconditioned
+     * operator on the specified level by power iteration.
+     *
+     * \note This function uses the scratch data as temporary storage.
+     */
+    void estimateMaxEigenvalue(int level_num);
+
+    /*!
+     * \brief Compute the Jacobi correction \f$ z = D^{-1} (f - A u) \f$ on the
+     * interior of the specified patch, in which \f$ D \f$ is the diagonal part
+     * of \f$ A \f$.  The ghost cell values of \f$ u \f$ must be filled.
+     */
+    void computeJacobiCorrection(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > z_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > u_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > f_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
+    /*!
+     * \brief Fill the full ghost cell region of the specified patch data on the
+     * specified level, including physical boundary ghost cells but not
+     * coarse-fine interface ghost cells.
+     */
+    void xeqScheduleWideGhostFill(int dst_idx, int dst_ln);
+
+    /*!
+     * \brief Set physical boundary ghost cell values on the specified level
+     * without filling the ghost cells that are shared with other patches.
+     */
+    void setPhysicalBoundaryConditions(int dst_idx, int dst_ln);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -261,6 +346,34 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Communication-avoiding smoothing data: whether the option is enabled, the
+     * levels on which it may be used, the communication schedules used to
+     * fill the full ghost cell region of the solution data, and, for each
+     * level, the patch data index of the residual whose ghost cells were
+     * filled during the most recent presmoothing step.  The residual is not
+     * modified between the pre- and postsmoothing steps on a level, so its
+     * ghost cells need not be filled again.  The full ghost cell region is
+     * filled with a separate operator when single-precision ghost cell fills
+     * are enabled.
+     */
+    bool d_use_communication_avoiding_smoothing = false;
+    std::vector<bool> d_level_supports_wide_ghost_fill;
+    std::vector<int> d_wide_ghost_filled_residual_idx;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_wide_ghostfill_refine_algorithm;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_wide_ghostfill_refine_schedules;
+    SAMRAI::tbox::Pointer<SinglePrecisionGhostFill> d_single_precision_wide_ghost_fill_op;
+
+    /*
+     * Chebyshev smoother parameters and the estimated largest eigenvalue of the
+     * Jacobi-preconditioned operator on each level.  Nonpositive values
+     * indicate that the eigenvalue has not yet been estimated.
+     */
+    int d_chebyshev_eigenvalue_estimate_iterations = 10;
+    double d_chebyshev_lower_eigenvalue_factor = 0.1;
+    double d_chebyshev_upper_eigenvalue_factor = 1.1;
+    std::vector<double> d_chebyshev_max_eigenvalue_estimates;
 };
 } // namespace IBTK
 
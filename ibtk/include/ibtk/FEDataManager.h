@@ -55,12 +55,14 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace IBTK
 {
+class FECache;
 class FEDataManager;
 class FEProjector;
 class RobinPhysBdryPatchStrategy;
@@ -77,6 +79,8 @@ namespace hier
 {
 template <int DIM>
 class BasePatchHierarchy;
+template <int DIM>
+class Patch;
 } // namespace hier
 namespace tbox
 {
@@ -537,6 +541,28 @@ public:
      */
     bool getLoggingEnabled() const;
 
+    /*!
+     * \brief Enable or disable caching of element quadrature data.
+     *
+     * When enabled, the quadrature rule keys, the physical positions of the
+     * quadrature points, and the JxW values of the active elements that are
+     * computed by spread() and interpWeighted() are stored and reused by
+     * subsequent calls as long as the nodal positions of the active elements
+     * and the quadrature parameters do not change.  This avoids repeating the
+     * same geometric computations when, e.g., velocities are interpolated
+     * and forces are spread at the same structure configuration within a time
+     * step.  The cache is reset by reinitElementMappings().
+     *
+     * @note This is usually set by the IBFEMethod which owns the current
+     * FEDataManager, which reads the relevant boolean from the database.
+     */
+    void setQuadratureDataCachingEnabled(bool enable_caching = true);
+
+    /*!
+     * \brief Determine whether caching of element quadrature data is enabled.
+     */
+    bool getQuadratureDataCachingEnabled() const;
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      *
@@ -842,6 +868,34 @@ public:
                    bool close_F = true,
                    bool close_X = true);
 
+    /*!
+     * \brief Combine interpWeighted() and spread() into a single pass over the
+     * patches of the level: the Eulerian field @p u_data_idx is interpolated to
+     * the quadrature points of each patch and accumulated into the L2
+     * projection right-hand side @p U_rhs, and then @p F is spread from the
+     * same quadrature points to @p f_data_idx.
+     *
+     * Since the quadrature points are shared, this is only possible when
+     * neither spec uses nodal quadrature and both specs use the same
+     * quadrature type, order, adaptivity, and point density. Otherwise this
+     * function simply calls interpWeighted() and then spread().
+     *
+     * @note As with interpWeighted() called with <code>close_F = false</code>,
+     * @p U_rhs is not closed and its ghost values are not communicated: that
+     * is the responsibility of the caller. Similarly, ghost data of @p
+     * u_data_idx must be filled before calling this function and @p
+     * u_data_idx and @p f_data_idx must be different.
+     */
+    void interpWeightedAndSpread(int u_data_idx,
+                                 libMesh::NumericVector<double>& U_rhs,
+                                 const std::string& interp_system_name,
+                                 const InterpSpec& interp_spec,
+                                 int f_data_idx,
+                                 libMesh::NumericVector<double>& F,
+                                 const std::string& spread_system_name,
+                                 const SpreadSpec& spread_spec,
+                                 libMesh::NumericVector<double>& X);
+
     /*!
      * \brief Interpolate a value from the Cartesian grid to the FE mesh using
      * the default interpolation spec.
@@ -1133,6 +1187,81 @@ private:
      */
     void reinitializeIBGhostedDOFs(const std::string& system_name);
 
+    /*!
+     * Quadrature data of the active elements of a local patch: the quadrature
+     * key and JxW values of each element and the physical positions of all
+     * quadrature points on the patch, stored contiguously with NDIM values per
+     * point.  The nodal positions from which the data were computed are kept
+     * to determine whether the data may be reused.
+     */
+    struct PatchQuadratureData
+    {
+        std::vector<std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order> > quad_keys;
+        std::vector<std::vector<double> > JxW;
+        std::vector<double> X_qp;
+        std::vector<double> X_node;
+    };
+
+    /*!
+     * Get the quadrature data of the active elements of each local patch for
+     * the specified structure configuration and quadrature parameters.  If
+     * caching of quadrature data is enabled, previously computed data are
+     * returned when they remain valid.
+     *
+     * @note @p X_local_soln must be the array of @p X_vec, which is accessed
+     * by the caller.
+     */
+    const std::vector<PatchQuadratureData>& getPatchQuadratureData(libMesh::PetscVector<double>& X_vec,
+                                                                   const double* X_local_soln,
+                                                                   libMesh::QuadratureType quad_type,
+                                                                   libMesh::Order quad_order,
+                                                                   bool use_adaptive_quadrature,
+                                                                   double point_density);
+
+    /*!
+     * Interpolate the Eulerian data with index @p f_data_idx to the quadrature
+     * points of the active elements of a local patch and accumulate the
+     * weighted integrals of the interpolated values against the FE basis
+     * functions into @p F_vec.  If @p F_local_soln is not null, the values are
+     * added directly to this array, which must be the ghosted local form of
+     * @p F_vec with @p F_local_size entries.
+     *
+     * This is the per-patch part of interpWeighted() and
+     * interpWeightedAndSpread().
+     */
+    void interpWeightedOnPatch(int f_data_idx,
+                               const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& patch,
+                               const std::vector<libMesh::Elem*>& patch_elems,
+                               const PatchQuadratureData& patch_quad_data,
+                               libMesh::NumericVector<double>& F_vec,
+                               double* F_local_soln,
+                               PetscInt F_local_size,
+                               FEData::SystemDofMapCache& F_dof_map_cache,
+                               FECache& F_fe_cache,
+                               unsigned int n_vars,
+                               const std::string& kernel_fcn);
+
+    /*!
+     * Evaluate the FE field @p F_vec multiplied by JxW at the quadrature
+     * points of the active elements of a local patch and spread these values
+     * to the Eulerian data with index @p f_data_idx.
+     *
+     * This is the per-patch part of spread() and interpWeightedAndSpread().
+     *
+     * @note @p F_local_soln must be the array of @p F_vec, which is accessed
+     * by the caller.
+     */
+    void spreadOnPatch(int f_data_idx,
+                       const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> >& patch,
+                       const std::vector<libMesh::Elem*>& patch_elems,
+                       const PatchQuadratureData& patch_quad_data,
+                       libMesh::PetscVector<double>& F_vec,
+                       const double* F_local_soln,
+                       FEData::SystemDofMapCache& F_dof_map_cache,
+                       FECache& F_fe_cache,
+                       unsigned int n_vars,
+                       const std::string& kernel_fcn);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1274,6 +1403,18 @@ private:
      * buildIBGhostedVector.
      */
     std::map<std::string, std::unique_ptr<libMesh::PetscVector<double> > > d_system_ib_ghost_vec;
+
+    /*!
+     * Cached quadrature data (see setQuadratureDataCachingEnabled()) and the
+     * quadrature parameters with which they were computed.
+     */
+    bool d_cache_quadrature_data = false;
+    bool d_patch_quadrature_data_valid = false;
+    std::vector<PatchQuadratureData> d_patch_quadrature_data;
+    libMesh::QuadratureType d_patch_quadrature_data_quad_type = libMesh::INVALID_Q_RULE;
+    libMesh::Order d_patch_quadrature_data_quad_order = libMesh::INVALID_ORDER;
+    bool d_patch_quadrature_data_use_adaptive_quadrature = false;
+    double d_patch_quadrature_data_point_density = 0.0;
 };
 } // namespace IBTK
 
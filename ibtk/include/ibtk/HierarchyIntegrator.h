@@ -22,6 +22,7 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/RegionOfInterestDataWriter.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "BasePatchHierarchy.h"
@@ -362,12 +363,30 @@ public:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > getVisItDataWriter() const;
 
+    /*!
+     * Register a region of interest data writer so the integrator can output
+     * reduced versions of its data.
+     */
+    void registerRegionOfInterestDataWriter(SAMRAI::tbox::Pointer<RegionOfInterestDataWriter> roi_writer);
+
+    /*!
+     * Get a pointer to the region of interest data writer registered with the
+     * solver.
+     */
+    SAMRAI::tbox::Pointer<RegionOfInterestDataWriter> getRegionOfInterestDataWriter() const;
+
     /*!
      * Prepare variables for plotting.
      *
      * Subclasses can control the method used to setup plot data by overriding
      * the protected virtual member function setupPlotData().
      *
+     * If a region of interest data writer is registered, this function also
+     * registers the cell-centered and scalar side-centered double-precision
+     * variables in the current context with that writer and, if the writer
+     * uses refinement tags, allocates and computes the tags. The writer
+     * deallocates the tags once they have been written.
+     *
      * \note Subclasses are allowed to require that this function be called
      * immediately before writing visualization data.
      */
@@ -925,6 +944,14 @@ protected:
     const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >&
     getGhostfillRefineSchedules(const std::string& name) const;
 
+    /*!
+     * Rebuild the ghost cell-filling refine schedules for all levels of the
+     * patch hierarchy.  This is needed, e.g., when the fill pattern used by
+     * the corresponding refine algorithm changes between regridding
+     * operations.
+     */
+    void rebuildGhostfillRefineSchedules(const std::string& name);
+
     /*!
      * Get data-prolonging refine schedules.
      *
@@ -1041,6 +1068,11 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*
+     * The object used to write out reduced versions of the data.
+     */
+    SAMRAI::tbox::Pointer<RegionOfInterestDataWriter> d_roi_writer;
+
     /*
      * Time and time step size data read from input or set at initialization.
      */
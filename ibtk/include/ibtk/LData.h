@@ -281,6 +281,17 @@ public:
      */
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+    /*!
+     * \brief Write out object state to the given database, optionally omitting
+     * the values of the vector.
+     *
+     * \note When the values are omitted, the vector is zero-initialized when
+     * the object is restored from the database, and the values must be
+     * restored separately (e.g., from a binary restart file written by
+     * LDataManager).
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, bool put_values);
+
 private:
     /*!
      * \brief Default constructor.
@@ -29,6 +29,7 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchLevel.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -192,6 +193,53 @@ public:
      */
     const std::string& getDefaultSpreadKernelFunction() const;
 
+    /*!
+     * \brief Indicate whether the cached local indices of each patch should be
+     * sorted along the Morton (Z-order) space-filling curve of the grid cells
+     * that contain the Lagrangian nodes.
+     *
+     * Sorting the nodes by cell improves the memory locality of the
+     * interpolation and spreading operations for dense Lagrangian meshes.  The
+     * ordering is recomputed only when the Lagrangian data are redistributed.
+     *
+     * \see LIndexSetData::cacheLocalIndices()
+     */
+    void setUseMortonOrdering(bool use_morton_ordering);
+
+    /*!
+     * \brief Return whether the cached local indices of each patch are sorted
+     * along the Morton (Z-order) space-filling curve.
+     */
+    bool getUseMortonOrdering() const;
+
+    /*!
+     * \brief Set the directory in which the values of the Lagrangian data are
+     * written when restart data are written.
+     *
+     * By default, the values of each LData object are stored in the SAMRAI
+     * restart database, which is serialized by each MPI process separately.
+     * When a nonempty directory name is provided, putToDatabase() instead
+     * stores only the metadata of each LData object in the restart database
+     * and writes its values, in the fixed Lagrangian ordering, to a single
+     * binary file per quantity and level via collective MPI-IO.  Each process
+     * writes its contiguous range of nodes at an offset determined by the
+     * number of nodes owned by lower-ranked processes.  These files are read
+     * back automatically when the object is restored from restart.
+     *
+     * \note The binary files use the native byte order, and each restart dump
+     * writes a new set of files.  Because the files are indexed by Lagrangian
+     * node index rather than by PETSc index, their contents do not depend on
+     * the number of MPI processes that wrote them.
+     */
+    void setLDataRestartDirectory(const std::string& restart_dirname);
+
+    /*!
+     * \brief Return the directory in which the values of the Lagrangian data
+     * are written when restart data are written.  An empty string indicates
+     * that the values are stored in the restart database.
+     */
+    const std::string& getLDataRestartDirectory() const;
+
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
      * using the default spreading kernel function.
@@ -484,6 +532,8 @@ public:
 
     /*!
      * \brief Register a Silo data writer with the manager.
+     *
+     * \note An LHDF5DataWriter may also be registered via this method.
      */
     void registerLSiloDataWriter(SAMRAI::tbox::Pointer<LSiloDataWriter> silo_writer);
 
@@ -657,6 +707,16 @@ public:
      */
     std::pair<Point, Point> computeLagrangianStructureBoundingBox(int structure_id, int level_number);
 
+    /*!
+     * \brief Compute, for each local patch of the specified level, the bounding
+     * box of the cells in the patch interior that contain Lagrangian nodes.
+     * Patches that do not contain any nodes do not contribute a box.
+     *
+     * \note The boxes are determined by the current assignment of nodes to
+     * patches, which is only updated when the data are redistributed.
+     */
+    void computeLagrangianNodeBoxes(SAMRAI::hier::BoxList<NDIM>& node_boxes, int level_number) const;
+
     /*!
      * \brief Reset the positions of the nodes of the Lagrangian structure with
      * the specified ID to be equal to the initial positions but shifted so that
@@ -1024,6 +1084,20 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Write the values of the specified Lagrangian data to the specified
+     * binary file in the fixed Lagrangian ordering using collective MPI-IO.
+     */
+    void writeLDataRestartFile(const std::string& file_name,
+                               SAMRAI::tbox::Pointer<LData> ldata,
+                               int level_number) const;
+
+    /*!
+     * Read the values of the specified Lagrangian data from the specified
+     * binary file written by writeLDataRestartFile() using collective MPI-IO.
+     */
+    void readLDataRestartFile(const std::string& file_name, SAMRAI::tbox::Pointer<LData> ldata, int level_number) const;
+
     /*!
      * Static data members used to control access to and destruction of
      * singleton data manager instance.
@@ -1116,6 +1190,21 @@ private:
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to sort the cached local indices of each patch along the Morton
+     * space-filling curve.
+     */
+    bool d_use_morton_ordering = false;
+
+    /*
+     * The directory in which the values of the Lagrangian data are written
+     * with MPI-IO when restart data are written (empty if the values are
+     * stored in the restart database), and the number of restart dumps that
+     * have used this directory.
+     */
+    std::string d_ldata_restart_dirname;
+    int d_ldata_restart_dump_count = 0;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
@@ -86,8 +86,32 @@ public:
     static double (*s_kernel_fcn)(double r);
     static int s_kernel_fcn_stencil_size;
 
+    /*!
+     * \brief Number of threads to use when spreading, and the minimum number of
+     * Lagrangian nodes in a patch for which the threaded spreading code path is
+     * used.
+     *
+     * \note Threaded spreading is only available when IBTK is compiled with
+     * OpenMP support.  The threaded spreading operation bins the Lagrangian
+     * nodes into tiles that are wider than the kernel stencil and colors the
+     * tiles so that the stencils of nodes in distinct tiles of the same color
+     * never overlap.  Tiles of the same color are processed concurrently and the
+     * colors are processed in a fixed order, so that the result does not depend
+     * on the number of threads.
+     */
+    static int s_num_spread_threads;
+    static int s_min_threaded_spread_size;
+
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * The following keys are read from the database:
+     *
+     * - <code>num_spread_threads</code>: number of threads used by the threaded
+     *   spreading operation (default 1, i.e., threaded spreading is disabled).
+     *   A value of 0 uses the default number of OpenMP threads.
+     * - <code>min_threaded_spread_size</code>: minimum number of Lagrangian
+     *   nodes in a patch for which threaded spreading is used (default 1024).
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -1272,6 +1296,29 @@ private:
                        const std::string& spread_fcn,
                        int axis = 0);
 
+    /*!
+     * Implementation of the threaded IB spreading operation.
+     *
+     * The Lagrangian nodes are sorted into colored tiles and the serial
+     * spreading operation is applied concurrently to all tiles of each color.
+     */
+    static void spreadThreaded(double* q_data,
+                               const SAMRAI::hier::Box<NDIM>& q_data_box,
+                               const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                               int q_depth,
+                               const double* Q_data,
+                               int Q_depth,
+                               const double* X_data,
+                               const double* x_lower,
+                               const double* x_upper,
+                               const double* dx,
+                               const std::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                               const std::array<int, NDIM>& patch_touches_upper_physical_bdry,
+                               const std::vector<int>& local_indices,
+                               const std::vector<double>& periodic_shifts,
+                               const std::string& spread_fcn,
+                               int axis);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the LNodeIndexSetData values.
@@ -1294,41 +1341,6 @@ private:
                                   const double* X_data,
                                   int X_size,
                                   int X_depth);
-
-    /*!
-     * Implementation of the IB interpolation operation for a user-defined
-     * kernel.
-     */
-    static void userDefinedInterpolate(double* Q,
-                                       int Q_depth,
-                                       const double* X,
-                                       const double* q,
-                                       const SAMRAI::hier::Box<NDIM>& q_data_box,
-                                       const int* q_gcw,
-                                       int q_depth,
-                                       const double* x_lower,
-                                       const double* x_upper,
-                                       const double* dx,
-                                       const int* local_indices,
-                                       const double* X_shift,
-                                       int num_local_indices);
-
-    /*!
-     * Implementation of the IB spreading operation for a user-defined kernel.
-     */
-    static void userDefinedSpread(double* q,
-                                  const SAMRAI::hier::Box<NDIM>& q_data_box,
-                                  const int* q_gcw,
-                                  int q_depth,
-                                  const double* x_lower,
-                                  const double* x_upper,
-                                  const double* dx,
-                                  const double* Q,
-                                  int Q_depth,
-                                  const double* X,
-                                  const int* local_indices,
-                                  const double* X_shift,
-                                  int num_local_indices);
 };
 } // namespace IBTK
 
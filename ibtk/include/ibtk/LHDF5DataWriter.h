@@ -0,0 +1,134 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_LHDF5DataWriter
+#define included_IBTK_LHDF5DataWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/LSiloDataWriter.h"
+
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LHDF5DataWriter writes Lagrangian data for visualization to a
+ * single HDF5 file per time step, along with an <A
+ * HREF="http://www.xdmf.org">XDMF</A> file that describes the meshes stored
+ * in the HDF5 file (and that can be opened by VisIt or ParaView).
+ *
+ * LSiloDataWriter writes one file per MPI process per time step, which can
+ * overwhelm parallel file systems when many processes are used. This class
+ * instead stores, for each level, the coordinates and each registered
+ * variable of all markers in one dataset, each MPI process writing the
+ * contiguous range of rows that corresponds to its local data. Marker clouds,
+ * logically Cartesian blocks, multiblocks, and unstructured meshes are stored
+ * as ranges of rows of these datasets and are described by the XDMF file.
+ *
+ * This class uses the same registration interface as LSiloDataWriter, from
+ * which it is derived, so that it can be registered with LDataManager and with
+ * the IBAMR structure initializers and integrators in exactly the same way
+ * (e.g., via LDataManager::registerLSiloDataWriter()).
+ *
+ * When HDF5 is built with MPI support, the file is written collectively using
+ * MPI-IO. Otherwise, MPI processes write their data to the file one at a time.
+ *
+ * \note The periodicity of logically Cartesian blocks is not represented in
+ * the XDMF file.
+ */
+class LHDF5DataWriter : public LSiloDataWriter
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name           String used for error reporting.
+     * \param dump_directory_name   String indicating the directory where visualization data is to
+     * be written.
+     * \param register_for_restart  Boolean indicating whether to register this object with the
+     * restart manager.
+     */
+    LHDF5DataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart = true);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LHDF5DataWriter() = default;
+
+    /*!
+     * \brief Set the number of rows per chunk of the HDF5 datasets.
+     */
+    void setChunkSize(int chunk_size);
+
+    /*!
+     * \brief Set the level of the deflate (gzip) compression applied to the
+     * HDF5 datasets. A value of zero, the default, disables compression.
+     *
+     * \note Writing compressed datasets collectively requires HDF5 1.10.2 or
+     * newer.
+     */
+    void setCompressionLevel(int compression_level);
+
+    /*!
+     * \brief Write the plot data to disk.
+     *
+     * \note This method is collective over all MPI processes.
+     */
+    void writePlotData(int time_step_number, double simulation_time) override;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LHDF5DataWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LHDF5DataWriter(const LHDF5DataWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LHDF5DataWriter& operator=(const LHDF5DataWriter& that) = delete;
+
+    /*
+     * HDF5 dataset creation parameters.
+     */
+    int d_chunk_size = 4096;
+    int d_compression_level = 0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LHDF5DataWriter
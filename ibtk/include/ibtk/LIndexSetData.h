@@ -67,9 +67,19 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * If \a use_morton_ordering is true, the cached indices are sorted along
+     * the Morton (Z-order) space-filling curve of the Cartesian grid cells that
+     * contain the Lagrangian nodes.  Because the Eulerian-Lagrangian interaction
+     * routines in class LEInteractor process the nodes in the order of the
+     * cached indices, this ordering ensures that consecutively processed nodes
+     * access nearby regions of the Eulerian patch data.  The cached indices are
+     * only updated when the Lagrangian data are redistributed, i.e., when the
+     * nodes have moved between grid cells.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           bool use_morton_ordering = false);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
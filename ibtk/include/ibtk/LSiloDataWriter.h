@@ -31,6 +31,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -57,6 +58,12 @@ namespace IBTK
  *
  * For more information about Silo, see the Silo manual <A
  * HREF="http://www.llnl.gov/bdiv/meshtv/manuals/silo.pdf">here</A>.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ write_asynchronously = FALSE       // see getAsynchronousWritesEnabled()
+ \endverbatim
  */
 class LSiloDataWriter : public SAMRAI::tbox::Serializable
 {
@@ -70,8 +77,13 @@ public:
      *be written.
      * \param register_for_restart  Boolean indicating whether to register this object with the
      *restart manager.
+     * \param input_db              Optional input database; see the class documentation for the
+     *accepted keys.
      */
-    LSiloDataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart = true);
+    LSiloDataWriter(std::string object_name,
+                    std::string dump_directory_name,
+                    bool register_for_restart = true,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = nullptr);
 
     /*!
      * \brief Destructor.
@@ -184,66 +196,81 @@ public:
     void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
 
     /*!
-     * \brief Write the plot data to disk.
+     * \brief Whether or not plot data is written asynchronously.
+     *
+     * Asynchronous writes are disabled by default and are enabled by setting
+     * the input database key \p write_asynchronously to TRUE. When enabled,
+     * writePlotData() copies the plot data, collects the metadata required by
+     * the summary file on the root MPI process, and then returns while the
+     * files are written by a background thread. At most one set of plot files
+     * is written at a time: each call to writePlotData() first waits for the
+     * previous write to finish.
+     *
+     * \note Silo is not thread-safe. When asynchronous writes are enabled, any
+     * other Silo output that is not performed by an LSiloDataWriter must be
+     * preceded by a call to waitForAllPendingWrites(). The destructor waits
+     * for the pending write of this object.
      */
-    void writePlotData(int time_step_number, double simulation_time);
+    bool getAsynchronousWritesEnabled() const;
 
     /*!
-     * Write out object state to the given database.
+     * \brief Wait until any plot data that is being written asynchronously
+     * has been written to disk.
      *
-     * When assertion checking is active, database pointer must be non-null.
+     * Errors encountered while writing the plot data are reported here, on
+     * the calling thread.
      */
-    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
+    void waitForPendingWrites();
 
-protected:
-private:
     /*!
-     * \brief Default constructor.
+     * \brief Wait until the plot data that is being written asynchronously by
+     * any LSiloDataWriter object has been written to disk.
      *
-     * \note This constructor is not implemented and should not be used.
+     * Silo is not thread-safe, so this must be called before any Silo output
+     * that is not performed by an LSiloDataWriter.
      */
-    LSiloDataWriter() = delete;
+    static void waitForAllPendingWrites();
 
     /*!
-     * \brief Copy constructor.
-     *
-     * \note This constructor is not implemented and should not be used.
+     * \brief Wait until the plot data that is being written asynchronously by
+     * any LSiloDataWriter object into the directory \p dump_directory_name has
+     * been written to disk.
      *
-     * \param from The value to copy to this object.
+     * Other data writers call this before they write into a directory that
+     * may also be used by an LSiloDataWriter.
      */
-    LSiloDataWriter(const LSiloDataWriter& from) = delete;
+    static void waitForPendingWrites(const std::string& dump_directory_name);
 
     /*!
-     * \brief Assignment operator.
-     *
-     * \note This operator is not implemented and should not be used.
-     *
-     * \param that The value to assign to this object.
+     * \brief Write the plot data to disk.
+     */
+    virtual void writePlotData(int time_step_number, double simulation_time);
+
+    /*!
+     * Write out object state to the given database.
      *
-     * \return A reference to this object.
+     * When assertion checking is active, database pointer must be non-null.
      */
-    LSiloDataWriter& operator=(const LSiloDataWriter& that) = delete;
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+protected:
     /*!
      * \brief Build the VecScatter objects required to communicate data for
-     * plotting.
+     * plotting on all levels on which they are out of date.
      */
-    void buildVecScatters(AO& ao, int level_number);
+    void updateVecScatters();
 
     /*!
-     * Read object state from the restart file and initialize class data
-     * members.  The database from which the restart data is read is determined
-     * by the object_name specified in the constructor.
+     * \brief Get the local values of the coordinates and of all registered
+     * variables on level \p level_number.
      *
-     * Unrecoverable Errors:
-     *
-     *    -   The database corresponding to object_name is not found in the
-     *        restart file.
-     *
-     *    -   The class version number and restart version number do not match.
+     * The values are ordered in the same way as the registered marker clouds,
+     * logically Cartesian blocks, multiblocks, and unstructured meshes of this
+     * MPI process (in that order), each of which uses the Lagrangian ordering.
      *
+     * \note This method is collective over all MPI processes.
      */
-    void getFromRestart();
+    void getLocalPlotData(int level_number, std::vector<double>& X_vals, std::vector<std::vector<double> >& var_vals);
 
     /*
      * The object name is used as a handle to databases stored in restart files
@@ -314,6 +341,55 @@ private:
     std::vector<std::vector<int> > d_var_start_depths, d_var_plot_depths, d_var_depths;
     std::vector<std::vector<SAMRAI::tbox::Pointer<LData> > > d_var_data;
 
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LSiloDataWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LSiloDataWriter(const LSiloDataWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LSiloDataWriter& operator=(const LSiloDataWriter& that) = delete;
+
+    /*!
+     * \brief Build the VecScatter objects required to communicate data for
+     * plotting.
+     */
+    void buildVecScatters(AO& ao, int level_number);
+
+    /*!
+     * Read object state from the restart file and initialize class data
+     * members.  The database from which the restart data is read is determined
+     * by the object_name specified in the constructor.
+     *
+     * Unrecoverable Errors:
+     *
+     *    -   The database corresponding to object_name is not found in the
+     *        restart file.
+     *
+     *    -   The class version number and restart version number do not match.
+     *
+     */
+    void getFromRestart();
+
     /*
      * Data for obtaining local data.
      */
@@ -321,6 +397,19 @@ private:
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
+
+    /*
+     * Data for writing plot data asynchronously.
+     */
+    bool d_write_asynchronously = false;
+    std::thread d_write_thread;
+    std::string d_write_error;
+
+    /*
+     * All existing LSiloDataWriter objects, which are used to wait for the
+     * pending writes of other objects.
+     */
+    static std::set<LSiloDataWriter*> s_data_writers;
 };
 } // namespace IBTK
 
@@ -23,6 +23,7 @@
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/SinglePrecisionGhostFill.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CoarsenAlgorithm.h"
@@ -96,6 +97,7 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10            // see setCoarseSolverMaxIterations()
+ use_single_precision_ghost_fill = FALSE      // see setUseSinglePrecisionGhostFill()
  \endverbatim
 */
 class PoissonFACPreconditionerStrategy : public FACPreconditionerStrategy
@@ -224,6 +226,29 @@ public:
      */
     void setRestrictionMethod(const std::string& restriction_method);
 
+    /*!
+     * \brief Set whether the same-level ghost cell values used by the
+     * smoothers are communicated in single precision.
+     *
+     * When enabled, the parts of the patch interiors that are sent to
+     * neighboring patches are rounded to single precision before each
+     * same-level ghost cell fill performed by the smoothers, and only the ghost
+     * cell values that are filled from neighboring patches on the same level
+     * (including periodic images) are replaced by the rounded values.  This
+     * halves the size of the messages exchanged in each smoothing sweep.  The
+     * level data and the smoother kernels remain in double precision, so the
+     * values of the degrees of freedom in the patch interiors and the ghost
+     * cell values at coarse-fine interfaces and physical boundaries are not
+     * rounded.  See class SinglePrecisionGhostFill.
+     *
+     * \note The rounding makes the preconditioner a nonlinear function of the
+     * residual, so it must be used with a flexible Krylov method (e.g.,
+     * ksp_type = "fgmres" for PETScKrylovLinearSolver).  With a standard
+     * Krylov method such as GMRES, the outer iteration may stagnate or
+     * converge to an inaccurate solution.
+     */
+    void setUseSinglePrecisionGhostFill(bool use_single_precision_ghost_fill);
+
     //\}
 
     /*!
@@ -426,6 +451,11 @@ protected:
     double d_coarse_solver_abs_residual_tol = 1.0e-50;
     int d_coarse_solver_max_iterations = 10;
 
+    /*
+     * Whether same-level ghost cell fills are performed in single precision.
+     */
+    bool d_use_single_precision_ghost_fill = false;
+
     //\}
 
     /*!
@@ -465,6 +495,11 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > d_op_stencil_fill_pattern, d_synch_fill_pattern;
 
+    /*
+     * Single-precision same-level ghost cell fill operator.
+     */
+    SAMRAI::tbox::Pointer<SinglePrecisionGhostFill> d_single_precision_ghost_fill_op;
+
     //\}
 
 private:
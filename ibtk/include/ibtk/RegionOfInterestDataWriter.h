@@ -0,0 +1,296 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_RegionOfInterestDataWriter
+#define included_IBTK_RegionOfInterestDataWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class RegionOfInterestDataWriter writes a reduced version of
+ * cell-centered and side-centered Eulerian data for visualization to a single
+ * HDF5 file per time step, along with an <A HREF="http://www.xdmf.org">XDMF</A>
+ * file that can be opened by VisIt or ParaView.
+ *
+ * Unlike SAMRAI::appu::VisItDataWriter, which always writes every patch of
+ * every level of the hierarchy, this class only writes
+ *
+ * - the parts of the patches that intersect one or more user-specified
+ *   rectangular regions of interest (all of each patch, if no regions are
+ *   specified);
+ * - if an indicator patch data index is provided, or if the cells tagged for
+ *   refinement are used as the indicator, the part of each patch contained in
+ *   the bounding box of its nonzero indicator values; and
+ * - optionally, only the finest level of the hierarchy, which, in IB
+ *   simulations, is typically exactly the region tagged for refinement
+ *   around the immersed structures.
+ *
+ * Data may additionally be averaged onto a grid that is coarser than the
+ * patch level by an integer factor and written in single precision. Together,
+ * these options typically reduce the size of the output by one to two orders
+ * of magnitude, which makes high-frequency output practical.
+ *
+ * Cell-centered variables of any depth are written as they are. Side-centered
+ * variables of depth one are averaged to cell centers and written as vectors.
+ * The data are not required to have ghost cells. Each written box is a
+ * separate uniform grid in the XDMF file, and the boxes on each level are
+ * grouped together. Boxes on different levels are not masked by finer levels.
+ *
+ * Sample input:
+ * \verbatim
+ RegionOfInterestDataWriter {
+    coarsening_factor = 2          // default is 1
+    use_single_precision = TRUE    // default is TRUE
+    finest_level_only = FALSE      // default is FALSE
+    use_refinement_tags = FALSE    // default is FALSE
+    compression_level = 0          // default is 0 (no compression)
+    chunk_size = 4096              // default is 4096
+
+    // Any sub-database defines a region of interest in physical coordinates.
+    region_0 {
+       x_lo = 0.25, 0.25
+       x_up = 0.75, 0.75
+    }
+ }
+ \endverbatim
+ *
+ * Typical usage:
+ * \code
+ * time_integrator->registerRegionOfInterestDataWriter(roi_data_writer);
+ * ...
+ * time_integrator->setupPlotData();
+ * roi_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
+ * \endcode
+ *
+ * When registered with a HierarchyIntegrator, HierarchyIntegrator::setupPlotData()
+ * registers the cell-centered and scalar side-centered double-precision
+ * variables in the current context of the integrator and its children for
+ * plotting and, if refinement tags are used, computes the tags.
+ *
+ * \note The coarsening factor must evenly divide the boxes of all patches
+ * (e.g., via the smallest and largest patch sizes of the GriddingAlgorithm)
+ * so that no coarse cell is written from more than one patch.
+ */
+class RegionOfInterestDataWriter : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name           String used for error reporting.
+     * \param dump_directory_name   String indicating the directory where visualization data is to
+     * be written.
+     * \param input_db              Optional input database specifying the regions of interest and
+     * the output options.
+     */
+    RegionOfInterestDataWriter(std::string object_name,
+                               std::string dump_directory_name,
+                               SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = nullptr);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~RegionOfInterestDataWriter() = default;
+
+    /*!
+     * \brief Add a rectangular region of interest, specified in physical
+     * coordinates.
+     */
+    void addRegionOfInterest(const VectorNd& x_lo, const VectorNd& x_up);
+
+    /*!
+     * \brief Restrict the output on each patch to the bounding box of the
+     * cells at which the cell-centered integer patch data with the specified
+     * index is nonzero. Patches that contain no such cells are not written.
+     *
+     * A negative index, the default, disables this restriction.
+     */
+    void setRegionOfInterestIndicator(int indicator_idx);
+
+    /*!
+     * \brief Set whether the output on each patch is restricted to the
+     * bounding box of the cells that are tagged for refinement by the
+     * HierarchyIntegrator with which this object is registered.
+     *
+     * The tags are stored in patch data owned by this object. They are
+     * allocated and computed by HierarchyIntegrator::setupPlotData() and are
+     * deallocated at the end of writePlotData().
+     */
+    void setUseRefinementTags(bool use_refinement_tags);
+
+    /*!
+     * \brief Get the patch data index in which the refinement tags are
+     * computed, or IBTK::invalid_index if refinement tags are not used.
+     */
+    int getRefinementTagsIndex() const;
+
+    /*!
+     * \brief Set the factor by which the data are coarsened before they are
+     * written.
+     */
+    void setCoarseningFactor(int coarsening_factor);
+
+    /*!
+     * \brief Set whether data are written in single precision.
+     */
+    void setUseSinglePrecision(bool use_single_precision);
+
+    /*!
+     * \brief Set whether only the finest level of the patch hierarchy is
+     * written.
+     */
+    void setFinestLevelOnly(bool finest_level_only);
+
+    /*!
+     * \brief Register a cell-centered or side-centered double-precision
+     * variable for plotting.
+     */
+    void registerPlotQuantity(const std::string& var_name, int patch_data_idx);
+
+    /*!
+     * \brief Whether a variable with the specified name is registered for
+     * plotting.
+     */
+    bool isPlotQuantityRegistered(const std::string& var_name) const;
+
+    /*!
+     * \brief Write the plot data to disk.
+     *
+     * \note This method is collective over all MPI processes.
+     */
+    void writePlotData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                       int time_step_number,
+                       double simulation_time);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    RegionOfInterestDataWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    RegionOfInterestDataWriter(const RegionOfInterestDataWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    RegionOfInterestDataWriter& operator=(const RegionOfInterestDataWriter& that) = delete;
+
+    /*!
+     * \brief Return the patch data index of the indicator that is used to
+     * restrict the output, or a negative value if there is none.
+     */
+    int getIndicatorIndex() const;
+
+    /*!
+     * \brief Determine the disjoint boxes, in the coarsened index space of the
+     * patch level, that are written for the specified patch.
+     */
+    std::vector<SAMRAI::hier::Box<NDIM> > getOutputBoxes(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * \brief Average the registered variables over the fine cells of the
+     * specified patch that are covered by each cell of the coarsened output
+     * box, and append the values to the corresponding output arrays.
+     */
+    void packBoxData(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                     const SAMRAI::hier::Box<NDIM>& output_box,
+                     std::vector<std::vector<double> >& var_vals) const;
+
+    /*!
+     * \brief Read input values from a given database.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
+    /*
+     * The object name is used for error reporting purposes.
+     */
+    std::string d_object_name;
+
+    /*
+     * The directory where data is to be dumped and the most recent time step
+     * number at which data was written.
+     */
+    std::string d_dump_directory_name;
+    int d_time_step_number = -1;
+
+    /*
+     * The regions of interest, in physical coordinates, and the index of the
+     * optional region of interest indicator.
+     */
+    EigenAlignedVector<std::pair<VectorNd, VectorNd> > d_regions;
+    int d_indicator_idx = -1;
+
+    /*
+     * The patch data index of the refinement tags, if they are used.
+     */
+    int d_tag_idx = IBTK::invalid_index;
+
+    /*
+     * Output options.
+     */
+    int d_coarsening_factor = 1;
+    bool d_use_single_precision = true;
+    bool d_finest_level_only = false;
+    int d_chunk_size = 4096;
+    int d_compression_level = 0;
+
+    /*
+     * The registered variables: their names, patch data indices, whether they
+     * are side-centered, and the number of components that are written.
+     */
+    std::vector<std::string> d_var_names;
+    std::vector<int> d_var_idxs;
+    std::vector<bool> d_var_is_side_centered;
+    std::vector<int> d_var_plot_depths;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_RegionOfInterestDataWriter
@@ -108,8 +108,18 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by SysPFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_hypre_data = FALSE       // keep the hypre grid, graph, matrix, and vectors between
+ initializations
+ solver_setup_reuse_interval = 0 // number of initializations for which the solver setup is reused
+ (only used when reuse_hypre_data is TRUE)
  \endverbatim
  *
+ * Reusing the hypre data structures works as in CCPoissonHypreLevelSolver:
+ * when the patch level is unchanged, reinitializing the solver only overwrites
+ * the values of the existing hypre matrix, and the SysPFMG or split solver
+ * setup may be lagged by up to \p solver_setup_reuse_interval
+ * reinitializations.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -221,6 +231,9 @@ public:
      * already initialized.  In this case, the solver state is first deallocated
      * and then reinitialized.
      *
+     * \note When hypre data reuse is enabled, the hypre data structures are only
+     * rebuilt when the patch level configuration has changed.
+     *
      * \see deallocateSolverState
      */
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
@@ -272,6 +285,7 @@ private:
      * data structures.
      */
     void allocateHypreData();
+    bool hypreGridMatchesLevel() const;
     void setMatrixCoefficients();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
@@ -322,6 +336,16 @@ private:
     int d_skip_relax = 1;
     int d_two_norm = 1;
     //\}
+
+    /*!
+     * \name Data for reusing hypre data structures between initializations.
+     */
+    //\{
+    bool d_reuse_hypre_data = false;
+    int d_solver_setup_reuse_interval = 0;
+    int d_num_solver_setup_reuses = 0;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_hypre_patch_boxes;
+    //\}
 };
 } // namespace IBTK
 
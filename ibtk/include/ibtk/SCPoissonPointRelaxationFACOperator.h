@@ -40,7 +40,14 @@ template <int DIM>
 class Box;
 template <int DIM>
 class BoxList;
+template <int DIM>
+class Patch;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class SideData;
+} // namespace pdat
 namespace solv
 {
 template <int DIM, class TYPE>
@@ -85,6 +92,10 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_single_precision_ghost_fill = FALSE      // see setUseSinglePrecisionGhostFill()
+ chebyshev_eigenvalue_estimate_iterations = 10  // power iterations used by the "CHEBYSHEV" smoother
+ chebyshev_lower_eigenvalue_factor = 0.1      // see setSmootherType()
+ chebyshev_upper_eigenvalue_factor = 1.1      // see setSmootherType()
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
@@ -129,6 +140,17 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
+     *
+     * The \c "CHEBYSHEV" smoother performs Chebyshev-accelerated Jacobi
+     * iterations, which require one ghost cell fill per sweep and update all
+     * degrees of freedom independently.  The largest eigenvalue
+     * \f$ \lambda \f$ of the Jacobi-preconditioned operator is estimated on
+     * each level by power iteration the first time that the level is smoothed
+     * after the operator state is initialized, and the Chebyshev polynomial
+     * targets the interval \f$ [a \lambda, b \lambda] \f$, in which \em a and
+     * \em b are set by the input keys \c chebyshev_lower_eigenvalue_factor
+     * and \c chebyshev_upper_eigenvalue_factor.
      */
     void setSmootherType(const std::string& smoother_type) override;
 
@@ -208,6 +230,36 @@ protected:
      */
     void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln) override;
 
+    /*!
+     * \brief Perform a given number of Chebyshev-accelerated Jacobi iterations
+     * on the error.
+     */
+    void smoothErrorChebyshev(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                              const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                              int level_num,
+                              int num_sweeps);
+
+    /*!
+     * \brief Estimate the largest eigenvalue of the Jacobi-preconditioned
+     * operator on the specified level by power iteration.
+     *
+     * \note This function uses the scratch data as temporary storage.
+     */
+    void estimateMaxEigenvalue(int level_num);
+
+    /*!
+     * \brief Compute the Jacobi correction \f$ z = D^{-1} (f - A u) \f$ on the
+     * interior of the specified patch, in which \f$ D \f$ is the diagonal part
+     * of \f$ A \f$.  The ghost cell values of \f$ u \f$ must be filled, and the
+     * correction vanishes at degrees of freedom at Dirichlet boundaries.
+     *
+     * Subclasses that implement other operators must override this function.
+     */
+    virtual void computeJacobiCorrection(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > z_data,
+                                         SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > u_data,
+                                         SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > f_data,
+                                         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -226,6 +278,16 @@ protected:
     SAMRAI::tbox::Pointer<StaggeredPhysicalBoundaryHelper> d_bc_helper;
     int d_mask_idx;
 
+    /*
+     * Chebyshev smoother parameters and the estimated largest eigenvalue of the
+     * Jacobi-preconditioned operator on each level.  Nonpositive values
+     * indicate that the eigenvalue has not yet been estimated.
+     */
+    int d_chebyshev_eigenvalue_estimate_iterations = 10;
+    double d_chebyshev_lower_eigenvalue_factor = 0.1;
+    double d_chebyshev_upper_eigenvalue_factor = 1.1;
+    std::vector<double> d_chebyshev_max_eigenvalue_estimates;
+
 private:
     /*!
      * \brief Default constructor.
@@ -0,0 +1,172 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_SinglePrecisionGhostFill
+#define included_IBTK_SinglePrecisionGhostFill
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/ibtk_utilities.h"
+
+#include "BoxList.h"
+#include "PatchHierarchy.h"
+#include "RefineAlgorithm.h"
+#include "RefineSchedule.h"
+#include "VariableContext.h"
+#include "VariableFillPattern.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SinglePrecisionGhostFill fills the same-level ghost cell values
+ * of double-precision cell- or side-centered data by exchanging
+ * single-precision copies of the data.
+ *
+ * For each data component, the operator maintains single-precision scratch
+ * data with the same centering, depth, and ghost cell width.  A fill rounds
+ * the parts of the patch interiors that neighboring patches read to single
+ * precision, fills the ghost cells of the single-precision data from the same
+ * level (including periodic images), and copies only the ghost cell values
+ * filled by that exchange back into the double-precision data.  The messages
+ * exchanged are therefore half the size of those of a double-precision fill.
+ * All other values, including coarse-fine interface and physical boundary
+ * ghost cell values, are not modified.  Physical boundary conditions should be
+ * set by the caller after the fill.
+ *
+ * The exchanged regions are determined when the operator is initialized by
+ * evaluating the fill patterns against the neighbors of each local patch,
+ * which are found with the box tree of the level.
+ *
+ * \note The rounding makes the result of an iterative method that uses these
+ * fills a nonlinear function of its input.  Preconditioners that use this
+ * class must therefore be used with flexible Krylov methods such as FGMRES.
+ */
+class SinglePrecisionGhostFill : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SinglePrecisionGhostFill(std::string object_name);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SinglePrecisionGhostFill();
+
+    /*!
+     * \brief Setup the operator to fill the ghost cell values of the specified
+     * range of levels of the patch hierarchy.
+     *
+     * The single-precision scratch data for component \p k have the same
+     * centering, depth, and ghost cell width as the double-precision data
+     * \p data_idxs[k], and its ghost cells are filled according to
+     * \p fill_patterns[k].  A null fill pattern fills the entire ghost cell
+     * region.  The state of levels outside of the range is not modified.  By
+     * default, all levels of the hierarchy are initialized.
+     */
+    void initializeOperatorState(
+        const std::vector<int>& data_idxs,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > >& fill_patterns,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+        int coarsest_ln = IBTK::invalid_level_number,
+        int finest_ln = IBTK::invalid_level_number);
+
+    /*!
+     * \brief Deallocate the scratch data and the cached communication schedules
+     * of the specified range of levels.  By default, all levels are
+     * deallocated and the operator is reset.
+     */
+    void deallocateOperatorState(int coarsest_ln = IBTK::invalid_level_number,
+                                 int finest_ln = IBTK::invalid_level_number);
+
+    /*!
+     * \brief Fill the same-level ghost cell values of the double-precision data
+     * \p dst_idxs on level \p ln.
+     *
+     * The data must have the same layouts as the data used to initialize the
+     * operator.
+     */
+    void fillData(const std::vector<int>& dst_idxs, int ln, double fill_time);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SinglePrecisionGhostFill() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SinglePrecisionGhostFill(const SinglePrecisionGhostFill& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SinglePrecisionGhostFill& operator=(const SinglePrecisionGhostFill& that) = delete;
+
+    /*!
+     * \brief Register the single-precision scratch data when necessary and set
+     * their depths to the depths of the specified double-precision data.
+     */
+    void setupScratchData(const std::vector<int>& data_idxs);
+
+    // The object name.
+    std::string d_object_name;
+
+    // Hierarchy configuration.
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    // Single-precision scratch data.
+    SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_context;
+    std::vector<int> d_scratch_idxs;
+
+    // Cached communications algorithm and schedules.
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_refine_alg;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
+
+    // The parts of the interior of each local patch that are read by the fill
+    // and the parts of its ghost cell region that are filled by it, indexed by
+    // level number, data component, patch number, and array data component
+    // (one for cell-centered data and NDIM for side-centered data).
+    using PatchBoxes = std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > >;
+    std::vector<std::vector<PatchBoxes> > d_send_boxes, d_recv_boxes;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SinglePrecisionGhostFill
@@ -0,0 +1,230 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_StencilRegionFillPattern
+#define included_IBTK_StencilRegionFillPattern
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "BoxList.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "VariableFillPattern.h"
+#include "tbox/Pointer.h"
+
+#include <array>
+#include <map>
+#include <string>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class BoxGeometry;
+template <int DIM>
+class BoxOverlap;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class StencilRegionFillPattern is a concrete implementation of the
+ * abstract base class SAMRAI::xfer::VariableFillPattern.  It is used to
+ * calculate overlaps according to a pattern which limits the data filled on
+ * each patch of the destination level to the region of the specified stencil
+ * width surrounding the cells in which the patch actually needs data (e.g.,
+ * the cells that contain Lagrangian markers).
+ *
+ * Regions are specified separately for each level of the patch hierarchy, in
+ * the index space of that level, and the region of each destination patch is
+ * taken to be the bounding box of the parts of the region boxes that lie in
+ * the interior of that patch, grown by an optional margin.  The margin allows
+ * the region to change (e.g., as Lagrangian markers move) between updates of
+ * the region boxes.  Patches that do not intersect the region do not receive
+ * any data from the same level.  Levels for which no regions have
+ * been specified are filled without restriction, as are the data transfers
+ * that do not target the destination level itself (e.g., the transfers used to
+ * fill data at coarse-fine interfaces).
+ *
+ * The region of each patch is stored by patch box, and it is only sent to the
+ * processes that own patches from which the patch can receive data.
+ *
+ * \note Communication schedules that use this fill pattern must be rebuilt
+ * whenever the regions change.
+ */
+class StencilRegionFillPattern : public SAMRAI::xfer::VariableFillPattern<NDIM>
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param stencil_width  the width of the stencil surrounding each cell of the region
+     * \param region_margin  the number of cells by which the region of each patch is grown
+     */
+    StencilRegionFillPattern(int stencil_width, int region_margin = 0);
+
+    /*!
+     * \brief Destructor
+     */
+    ~StencilRegionFillPattern() = default;
+
+    /*!
+     * \brief Set the boxes, in the index space of the specified level, that
+     * determine the region filled on each patch of that level.  An empty
+     * collection of boxes on all processes indicates that no data is to be
+     * filled on the level.
+     *
+     * \note This is a collective operation: each process provides the boxes of
+     * its local patches.  Overlaps are calculated on both the source and
+     * destination processes of each data transfer, so the region of each
+     * patch is also sent to the processes that own the patches that intersect
+     * the region grown by the stencil width and the margin (including
+     * periodic images).
+     */
+    void setRegionBoxes(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                        const SAMRAI::hier::BoxList<NDIM>& local_region_boxes);
+
+    /*!
+     * \brief Remove the region boxes for all levels, so that subsequent
+     * overlaps are calculated without restriction.
+     */
+    void clearRegionBoxes();
+
+    /*!
+     * Calculate overlaps between the destination and source geometries.  This
+     * does not restrict the overlaps.
+     *
+     * \param dst_geometry        geometry object for destination box
+     * \param src_geometry        geometry object for source box
+     * \param dst_patch_box       box for the destination patch
+     * \param src_mask            the source mask, the box resulting from shifting the source
+     *box
+     * \param overwrite_interior  controls whether or not to include the destination box
+     *interior in
+     *the overlap
+     * \param src_offset          the offset between source and destination index space (src +
+     *src_offset = dst)
+     *
+     * \return                    pointer to the calculated overlap object
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> >
+    calculateOverlap(const SAMRAI::hier::BoxGeometry<NDIM>& dst_geometry,
+                     const SAMRAI::hier::BoxGeometry<NDIM>& src_geometry,
+                     const SAMRAI::hier::Box<NDIM>& dst_patch_box,
+                     const SAMRAI::hier::Box<NDIM>& src_mask,
+                     bool overwrite_interior,
+                     const SAMRAI::hier::IntVector<NDIM>& src_offset) const override;
+
+    /*!
+     * Calculate overlaps between the destination and source geometries according
+     * to the desired pattern.  On the target level, this will return the
+     * portion of the intersection of the geometries that lies within the
+     * specified stencil width of the (grown) region of the destination patch.  The
+     * patch is identified by the argument dst_patch_box.
+     *
+     * \param dst_geometry        geometry object for destination box
+     * \param src_geometry        geometry object for source box
+     * \param dst_patch_box       box for the destination patch
+     * \param src_mask            the source mask, the box resulting from shifting the source
+     *box
+     * \param overwrite_interior  controls whether or not to include the destination box
+     *interior in
+     *the overlap
+     * \param src_offset          the offset between source and destination index space (src +
+     *src_offset = dst)
+     * \param dst_level_num       the level of the patch hierarchy on which the dst boxes are
+     *located
+     * \param src_level_num       the level of the patch hierarchy on which the src boxes are
+     *located
+     *
+     * \return                    pointer to the calculated overlap object
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> >
+    calculateOverlapOnLevel(const SAMRAI::hier::BoxGeometry<NDIM>& dst_geometry,
+                            const SAMRAI::hier::BoxGeometry<NDIM>& src_geometry,
+                            const SAMRAI::hier::Box<NDIM>& dst_patch_box,
+                            const SAMRAI::hier::Box<NDIM>& src_mask,
+                            bool overwrite_interior,
+                            const SAMRAI::hier::IntVector<NDIM>& src_offset,
+                            int dst_level_num,
+                            int src_level_num) const override;
+
+    /*!
+     * Set the target patch level number for the variable fill pattern.
+     */
+    void setTargetPatchLevelNumber(int level_num) override;
+
+    /*!
+     * Returns the stencil width.
+     */
+    SAMRAI::hier::IntVector<NDIM>& getStencilWidth() override;
+
+    /*!
+     * Returns a string name identifier "STENCIL_REGION_FILL_PATTERN".
+     */
+    const std::string& getPatternName() const override;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    StencilRegionFillPattern() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    StencilRegionFillPattern(const StencilRegionFillPattern& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    StencilRegionFillPattern& operator=(const StencilRegionFillPattern& that) = delete;
+
+    SAMRAI::hier::IntVector<NDIM> d_stencil_width;
+    int d_region_margin;
+    /*!
+     * The regions of the local patches, and of the remote patches that may
+     * receive data from the local patches, of each level, indexed by the lower
+     * and upper indices of the patch box.
+     */
+    std::map<int, std::map<std::array<int, 2 * NDIM>, SAMRAI::hier::Box<NDIM> > > d_patch_regions;
+    int d_target_level_num = IBTK::invalid_level_number;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_StencilRegionFillPattern
@@ -56,6 +56,9 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ chebyshev_eigenvalue_estimate_iterations = 10  // see SCPoissonPointRelaxationFACOperator
+ chebyshev_lower_eigenvalue_factor = 0.1      // see SCPoissonPointRelaxationFACOperator
+ chebyshev_upper_eigenvalue_factor = 1.1      // see SCPoissonPointRelaxationFACOperator
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
@@ -169,6 +172,15 @@ protected:
                                             int coarsest_reset_ln,
                                             int finest_reset_ln) override;
 
+    /*!
+     * \brief Compute the Jacobi correction for the variable-coefficient viscous
+     * operator on the interior of the specified patch.
+     */
+    void computeJacobiCorrection(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > z_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > u_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > f_data,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) override;
+
 private:
     /*!
      * \brief Default constructor.
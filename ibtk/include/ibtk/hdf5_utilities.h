@@ -0,0 +1,89 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_hdf5_utilities
+#define included_IBTK_hdf5_utilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "hdf5.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace IBTK
+{
+/**
+ * The global size of a two-dimensional HDF5 dataset and the contiguous range
+ * of rows of that dataset that are written by the current MPI process.
+ */
+struct HDF5DatasetRows
+{
+    std::string path;
+    hid_t mem_type;
+    hid_t file_type;
+    hsize_t num_rows;
+    hsize_t num_cols;
+    hsize_t row_offset;
+    hsize_t num_local_rows;
+    const void* local_vals;
+};
+
+/**
+ * Compute the offset of the rows owned by the current MPI process, assuming
+ * that rows are assigned to processes in rank order, and the total number of
+ * rows. This function is collective.
+ */
+std::pair<hsize_t, hsize_t> compute_hdf5_row_range(int num_local_rows);
+
+/**
+ * Create the HDF5 file @p file_path containing the groups @p group_names and
+ * the (chunked and, if @p compression_level is positive, deflate-compressed)
+ * datasets @p datasets, and write the rows of each dataset that belong to the
+ * current MPI process. When HDF5 is built with MPI support, the file is
+ * written collectively via MPI-IO; otherwise, the MPI processes take turns
+ * writing to the file. This function is collective.
+ */
+void write_hdf5_datasets(const std::string& file_path,
+                         const std::vector<std::string>& group_names,
+                         const std::vector<HDF5DatasetRows>& datasets,
+                         int chunk_size,
+                         int compression_level);
+
+/**
+ * Describe rows @p row_offset through @p row_offset + @p count - 1 of the
+ * two-dimensional HDF5 dataset @p h5_path (of the form
+ * <tt>file_name:/dataset_path</tt>) as an XDMF hyperslab data item.
+ */
+std::string xdmf_hyperslab(const std::string& h5_path,
+                           hsize_t num_rows,
+                           hsize_t num_cols,
+                           hsize_t row_offset,
+                           hsize_t count,
+                           const std::string& number_type,
+                           int precision);
+
+/**
+ * Concatenate, in rank order, the strings of all MPI processes on MPI process
+ * zero. An empty string is returned on all other processes. This function is
+ * collective.
+ */
+std::string gather_strings_on_root(const std::string& local_str);
+} // namespace IBTK
+
+#endif
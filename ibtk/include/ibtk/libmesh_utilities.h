@@ -228,6 +228,38 @@ using TensorMeshFcnPtr =
              double data_time,
              void* ctx);
 
+/*!
+ * Batched version of TensorMeshFcnPtr that evaluates a tensor-valued function
+ * at all @p n_qp quadrature points of an element with a single call, so that
+ * the function can be vectorized across quadrature points.
+ *
+ * All arrays use a structure-of-arrays layout in which the values of one
+ * component at consecutive quadrature points are stored contiguously:
+ * <ul>
+ *   <li>@p F and @p FF have NDIM * NDIM * n_qp entries, and component (i, j) at
+ *   quadrature point qp is stored at index (i * NDIM + j) * n_qp + qp.</li>
+ *   <li>@p x and @p X have NDIM * n_qp entries, and component i is stored at
+ *   index i * n_qp + qp.</li>
+ *   <li><code>system_var_data[k]</code> stores the value of the vth variable
+ *   (in the order given by SystemData::vars) of the kth system at index v *
+ *   n_qp + qp.</li>
+ *   <li><code>system_grad_var_data[k]</code> stores component d of the
+ *   gradient of the vth variable (in the order given by SystemData::grad_vars)
+ *   of the kth system at index (v * NDIM + d) * n_qp + qp.</li>
+ * </ul>
+ * The output array @p F is zeroed before the function is called.
+ */
+using TensorMeshBatchFcnPtr = void (*)(double* F,
+                                       const double* FF,
+                                       const double* x,
+                                       const double* X,
+                                       unsigned int n_qp,
+                                       libMesh::Elem* elem,
+                                       const std::vector<const double*>& system_var_data,
+                                       const std::vector<const double*>& system_grad_var_data,
+                                       double data_time,
+                                       void* ctx);
+
 using ScalarSurfaceFcnPtr =
     void (*)(double& F,
              const libMesh::VectorValue<double>& n,
@@ -48,6 +48,32 @@ LDataManager::getDefaultSpreadKernelFunction() const
     return d_default_spread_kernel_fcn;
 } // getDefaultSpreadKernelFunction
 
+inline void
+LDataManager::setUseMortonOrdering(const bool use_morton_ordering)
+{
+    d_use_morton_ordering = use_morton_ordering;
+    return;
+} // setUseMortonOrdering
+
+inline bool
+LDataManager::getUseMortonOrdering() const
+{
+    return d_use_morton_ordering;
+} // getUseMortonOrdering
+
+inline void
+LDataManager::setLDataRestartDirectory(const std::string& restart_dirname)
+{
+    d_ldata_restart_dirname = restart_dirname;
+    return;
+} // setLDataRestartDirectory
+
+inline const std::string&
+LDataManager::getLDataRestartDirectory() const
+{
+    return d_ldata_restart_dirname;
+} // getLDataRestartDirectory
+
 inline bool
 LDataManager::levelContainsLagrangianData(const int level_number) const
 {
@@ -0,0 +1,42 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+dnl LSiloDataWriter can write plot files on a std::thread.  Determine the
+dnl compiler and linker flags needed to build programs that use std::thread.
+AC_DEFUN([CHECK_PTHREAD_FLAGS],[
+AC_MSG_CHECKING([for the flags needed to use std::thread])
+PTHREAD_FLAGS_SAVED_CXXFLAGS="$CXXFLAGS"
+PTHREAD_FLAGS_SAVED_LIBS="$LIBS"
+pthread_flags=unknown
+for pthread_flags_candidate in -pthread -lpthread none; do
+  case "$pthread_flags_candidate" in
+    -pthread)  CXXFLAGS="$PTHREAD_FLAGS_SAVED_CXXFLAGS -pthread" ; LIBS="-pthread $PTHREAD_FLAGS_SAVED_LIBS" ;;
+    -lpthread) CXXFLAGS="$PTHREAD_FLAGS_SAVED_CXXFLAGS" ; LIBS="-lpthread $PTHREAD_FLAGS_SAVED_LIBS" ;;
+    none)      CXXFLAGS="$PTHREAD_FLAGS_SAVED_CXXFLAGS" ; LIBS="$PTHREAD_FLAGS_SAVED_LIBS" ;;
+  esac
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([[#include <thread>]], [[
+  int x = 0;
+  std::thread t([&x]() { x = 1; });
+  t.join();
+  return x == 1 ? 0 : 1;
+]])],[pthread_flags="$pthread_flags_candidate"])
+  test "$pthread_flags" != unknown && break
+done
+if test "$pthread_flags" = unknown; then
+  CXXFLAGS="$PTHREAD_FLAGS_SAVED_CXXFLAGS"
+  LIBS="$PTHREAD_FLAGS_SAVED_LIBS"
+  AC_MSG_RESULT(not found)
+  AC_MSG_ERROR([could not determine how to compile and link programs that use std::thread])
+fi
+AC_MSG_RESULT($pthread_flags)
+])
@@ -0,0 +1,49 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+dnl The batched kernel weight loops in LEInteractor are annotated with
+dnl "omp simd" and only vectorize when the compiler honors that annotation and
+dnl is also allowed to if-convert floating point comparisons and to inline
+dnl sqrt() without an errno check.  These flags change floating point
+dnl semantics, so they are only used when explicitly requested and only for the
+dnl translation units that contain the interaction kernels (SIMD_CXXFLAGS, see
+dnl lib/Makefile.am).
+AC_DEFUN([CHECK_SIMD_FLAGS],[
+AC_ARG_ENABLE([simd-flags],
+  AS_HELP_STRING(--enable-simd-flags,compile the IBTK interaction kernels with -fopenmp-simd -fno-math-errno -fno-trapping-math when supported @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  SIMD_FLAGS_ENABLED=yes ;;
+                    no)   SIMD_FLAGS_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-simd-flags=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[SIMD_FLAGS_ENABLED=no])
+have_openmp_simd=0
+SIMD_CXXFLAGS=""
+if test "$SIMD_FLAGS_ENABLED" = yes; then
+  AC_MSG_CHECKING([whether compiler supports -fopenmp-simd -fno-math-errno -fno-trapping-math])
+  SIMD_FLAGS_SAVED_CXXFLAGS="$CXXFLAGS"
+  CXXFLAGS="$CXXFLAGS -fopenmp-simd -fno-math-errno -fno-trapping-math"
+  AC_COMPILE_IFELSE([AC_LANG_PROGRAM([[#include <cmath>]], [[
+  double x[8];
+  _Pragma("omp simd")
+  for (int i = 0; i < 8; ++i) x[i] = std::sqrt(static_cast<double>(i));
+  return x[7] > 0.0 ? 0 : 1;
+]])],[
+have_openmp_simd=1
+SIMD_CXXFLAGS="-fopenmp-simd -fno-math-errno -fno-trapping-math"
+AC_MSG_RESULT(yes)],[
+AC_MSG_RESULT(no)])
+  CXXFLAGS="$SIMD_FLAGS_SAVED_CXXFLAGS"
+fi
+AC_SUBST(SIMD_CXXFLAGS)
+AC_DEFINE_UNQUOTED(HAVE_OPENMP_SIMD,$have_openmp_simd,[Boolean value indicating whether the IBTK interaction kernels are compiled with flags that enable OpenMP simd directives and vectorization of math functions])
+])
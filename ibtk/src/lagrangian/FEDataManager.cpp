@@ -148,6 +148,7 @@ static Timer* t_spread;
 static Timer* t_prolong_data;
 static Timer* t_interp;
 static Timer* t_interp_weighted;
+static Timer* t_interp_weighted_and_spread;
 static Timer* t_restrict_data;
 static Timer* t_update_workload_estimates;
 static Timer* t_initialize_level_data;
@@ -588,6 +589,8 @@ FEDataManager::reinitElementMappings()
     d_active_elems.clear();
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
+    d_patch_quadrature_data.clear();
+    d_patch_quadrature_data_valid = false;
 
     // Reset the mappings between grid patches and active mesh
     // elements. collectActivePatchElements will populate d_active_elem_bboxes
@@ -855,7 +858,6 @@ FEDataManager::spread(const int f_data_idx,
     FEData::SystemDofMapCache& F_dof_map_cache = *getDofMapCache(system_name);
     System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
     const DofMap& X_dof_map = X_system.get_dof_map();
-    FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(COORDINATES_SYSTEM_NAME);
     FEType F_fe_type = F_dof_map.variable_type(0);
     Order F_order = F_dof_map.variable_order(0);
     for (unsigned i = 0; i < n_vars; ++i)
@@ -871,15 +873,7 @@ FEDataManager::spread(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_order(d) == X_order);
     }
 
-    // convenience alias for the quadrature key type used by FECache and FEMappingCache
-    using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
     FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-
-    // We have to support both volumetric and surface meshes based on runtime data
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
-    const bool is_volume_mesh = dim == NDIM;
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = spread_spec.use_nodal_quadrature;
@@ -995,107 +989,33 @@ FEDataManager::spread(const int f_data_idx,
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
+        // Determining which quadrature rule should be used on which processor
+        // and where the quadrature points are is surprisingly expensive, so
+        // this data is computed once for all patches (and possibly cached):
+        const std::vector<PatchQuadratureData>& patch_quad_data =
+            getPatchQuadratureData(*X_petsc_vec,
+                                   X_local_soln,
+                                   spread_spec.quad_type,
+                                   spread_spec.quad_order,
+                                   spread_spec.use_adaptive_quadrature,
+                                   spread_spec.point_density);
+
         // Loop over the patches to interpolate nodal values on the FE mesh to
         // the element quadrature points, then spread those values onto the
         // Eulerian grid.
-        boost::multi_array<double, 2> F_node;
-        std::vector<double> F_JxW_qp, X_qp;
         int local_patch_num = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
-            // The relevant collection of elements.
-            const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
-            const size_t num_active_patch_elems = patch_elems.size();
-            if (!num_active_patch_elems) continue;
-
-            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
-            const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
-
-            // Determining which quadrature rule should be used on which
-            // processor is surprisingly expensive, so cache the keys:
-            std::vector<quad_key_type> quad_keys(num_active_patch_elems);
-
-            // Cache interpolated positions too:
-            std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
-
-            // Setup vectors to store the values of F_JxW and X at the
-            // quadrature points.
-            unsigned int n_qp_patch = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                const quad_key_type key = getQuadratureKey(spread_spec.quad_type,
-                                                           spread_spec.quad_order,
-                                                           spread_spec.use_adaptive_quadrature,
-                                                           spread_spec.point_density,
-                                                           elem,
-                                                           X_nodes[e_idx],
-                                                           patch_dx_min);
-                quad_keys[e_idx] = key;
-                QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                n_qp_patch += qrule.n_points();
-            }
-            if (!n_qp_patch) continue;
-            F_JxW_qp.resize(n_vars * n_qp_patch);
-            X_qp.resize(NDIM * n_qp_patch);
-
-            // Loop over the elements and compute the values to be spread and
-            // the positions of the quadrature points.
-            int qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-                const quad_key_type& key = quad_keys[e_idx];
-                const FEBase& X_fe = X_fe_cache(key, elem);
-                const FEBase& F_fe = F_fe_cache(key, elem);
-                const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-
-                // JxW depends on the element
-                const std::vector<double>& JxW_F =
-                    get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-                const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                const unsigned int n_qp = qrule.n_points();
-                TBOX_ASSERT(n_qp == phi_F[0].size());
-                TBOX_ASSERT(n_qp == phi_X[0].size());
-                TBOX_ASSERT(n_qp == JxW_F.size());
-                double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-                double* X_begin = &X_qp[NDIM * qp_offset];
-                std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-                std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-
-                sum_weighted_elem_solution</*weights_are_unity*/ false>(
-                    n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
-                sum_weighted_elem_solution</*weights_are_unity*/ true>(
-                    NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                qp_offset += n_qp;
-            }
-
-            zeroExteriorValues(*patch_geom, X_qp, F_JxW_qp, n_vars);
-
-            // Spread values from the quadrature points to the Cartesian grid
-            // patch.
-            const Box<NDIM> spread_box = patch->getBox();
-            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-            if (cc_data)
-            {
-                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::spread(
-                    f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
-            }
-            if (sc_data)
-            {
-                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::spread(
-                    f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
-            }
+            spreadOnPatch(f_data_idx,
+                          level->getPatch(p()),
+                          d_active_patch_elem_map[local_patch_num],
+                          patch_quad_data[local_patch_num],
+                          *F_petsc_vec,
+                          F_local_soln,
+                          F_dof_map_cache,
+                          F_fe_cache,
+                          n_vars,
+                          spread_spec.kernel_fcn);
         }
 
         // Restore local form vectors.
@@ -1584,7 +1504,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
     FEData::SystemDofMapCache& F_dof_map_cache = *getDofMapCache(system_name);
     System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
     const DofMap& X_dof_map = X_system.get_dof_map();
-    FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(COORDINATES_SYSTEM_NAME);
     FEType F_fe_type = F_dof_map.variable_type(0);
     Order F_order = F_dof_map.variable_order(0);
     for (unsigned i = 0; i < n_vars; ++i)
@@ -1600,13 +1519,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_order(d) == X_order);
     }
 
-    // convenience alias for the quadrature key type used by FECache and FEMappingCache
-    using quad_key_type = std::tuple<libMesh::ElemType, libMesh::QuadratureType, libMesh::Order>;
     FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
-    const bool is_volume_mesh = dim == NDIM;
 
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
@@ -1764,158 +1677,34 @@ FEDataManager::interpWeighted(const int f_data_idx,
     }
     else
     {
+        // Determining which quadrature rule should be used on which processor
+        // and where the quadrature points are is surprisingly expensive, so
+        // this data is computed once for all patches (and possibly cached):
+        const std::vector<PatchQuadratureData>& patch_quad_data =
+            getPatchQuadratureData(*X_petsc_vec,
+                                   X_local_soln,
+                                   interp_spec.quad_type,
+                                   interp_spec.quad_order,
+                                   interp_spec.use_adaptive_quadrature,
+                                   interp_spec.point_density);
+
         // Loop over the patches to interpolate values to the element quadrature
         // points from the grid, then use these values to compute the projection
         // of the interpolated velocity field onto the FE basis functions.
-        DenseVector<double> F_rhs;
-        // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
-        std::vector<double> F_rhs_concatenated;
-        std::vector<double> F_qp, X_qp;
         int local_patch_num = 0;
-        std::vector<libMesh::dof_id_type> dof_id_scratch;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
-            // The relevant collection of elements.
-            const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
-            const size_t num_active_patch_elems = patch_elems.size();
-            if (!num_active_patch_elems) continue;
-
-            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
-            const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
-
-            // Determining which quadrature rule should be used on which
-            // processor is surprisingly expensive, so cache the keys:
-            std::vector<quad_key_type> quad_keys(num_active_patch_elems);
-
-            // Cache interpolated positions too:
-            std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
-
-            // Setup vectors to store the values of F and X at the quadrature
-            // points.
-            unsigned int n_qp_patch = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                const quad_key_type key = getQuadratureKey(interp_spec.quad_type,
-                                                           interp_spec.quad_order,
-                                                           interp_spec.use_adaptive_quadrature,
-                                                           interp_spec.point_density,
-                                                           elem,
-                                                           X_nodes[e_idx],
-                                                           patch_dx_min);
-                QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                n_qp_patch += qrule.n_points();
-                quad_keys[e_idx] = key;
-            }
-            if (!n_qp_patch) continue;
-            F_qp.resize(n_vars * n_qp_patch);
-            X_qp.resize(NDIM * n_qp_patch);
-            std::fill(F_qp.begin(), F_qp.end(), 0.0);
-
-            // Loop over the elements and compute the positions of the
-            // quadrature points.
-            int qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                TBOX_ASSERT(elem->active());
-                const quad_key_type& key = quad_keys[e_idx];
-                const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                const FEBase& X_fe = X_fe_cache(key, elem);
-                const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                const unsigned int n_node = elem->n_nodes();
-                const unsigned int n_qp = qrule.n_points();
-                TBOX_ASSERT(n_qp == phi_X[0].size());
-                double* X_begin = &X_qp[NDIM * qp_offset];
-                std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-                sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                qp_offset += n_qp;
-            }
-
-            // Interpolate values from the Cartesian grid patch to the
-            // quadrature points.
-            //
-            // NOTE: Values are interpolated only to those quadrature points
-            // that are within the patch interior.
-            const Box<NDIM>& interp_box = patch->getBox();
-            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-            if (cc_data)
-            {
-                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::interpolate(
-                    F_qp, n_vars, X_qp, NDIM, f_cc_data, patch, interp_box, interp_spec.kernel_fcn);
-            }
-            if (sc_data)
-            {
-                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::interpolate(
-                    F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
-            }
-
-            // Loop over the elements and accumulate the right-hand-side values.
-            qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                // check the concatenation assumption
-#ifndef NDEBUG
-                for (unsigned int i = 0; i < n_vars; ++i)
-                {
-                    TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
-                }
-#endif
-                F_rhs_concatenated.resize(n_vars * F_dof_indices[0].size());
-                std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
-                const quad_key_type& key = quad_keys[e_idx];
-                const FEBase& F_fe = F_fe_cache(key, elem);
-                const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-
-                // JxW depends on the element
-                const std::vector<double>& JxW_F =
-                    get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-
-                const unsigned int n_qp = qrule.n_points();
-                TBOX_ASSERT(n_qp == phi_F[0].size());
-                TBOX_ASSERT(n_qp == JxW_F.size());
-                const size_t n_basis = F_dof_indices[0].size();
-                integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
-
-                for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
-                {
-                    F_rhs.resize(F_dof_indices[var_n].size());
-                    std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
-                              F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
-                              F_rhs.get_values().begin());
-
-                    // We do *not* apply constraints here. See the note in the
-                    // documentation of this function for an explanation.
-                    if (is_ghosted)
-                    {
-                        for (unsigned int i = 0; i < F_dof_indices[var_n].size(); ++i)
-                        {
-                            const PetscInt index = F_petsc_vec->map_global_to_local_index(F_dof_indices[var_n][i]);
-#ifndef NDEBUG
-                            TBOX_ASSERT(0 <= index);
-                            TBOX_ASSERT(index < F_local_size);
-#endif
-                            F_local_soln[index] += F_rhs(i);
-                        }
-                    }
-                    else
-                    {
-                        copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-                        F_vec.add_vector(F_rhs, dof_id_scratch);
-                    }
-                }
-                qp_offset += n_qp;
-            }
+            interpWeightedOnPatch(f_data_idx,
+                                  level->getPatch(p()),
+                                  d_active_patch_elem_map[local_patch_num],
+                                  patch_quad_data[local_patch_num],
+                                  F_vec,
+                                  F_local_soln,
+                                  F_local_size,
+                                  F_dof_map_cache,
+                                  F_fe_cache,
+                                  n_vars,
+                                  interp_spec.kernel_fcn);
         }
     }
 
@@ -1944,6 +1733,171 @@ FEDataManager::interpWeighted(const int f_data_idx,
     return;
 } // interpWeighted
 
+void
+FEDataManager::interpWeightedAndSpread(const int u_data_idx,
+                                       NumericVector<double>& U_rhs_vec,
+                                       const std::string& interp_system_name,
+                                       const FEDataManager::InterpSpec& interp_spec,
+                                       const int f_data_idx,
+                                       NumericVector<double>& F_vec,
+                                       const std::string& spread_system_name,
+                                       const FEDataManager::SpreadSpec& spread_spec,
+                                       NumericVector<double>& X_vec)
+{
+    TBOX_ASSERT(u_data_idx != f_data_idx);
+
+    // The two operations can only share quadrature points if they use the
+    // same (non-nodal) quadrature rules.
+    const bool can_share_quadrature_points =
+        !interp_spec.use_nodal_quadrature && !spread_spec.use_nodal_quadrature &&
+        interp_spec.quad_type == spread_spec.quad_type && interp_spec.quad_order == spread_spec.quad_order &&
+        interp_spec.use_adaptive_quadrature == spread_spec.use_adaptive_quadrature &&
+        interp_spec.point_density == spread_spec.point_density;
+    if (!can_share_quadrature_points)
+    {
+        interpWeighted(u_data_idx,
+                       U_rhs_vec,
+                       X_vec,
+                       interp_system_name,
+                       interp_spec,
+                       std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                       0.0,
+                       /*close_F*/ false,
+                       /*close_X*/ false);
+        spread(f_data_idx, F_vec, X_vec, spread_system_name, spread_spec);
+        return;
+    }
+
+    IBTK_TIMER_START(t_interp_weighted_and_spread);
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+
+    // Check the type of data centering.
+    Pointer<hier::Variable<NDIM> > u_var, f_var;
+    var_db->mapIndexToVariable(u_data_idx, u_var);
+    var_db->mapIndexToVariable(f_data_idx, f_var);
+    TBOX_ASSERT(Pointer<CellVariable<NDIM, double> >(u_var) || Pointer<SideVariable<NDIM, double> >(u_var));
+    TBOX_ASSERT(Pointer<CellVariable<NDIM, double> >(f_var) || Pointer<SideVariable<NDIM, double> >(f_var));
+
+    // We interpolate from and spread to the finest level of the patch
+    // hierarchy.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_fe_data->d_level_number);
+
+    // Extract the mesh.
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    const unsigned int dim = mesh.mesh_dimension();
+
+    // Extract the FE systems and DOF maps, and setup the FECache objects.
+    System& U_system = d_fe_data->d_es->get_system(interp_system_name);
+    const unsigned int n_U_vars = U_system.n_vars();
+    const DofMap& U_dof_map = U_system.get_dof_map();
+    FEData::SystemDofMapCache& U_dof_map_cache = *getDofMapCache(interp_system_name);
+    System& F_system = d_fe_data->d_es->get_system(spread_system_name);
+    const unsigned int n_F_vars = F_system.n_vars();
+    const DofMap& F_dof_map = F_system.get_dof_map();
+    FEData::SystemDofMapCache& F_dof_map_cache = *getDofMapCache(spread_system_name);
+    FEType U_fe_type = U_dof_map.variable_type(0);
+    for (unsigned i = 0; i < n_U_vars; ++i)
+    {
+        TBOX_ASSERT(U_dof_map.variable_type(i) == U_fe_type);
+    }
+    FEType F_fe_type = F_dof_map.variable_type(0);
+    for (unsigned i = 0; i < n_F_vars; ++i)
+    {
+        TBOX_ASSERT(F_dof_map.variable_type(i) == F_fe_type);
+    }
+
+    // This will break, at some point in the future, if we ever use
+    // nonnodal-interpolating finite elements. TODO: more finite elements
+    // will probably work.
+    std::vector<FEFamily> fe_family_whitelist{ LAGRANGE, L2_LAGRANGE };
+    TBOX_ASSERT(std::find(fe_family_whitelist.begin(), fe_family_whitelist.end(), U_fe_type.family) !=
+                fe_family_whitelist.end());
+    TBOX_ASSERT(std::find(fe_family_whitelist.begin(), fe_family_whitelist.end(), F_fe_type.family) !=
+                fe_family_whitelist.end());
+
+    FECache U_fe_cache(dim, U_fe_type, FEUpdateFlags::update_phi);
+    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
+
+    // Extract local form vectors.
+    auto X_petsc_vec = dynamic_cast<PetscVector<double>*>(&X_vec);
+    TBOX_ASSERT(X_petsc_vec != nullptr);
+    const double* const X_local_soln = X_petsc_vec->get_array_read();
+    auto F_petsc_vec = dynamic_cast<PetscVector<double>*>(&F_vec);
+    TBOX_ASSERT(F_petsc_vec != nullptr);
+    const double* const F_local_soln = F_petsc_vec->get_array_read();
+    // As in interpWeighted(), assemble directly into the ghost values of U_rhs
+    // when possible.
+    U_rhs_vec.zero();
+    auto U_rhs_petsc_vec = dynamic_cast<PetscVector<double>*>(&U_rhs_vec);
+    Vec U_rhs_local_form = nullptr;
+    double* U_rhs_local_soln = nullptr;
+    PetscInt U_rhs_local_size = -1;
+    const bool is_ghosted = U_rhs_vec.type() == GHOSTED;
+    if (is_ghosted)
+    {
+        TBOX_ASSERT(U_rhs_petsc_vec != nullptr);
+        int ierr = VecGhostGetLocalForm(U_rhs_petsc_vec->vec(), &U_rhs_local_form);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetArray(U_rhs_local_form, &U_rhs_local_soln);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetSize(U_rhs_local_form, &U_rhs_local_size);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // The quadrature points are computed once and used for both operations.
+    const std::vector<PatchQuadratureData>& patch_quad_data =
+        getPatchQuadratureData(*X_petsc_vec,
+                               X_local_soln,
+                               interp_spec.quad_type,
+                               interp_spec.quad_order,
+                               interp_spec.use_adaptive_quadrature,
+                               interp_spec.point_density);
+
+    // Interpolate and spread patch by patch, so that the quadrature data of
+    // each patch are used by both operations while they are in cache.
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        interpWeightedOnPatch(u_data_idx,
+                              patch,
+                              d_active_patch_elem_map[local_patch_num],
+                              patch_quad_data[local_patch_num],
+                              U_rhs_vec,
+                              U_rhs_local_soln,
+                              U_rhs_local_size,
+                              U_dof_map_cache,
+                              U_fe_cache,
+                              n_U_vars,
+                              interp_spec.kernel_fcn);
+        spreadOnPatch(f_data_idx,
+                      patch,
+                      d_active_patch_elem_map[local_patch_num],
+                      patch_quad_data[local_patch_num],
+                      *F_petsc_vec,
+                      F_local_soln,
+                      F_dof_map_cache,
+                      F_fe_cache,
+                      n_F_vars,
+                      spread_spec.kernel_fcn);
+    }
+
+    // Restore local form vectors.
+    X_petsc_vec->restore_array();
+    F_petsc_vec->restore_array();
+    if (is_ghosted)
+    {
+        int ierr = VecRestoreArray(U_rhs_local_form, &U_rhs_local_soln);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostRestoreLocalForm(U_rhs_petsc_vec->vec(), &U_rhs_local_form);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    IBTK_TIMER_STOP(t_interp_weighted_and_spread);
+    return;
+} // interpWeightedAndSpread
+
 void
 FEDataManager::interp(const int f_data_idx,
                       NumericVector<double>& F_vec,
@@ -2645,6 +2599,8 @@ FEDataManager::FEDataManager(std::shared_ptr<FEData> fe_data,
         t_spread = TimerManager::getManager()->getTimer("IBTK::FEDataManager::spread()");
         t_prolong_data = TimerManager::getManager()->getTimer("IBTK::FEDataManager::prolongData()");
         t_interp_weighted = TimerManager::getManager()->getTimer("IBTK::FEDataManager::interpWeighted()");
+        t_interp_weighted_and_spread =
+            TimerManager::getManager()->getTimer("IBTK::FEDataManager::interpWeightedAndSpread()");
         t_interp = TimerManager::getManager()->getTimer("IBTK::FEDataManager::interp()");
         t_restrict_data = TimerManager::getManager()->getTimer("IBTK::FEDataManager::restrictData()");
         t_update_workload_estimates =
@@ -2698,6 +2654,24 @@ FEDataManager::getLoggingEnabled() const
     return d_enable_logging;
 } // getLoggingEnabled
 
+void
+FEDataManager::setQuadratureDataCachingEnabled(bool enable_caching)
+{
+    d_cache_quadrature_data = enable_caching;
+    if (!d_cache_quadrature_data)
+    {
+        d_patch_quadrature_data.clear();
+        d_patch_quadrature_data_valid = false;
+    }
+    return;
+} // setQuadratureDataCachingEnabled
+
+bool
+FEDataManager::getQuadratureDataCachingEnabled() const
+{
+    return d_cache_quadrature_data;
+} // getQuadratureDataCachingEnabled
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -3097,6 +3071,263 @@ FEDataManager::reinitializeIBGhostedDOFs(const std::string& system_name)
     }
 }
 
+const std::vector<FEDataManager::PatchQuadratureData>&
+FEDataManager::getPatchQuadratureData(PetscVector<double>& X_vec,
+                                      const double* const X_local_soln,
+                                      const QuadratureType quad_type,
+                                      const Order quad_order,
+                                      const bool use_adaptive_quadrature,
+                                      const double point_density)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_fe_data->d_level_number);
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    const unsigned int dim = mesh.mesh_dimension();
+    System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
+    const DofMap& X_dof_map = X_system.get_dof_map();
+    FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(COORDINATES_SYSTEM_NAME);
+    const FEType X_fe_type = X_dof_map.variable_type(0);
+    const std::size_t num_local_patches = d_active_patch_elem_map.size();
+
+    // The cached data may be reused only if the quadrature parameters are
+    // unchanged and the nodal positions of all of the active patch elements
+    // are identical to the ones used to compute the data.
+    boost::multi_array<double, 2> X_node;
+    bool reuse_data = d_cache_quadrature_data && d_patch_quadrature_data_valid &&
+                      d_patch_quadrature_data.size() == num_local_patches &&
+                      d_patch_quadrature_data_quad_type == quad_type &&
+                      d_patch_quadrature_data_quad_order == quad_order &&
+                      d_patch_quadrature_data_use_adaptive_quadrature == use_adaptive_quadrature &&
+                      d_patch_quadrature_data_point_density == point_density;
+    d_patch_quadrature_data.resize(num_local_patches);
+    if (d_cache_quadrature_data)
+    {
+        std::vector<double> X_node_patch;
+        for (std::size_t local_patch_num = 0; local_patch_num < num_local_patches; ++local_patch_num)
+        {
+            X_node_patch.clear();
+            for (const Elem* const elem : d_active_patch_elem_map[local_patch_num])
+            {
+                const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
+                get_values_for_interpolation(X_node, X_vec, X_local_soln, X_dof_indices);
+                X_node_patch.insert(X_node_patch.end(), X_node.data(), X_node.data() + X_node.num_elements());
+            }
+            PatchQuadratureData& patch_data = d_patch_quadrature_data[local_patch_num];
+            reuse_data = reuse_data && X_node_patch == patch_data.X_node;
+            patch_data.X_node.swap(X_node_patch);
+        }
+    }
+    if (reuse_data) return d_patch_quadrature_data;
+
+    // Otherwise compute the quadrature data from scratch.
+    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
+    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
+    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
+    const bool is_volume_mesh = dim == NDIM;
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
+        const size_t num_active_patch_elems = patch_elems.size();
+        PatchQuadratureData& patch_data = d_patch_quadrature_data[local_patch_num];
+        patch_data.quad_keys.resize(num_active_patch_elems);
+        patch_data.JxW.resize(num_active_patch_elems);
+        patch_data.X_qp.clear();
+        if (!num_active_patch_elems) continue;
+
+        const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const patch_dx = patch_geom->getDx();
+        const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
+
+        int qp_offset = 0;
+        for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+        {
+            Elem* const elem = patch_elems[e_idx];
+            TBOX_ASSERT(elem->active());
+            const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
+            get_values_for_interpolation(X_node, X_vec, X_local_soln, X_dof_indices);
+            const auto key = getQuadratureKey(
+                quad_type, quad_order, use_adaptive_quadrature, point_density, elem, X_node, patch_dx_min);
+            patch_data.quad_keys[e_idx] = key;
+            const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+            const FEBase& X_fe = X_fe_cache(key, elem);
+            const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+
+            // Compute the positions of the quadrature points.
+            const unsigned int n_qp = qrule.n_points();
+            TBOX_ASSERT(n_qp == phi_X[0].size());
+            patch_data.X_qp.resize(NDIM * (qp_offset + n_qp), 0.0);
+            sum_weighted_elem_solution<true>(NDIM, phi_X.size(), qp_offset, phi_X, {}, X_node, patch_data.X_qp);
+
+            // JxW depends on the element
+            patch_data.JxW[e_idx] = get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+            TBOX_ASSERT(n_qp == patch_data.JxW[e_idx].size());
+            qp_offset += n_qp;
+        }
+    }
+
+    d_patch_quadrature_data_valid = d_cache_quadrature_data;
+    d_patch_quadrature_data_quad_type = quad_type;
+    d_patch_quadrature_data_quad_order = quad_order;
+    d_patch_quadrature_data_use_adaptive_quadrature = use_adaptive_quadrature;
+    d_patch_quadrature_data_point_density = point_density;
+    return d_patch_quadrature_data;
+} // getPatchQuadratureData
+
+void
+FEDataManager::interpWeightedOnPatch(const int f_data_idx,
+                                     const Pointer<Patch<NDIM> >& patch,
+                                     const std::vector<Elem*>& patch_elems,
+                                     const PatchQuadratureData& patch_quad_data,
+                                     NumericVector<double>& F_vec,
+                                     double* const F_local_soln,
+                                     const PetscInt F_local_size,
+                                     FEData::SystemDofMapCache& F_dof_map_cache,
+                                     FECache& F_fe_cache,
+                                     const unsigned int n_vars,
+                                     const std::string& kernel_fcn)
+{
+    NULL_USE(F_local_size);
+    const size_t num_active_patch_elems = patch_elems.size();
+    const std::vector<double>& X_qp = patch_quad_data.X_qp;
+    const unsigned int n_qp_patch = X_qp.size() / NDIM;
+    if (!num_active_patch_elems || !n_qp_patch) return;
+
+    // Interpolate values from the Cartesian grid patch to the quadrature
+    // points.
+    //
+    // NOTE: Values are interpolated only to those quadrature points that are
+    // within the patch interior.
+    std::vector<double> F_qp(n_vars * n_qp_patch, 0.0);
+    const Box<NDIM>& interp_box = patch->getBox();
+    Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
+    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+    if (f_cc_data) LEInteractor::interpolate(F_qp, n_vars, X_qp, NDIM, f_cc_data, patch, interp_box, kernel_fcn);
+    if (f_sc_data) LEInteractor::interpolate(F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, kernel_fcn);
+
+    // Loop over the elements and accumulate the right-hand-side values. The
+    // right-hand side vectors of the element are assembled in an interleaved
+    // format (see the implementation of integrate_elem_rhs).
+    auto F_petsc_vec = dynamic_cast<PetscVector<double>*>(&F_vec);
+    DenseVector<double> F_rhs;
+    std::vector<double> F_rhs_concatenated;
+    std::vector<libMesh::dof_id_type> dof_id_scratch;
+    int qp_offset = 0;
+    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+    {
+        Elem* const elem = patch_elems[e_idx];
+        const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+        // check the concatenation assumption
+#ifndef NDEBUG
+        for (unsigned int i = 0; i < n_vars; ++i)
+        {
+            TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
+        }
+#endif
+        const size_t n_basis = F_dof_indices[0].size();
+        F_rhs_concatenated.resize(n_vars * n_basis);
+        std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
+        const auto& key = patch_quad_data.quad_keys[e_idx];
+        const FEBase& F_fe = F_fe_cache(key, elem);
+        const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+
+        // JxW depends on the element
+        const std::vector<double>& JxW_F = patch_quad_data.JxW[e_idx];
+        const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+
+        const unsigned int n_qp = qrule.n_points();
+        TBOX_ASSERT(n_qp == phi_F[0].size());
+        TBOX_ASSERT(n_qp == JxW_F.size());
+        integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
+
+        for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
+        {
+            F_rhs.resize(F_dof_indices[var_n].size());
+            std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
+                      F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
+                      F_rhs.get_values().begin());
+
+            // We do *not* apply constraints here. See the note in the
+            // documentation of interpWeighted() for an explanation.
+            if (F_local_soln)
+            {
+                for (unsigned int i = 0; i < F_dof_indices[var_n].size(); ++i)
+                {
+                    const PetscInt index = F_petsc_vec->map_global_to_local_index(F_dof_indices[var_n][i]);
+#ifndef NDEBUG
+                    TBOX_ASSERT(0 <= index);
+                    TBOX_ASSERT(index < F_local_size);
+#endif
+                    F_local_soln[index] += F_rhs(i);
+                }
+            }
+            else
+            {
+                copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
+                F_vec.add_vector(F_rhs, dof_id_scratch);
+            }
+        }
+        qp_offset += n_qp;
+    }
+    return;
+} // interpWeightedOnPatch
+
+void
+FEDataManager::spreadOnPatch(const int f_data_idx,
+                             const Pointer<Patch<NDIM> >& patch,
+                             const std::vector<Elem*>& patch_elems,
+                             const PatchQuadratureData& patch_quad_data,
+                             PetscVector<double>& F_vec,
+                             const double* const F_local_soln,
+                             FEData::SystemDofMapCache& F_dof_map_cache,
+                             FECache& F_fe_cache,
+                             const unsigned int n_vars,
+                             const std::string& kernel_fcn)
+{
+    const size_t num_active_patch_elems = patch_elems.size();
+    const std::vector<double>& X_qp = patch_quad_data.X_qp;
+    const unsigned int n_qp_patch = X_qp.size() / NDIM;
+    if (!num_active_patch_elems || !n_qp_patch) return;
+
+    // Loop over the elements and compute the values to be spread.
+    boost::multi_array<double, 2> F_node;
+    std::vector<double> F_JxW_qp(n_vars * n_qp_patch, 0.0);
+    int qp_offset = 0;
+    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+    {
+        Elem* const elem = patch_elems[e_idx];
+        const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+        get_values_for_interpolation(F_node, F_vec, F_local_soln, F_dof_indices);
+        const auto& key = patch_quad_data.quad_keys[e_idx];
+        const FEBase& F_fe = F_fe_cache(key, elem);
+        const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+
+        // JxW depends on the element
+        const std::vector<double>& JxW_F = patch_quad_data.JxW[e_idx];
+        const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+
+        const unsigned int n_qp = qrule.n_points();
+        TBOX_ASSERT(n_qp == phi_F[0].size());
+        TBOX_ASSERT(n_qp == JxW_F.size());
+        sum_weighted_elem_solution</*weights_are_unity*/ false>(
+            n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
+        qp_offset += n_qp;
+    }
+
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    zeroExteriorValues(*patch_geom, X_qp, F_JxW_qp, n_vars);
+
+    // Spread values from the quadrature points to the Cartesian grid patch.
+    const Box<NDIM> spread_box = patch->getBox();
+    Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
+    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+    if (f_cc_data) LEInteractor::spread(f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, kernel_fcn);
+    if (f_sc_data) LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, kernel_fcn);
+    return;
+} // spreadOnPatch
+
 void
 FEDataManager::getFromRestart()
 {
@@ -118,9 +118,9 @@ LData::LData(Pointer<Database> db) : d_name(db->getString("d_name")), d_depth(db
     d_local_node_count = num_local_nodes;
     d_ghost_node_count = static_cast<int>(d_nonlocal_petsc_indices.size());
 
-    // Extract the values from the database.
+    // Extract the values from the database, if they were stored there.
     double* ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
-    if (num_local_nodes + num_ghost_nodes > 0)
+    if (num_local_nodes + num_ghost_nodes > 0 && db->keyExists("vals"))
     {
         db->getDoubleArray("vals", ghosted_local_vec_array, d_depth * (num_local_nodes + num_ghost_nodes));
     }
@@ -184,6 +184,13 @@ LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const
 
 void
 LData::putToDatabase(Pointer<Database> db)
+{
+    putToDatabase(db, true);
+    return;
+} // putToDatabase
+
+void
+LData::putToDatabase(Pointer<Database> db, const bool put_values)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(db);
@@ -198,6 +205,7 @@ LData::putToDatabase(Pointer<Database> db)
     {
         db->putIntegerArray("d_nonlocal_petsc_indices", &d_nonlocal_petsc_indices[0], num_ghost_nodes);
     }
+    if (!put_values) return;
     const double* const ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
     if (num_local_nodes + num_ghost_nodes > 0)
     {
@@ -102,14 +102,18 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <mpi.h>
+
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <limits>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -157,6 +161,16 @@ static const double TOL = std::sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// Get the message that describes an MPI error code.
+std::string
+mpi_error_string(const int error_code)
+{
+    char error_string[MPI_MAX_ERROR_STRING];
+    int error_string_length = 0;
+    MPI_Error_string(error_code, error_string, &error_string_length);
+    return std::string(error_string, error_string_length);
+} // mpi_error_string
 } // namespace
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -972,6 +986,31 @@ LDataManager::computeLagrangianStructureBoundingBox(const int structure_id, cons
     return std::make_pair(X_lower, X_upper);
 } // computeLagrangianStructureBoundingBox
 
+void
+LDataManager::computeLagrangianNodeBoxes(BoxList<NDIM>& node_boxes, const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    node_boxes.clearItems();
+    if (!levelContainsLagrangianData(level_number)) return;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        Box<NDIM> node_box;
+        for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+        {
+            const hier::Index<NDIM>& i = it.getIndex();
+            if (patch_box.contains(i)) node_box += Box<NDIM>(i, i);
+        }
+        if (!node_box.empty()) node_boxes.appendItem(node_box);
+    }
+    return;
+} // computeLagrangianNodeBoxes
+
 void
 LDataManager::reinitLagrangianStructure(const Point& X_center, const int structure_id, const int level_number)
 {
@@ -1854,7 +1893,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_use_morton_ordering);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -2246,7 +2285,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_use_morton_ordering);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2489,6 +2528,23 @@ LDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_finest_ln", d_finest_ln);
     db->putDouble("d_beta_work", d_beta_work);
 
+    // When requested, the values of the Lagrangian data are written to
+    // separate binary files instead of to the restart database.
+    const bool use_ldata_restart_files = !d_ldata_restart_dirname.empty();
+    std::string ldata_restart_file_prefix;
+    if (use_ldata_restart_files)
+    {
+        Utilities::recursiveMkdir(d_ldata_restart_dirname);
+        std::string file_object_name = d_object_name;
+        std::replace(file_object_name.begin(), file_object_name.end(), ':', '_');
+        std::ostringstream file_name_prefix;
+        file_name_prefix << d_ldata_restart_dirname << "/" << file_object_name << ".restart_" << std::setw(6)
+                         << std::setfill('0') << std::right << d_ldata_restart_dump_count;
+        ldata_restart_file_prefix = file_name_prefix.str();
+        ++d_ldata_restart_dump_count;
+    }
+    db->putInteger("d_ldata_restart_dump_count", d_ldata_restart_dump_count);
+
     // Write out data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
     {
@@ -2528,11 +2584,17 @@ LDataManager::putToDatabase(Pointer<Database> db)
         }
 
         std::vector<std::string> ldata_names;
+        const std::string level_file_prefix = ldata_restart_file_prefix + "." + level_db_name + ".";
         for (const auto& mesh_data : d_lag_mesh_data[level_number])
         {
             ldata_names.push_back(mesh_data.first);
-            mesh_data.second->putToDatabase(level_db->putDatabase(ldata_names.back()));
+            mesh_data.second->putToDatabase(level_db->putDatabase(ldata_names.back()), !use_ldata_restart_files);
+            if (use_ldata_restart_files)
+            {
+                writeLDataRestartFile(level_file_prefix + mesh_data.first, mesh_data.second, level_number);
+            }
         }
+        if (use_ldata_restart_files) level_db->putString("ldata_restart_file_prefix", level_file_prefix);
         level_db->putInteger("n_ldata_names", static_cast<int>(ldata_names.size()));
         if (!ldata_names.empty())
         {
@@ -3071,6 +3133,10 @@ LDataManager::getFromRestart()
     d_coarsest_ln = db->getInteger("d_coarsest_ln");
     d_finest_ln = db->getInteger("d_finest_ln");
     d_beta_work = db->getDouble("d_beta_work");
+    if (db->keyExists("d_ldata_restart_dump_count"))
+    {
+        d_ldata_restart_dump_count = db->getInteger("d_ldata_restart_dump_count");
+    }
 
     // Resize some arrays.
     d_level_contains_lag_data.resize(d_finest_ln + 1, false);
@@ -3202,10 +3268,181 @@ LDataManager::getFromRestart()
                                n_local_lag_indices > 0 ? &d_local_petsc_indices[level_number][0] : nullptr,
                                &d_ao[level_number]);
         IBTK_CHKERRQ(ierr);
+
+        // Read the values of the Lagrangian data from separate binary files,
+        // if they were not stored in the restart database.
+        if (level_db->keyExists("ldata_restart_file_prefix"))
+        {
+            const std::string level_file_prefix = level_db->getString("ldata_restart_file_prefix");
+            for (const auto& ldata_name : ldata_names)
+            {
+                readLDataRestartFile(
+                    level_file_prefix + ldata_name, d_lag_mesh_data[level_number][ldata_name], level_number);
+            }
+        }
     }
     return;
 } // getFromRestart
 
+void
+LDataManager::writeLDataRestartFile(const std::string& file_name, Pointer<LData> ldata, const int level_number) const
+{
+    int ierr;
+    const int depth = static_cast<int>(ldata->getDepth());
+    const int num_local_nodes = static_cast<int>(ldata->getLocalNodeCount());
+
+    // Permute the data into the fixed Lagrangian ordering, so that each
+    // process owns the contiguous range of nodes that begins at its node
+    // offset.
+    Vec lag_vec;
+    ierr = VecCreate(PETSC_COMM_WORLD, &lag_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetSizes(lag_vec, depth * num_local_nodes, PETSC_DETERMINE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetBlockSize(lag_vec, depth);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetType(lag_vec, VECMPI);
+    IBTK_CHKERRQ(ierr);
+    Vec petsc_vec = ldata->getVec();
+    scatterPETScToLagrangian(petsc_vec, lag_vec, level_number);
+
+    int ilo, ihi;
+    ierr = VecGetOwnershipRange(lag_vec, &ilo, &ihi);
+    IBTK_CHKERRQ(ierr);
+    const double* lag_vals;
+    ierr = VecGetArrayRead(lag_vec, &lag_vals);
+    IBTK_CHKERRQ(ierr);
+
+    // Write the data collectively into a single shared file. MPI-IO returns
+    // error codes rather than aborting by default, so every call is checked.
+    MPI_File fh;
+    int mpi_ierr = MPI_File_open(IBTK_MPI::getCommunicator(),
+                                 const_cast<char*>(file_name.c_str()),
+                                 MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                                 MPI_INFO_NULL,
+                                 &fh);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::writeLDataRestartFile():\n"
+                                 << "  could not open restart file " << file_name << " for writing:\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+    mpi_ierr = MPI_File_set_size(fh, 0);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::writeLDataRestartFile():\n"
+                                 << "  could not truncate restart file " << file_name << ":\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+    const MPI_Offset offset = static_cast<MPI_Offset>(ilo) * static_cast<MPI_Offset>(sizeof(double));
+    mpi_ierr =
+        MPI_File_write_at_all(fh, offset, const_cast<double*>(lag_vals), ihi - ilo, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::writeLDataRestartFile():\n"
+                                 << "  could not write restart file " << file_name << ":\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+    mpi_ierr = MPI_File_close(&fh);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::writeLDataRestartFile():\n"
+                                 << "  could not close restart file " << file_name << ":\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+
+    ierr = VecRestoreArrayRead(lag_vec, &lag_vals);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&lag_vec);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // writeLDataRestartFile
+
+void
+LDataManager::readLDataRestartFile(const std::string& file_name, Pointer<LData> ldata, const int level_number) const
+{
+    int ierr;
+    const int depth = static_cast<int>(ldata->getDepth());
+    const int num_local_nodes = static_cast<int>(ldata->getLocalNodeCount());
+
+    Vec lag_vec;
+    ierr = VecCreate(PETSC_COMM_WORLD, &lag_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetSizes(lag_vec, depth * num_local_nodes, PETSC_DETERMINE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetBlockSize(lag_vec, depth);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSetType(lag_vec, VECMPI);
+    IBTK_CHKERRQ(ierr);
+
+    int ilo, ihi;
+    ierr = VecGetOwnershipRange(lag_vec, &ilo, &ihi);
+    IBTK_CHKERRQ(ierr);
+    double* lag_vals;
+    ierr = VecGetArray(lag_vec, &lag_vals);
+    IBTK_CHKERRQ(ierr);
+
+    // Read the data collectively from the shared file. MPI-IO returns error
+    // codes rather than aborting by default, so every call is checked.
+    MPI_File fh;
+    int mpi_ierr = MPI_File_open(
+        IBTK_MPI::getCommunicator(), const_cast<char*>(file_name.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::readLDataRestartFile():\n"
+                                 << "  could not open restart file " << file_name << " for reading:\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+    MPI_Offset file_size;
+    mpi_ierr = MPI_File_get_size(fh, &file_size);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::readLDataRestartFile():\n"
+                                 << "  could not determine the size of restart file " << file_name << ":\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+    int global_size;
+    ierr = VecGetSize(lag_vec, &global_size);
+    IBTK_CHKERRQ(ierr);
+    if (file_size != static_cast<MPI_Offset>(global_size) * static_cast<MPI_Offset>(sizeof(double)))
+    {
+        TBOX_ERROR(d_object_name << "::readLDataRestartFile():\n"
+                                 << "  restart file " << file_name << " has size " << file_size
+                                 << " bytes, but the Lagrangian data require "
+                                 << static_cast<MPI_Offset>(global_size) * static_cast<MPI_Offset>(sizeof(double))
+                                 << " bytes." << std::endl);
+    }
+    const MPI_Offset offset = static_cast<MPI_Offset>(ilo) * static_cast<MPI_Offset>(sizeof(double));
+    mpi_ierr = MPI_File_read_at_all(fh, offset, lag_vals, ihi - ilo, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::readLDataRestartFile():\n"
+                                 << "  could not read restart file " << file_name << ":\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+    mpi_ierr = MPI_File_close(&fh);
+    if (mpi_ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR(d_object_name << "::readLDataRestartFile():\n"
+                                 << "  could not close restart file " << file_name << ":\n"
+                                 << "  " << mpi_error_string(mpi_ierr) << std::endl);
+    }
+
+    ierr = VecRestoreArray(lag_vec, &lag_vals);
+    IBTK_CHKERRQ(ierr);
+
+    // Permute the data back into the PETSc ordering and update the ghost
+    // values.
+    Vec petsc_vec = ldata->getVec();
+    scatterLagrangianToPETSc(lag_vec, petsc_vec, level_number);
+    ldata->beginGhostUpdate();
+    ldata->endGhostUpdate();
+
+    ierr = VecDestroy(&lag_vec);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // readLDataRestartFile
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
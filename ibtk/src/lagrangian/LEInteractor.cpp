@@ -52,925 +52,802 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <string>
 #include <vector>
 
-// FORTRAN ROUTINES
-#if (NDIM == 2)
-#define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
-    IBTK_FC_FUNC_(lagrangian_piecewise_constant_interp2d, LAGRANGIAN_PIECEWISE_CONSTANT_INTERP2D)
-#define LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC                                                                        \
-    IBTK_FC_FUNC_(lagrangian_piecewise_constant_spread2d, LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD2D)
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
-#define LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP_FC                                                                      \
-    IBTK_FC_FUNC_(lagrangian_discontinuous_linear_interp2d, LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP2D)
-#define LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD_FC                                                                      \
-    IBTK_FC_FUNC_(lagrangian_discontinuous_linear_spread2d, LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD2D)
+/////////////////////////////// NAMESPACE ////////////////////////////////////
 
-#define LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC                                                                          \
-    IBTK_FC_FUNC_(lagrangian_piecewise_linear_interp2d, LAGRANGIAN_PIECEWISE_LINEAR_INTERP2D)
-#define LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC                                                                          \
-    IBTK_FC_FUNC_(lagrangian_piecewise_linear_spread2d, LAGRANGIAN_PIECEWISE_LINEAR_SPREAD2D)
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
 
-#define LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC                                                                           \
-    IBTK_FC_FUNC_(lagrangian_piecewise_cubic_interp2d, LAGRANGIAN_PIECEWISE_CUBIC_INTERP2D)
-#define LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC                                                                           \
-    IBTK_FC_FUNC_(lagrangian_piecewise_cubic_spread2d, LAGRANGIAN_PIECEWISE_CUBIC_SPREAD2D)
+namespace
+{
+inline double
+ib4_kernel_fcn(double r)
+{
+    r = std::abs(r);
+    if (r < 1.0)
+    {
+        const double t2 = r * r;
+        const double t6 = std::sqrt(-0.4e1 * t2 + 0.4e1 * r + 0.1e1);
+        return -r / 0.4e1 + 0.3e1 / 0.8e1 + t6 / 0.8e1;
+    }
+    else if (r < 2.0)
+    {
+        const double t2 = r * r;
+        const double t6 = std::sqrt(0.12e2 * r - 0.7e1 - 0.4e1 * t2);
+        return -r / 0.4e1 + 0.5e1 / 0.8e1 - t6 / 0.8e1;
+    }
+    else
+    {
+        return 0.0;
+    }
+}
 
-#define LAGRANGIAN_IB_3_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_3_interp2d, LAGRANGIAN_IB_3_INTERP2D)
-#define LAGRANGIAN_IB_3_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_3_spread2d, LAGRANGIAN_IB_3_SPREAD2D)
+inline int
+NINT(double a)
+{
+    // Round half away from zero, as in Fortran.  This is written without a
+    // branch so that loops calling it can be vectorized.
+    return static_cast<int>(a + std::copysign(0.5, a));
+}
 
-#define LAGRANGIAN_IB_4_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_4_interp2d, LAGRANGIAN_IB_4_INTERP2D)
-#define LAGRANGIAN_IB_4_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_4_spread2d, LAGRANGIAN_IB_4_SPREAD2D)
+// The weights of the interpolation and spreading kernels are evaluated for
+// batches of BATCH_SIZE Lagrangian points at a time.  The batched weights are
+// stored with the index of the point varying fastest, so that the loops that
+// evaluate them have a fixed trip count, unit stride, and no dependencies
+// between iterations, which allows the compiler to vectorize them.
+static constexpr int BATCH_SIZE = 8;
+
+// The batched loops are annotated with OpenMP simd directives.  With GCC they
+// are only vectorized if the directives are honored and if comparisons and
+// sqrt() may be evaluated without regard to floating point traps and errno;
+// when configure is run with --enable-simd-flags, this file (and only this
+// file) is compiled with -fopenmp-simd -fno-math-errno -fno-trapping-math for
+// this purpose.
+#if defined(_OPENMP) || IBTK_HAVE_OPENMP_SIMD
+#define IBTK_SIMD_LOOP _Pragma("omp simd")
+#else
+#define IBTK_SIMD_LOOP
+#endif
+
+// The following kernel classes compute the one-dimensional weights of the
+// regularized delta functions.  For a batch of positions X_o_dx given in units
+// of the grid spacing relative to the lower corner of the patch data, each
+// kernel computes the weights w[k][b] of the (at most Kernel::width) stencil
+// points and the offset ic_lower[b] of the lowest stencil point relative to
+// the lower index of the patch data.  The interpolation and spreading loops are
+// parameterized on the kernel so that the stencil width is known at compile
+// time.
+struct PiecewiseConstantKernel
+{
+    static constexpr int width = 1;
 
-#define LAGRANGIAN_IB_4_W8_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_4_w8_interp2d, LAGRANGIAN_IB_4_W8_INTERP2D)
-#define LAGRANGIAN_IB_4_W8_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_4_w8_spread2d, LAGRANGIAN_IB_4_W8_SPREAD2D)
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
 
-#define LAGRANGIAN_IB_5_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_5_interp2d, LAGRANGIAN_ib_5_INTERP2D)
-#define LAGRANGIAN_IB_5_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_5_spread2d, LAGRANGIAN_ib_5_SPREAD2D)
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            ic_lower[b] = NINT(X_o_dx[b] - 0.5);
+            w[0][b] = 1.0;
+        }
+    }
+};
 
-#define LAGRANGIAN_IB_6_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_6_interp2d, LAGRANGIAN_IB_6_INTERP2D)
-#define LAGRANGIAN_IB_6_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_6_spread2d, LAGRANGIAN_IB_6_SPREAD2D)
+struct PiecewiseLinearKernel
+{
+    static constexpr int width = 2;
 
-#define LAGRANGIAN_BSPLINE_3_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_3_interp2d, LAGRANGIAN_BSPLINE_3_INTERP2D)
-#define LAGRANGIAN_BSPLINE_3_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_3_spread2d, LAGRANGIAN_BSPLINE_3_SPREAD2D)
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
 
-#define LAGRANGIAN_BSPLINE_4_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_4_interp2d, LAGRANGIAN_BSPLINE_4_INTERP2D)
-#define LAGRANGIAN_BSPLINE_4_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_4_spread2d, LAGRANGIAN_BSPLINE_4_SPREAD2D)
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            const int ic_center = NINT(X_o_dx[b] - 0.5);
+            const double r = (ic_center + 0.5) - X_o_dx[b];
+            const bool lower = r > 0.0;
+            ic_lower[b] = lower ? ic_center - 1 : ic_center;
+            w[0][b] = lower ? r : 1.0 + r;
+            w[1][b] = 1.0 - w[0][b];
+        }
+    }
+};
 
-#define LAGRANGIAN_BSPLINE_5_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_5_interp2d, LAGRANGIAN_BSPLINE_5_INTERP2D)
-#define LAGRANGIAN_BSPLINE_5_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_5_spread2d, LAGRANGIAN_BSPLINE_5_SPREAD2D)
+struct DiscontinuousLinearKernel
+{
+    static constexpr int width = 2;
 
-#define LAGRANGIAN_BSPLINE_6_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_6_interp2d, LAGRANGIAN_BSPLINE_6_INTERP2D)
-#define LAGRANGIAN_BSPLINE_6_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_6_spread2d, LAGRANGIAN_BSPLINE_6_SPREAD2D)
-#endif
+    DiscontinuousLinearKernel(const unsigned int axis) : axis(axis)
+    {
+        // intentionally blank
+    }
 
-#if (NDIM == 3)
-#define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
-    IBTK_FC_FUNC_(lagrangian_piecewise_constant_interp3d, LAGRANGIAN_PIECEWISE_CONSTANT_INTERP3D)
-#define LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC                                                                        \
-    IBTK_FC_FUNC_(lagrangian_piecewise_constant_spread3d, LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD3D)
+    inline int getStencilWidth(const unsigned int d) const
+    {
+        return d == axis ? 2 : 1;
+    }
 
-#define LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP_FC                                                                      \
-    IBTK_FC_FUNC_(lagrangian_discontinuous_linear_interp3d, LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP3D)
-#define LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD_FC                                                                      \
-    IBTK_FC_FUNC_(lagrangian_discontinuous_linear_spread3d, LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD3D)
+    inline void computeWeights(const double* const X_o_dx,
+                               const unsigned int d,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        if (d == axis)
+        {
+            PiecewiseLinearKernel().computeWeights(X_o_dx, d, ic_lower, w);
+        }
+        else
+        {
+            PiecewiseConstantKernel().computeWeights(X_o_dx, d, ic_lower, w);
+        }
+    }
 
-#define LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC                                                                          \
-    IBTK_FC_FUNC_(lagrangian_piecewise_linear_interp3d, LAGRANGIAN_PIECEWISE_LINEAR_INTERP3D)
-#define LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC                                                                          \
-    IBTK_FC_FUNC_(lagrangian_piecewise_linear_spread3d, LAGRANGIAN_PIECEWISE_LINEAR_SPREAD3D)
+    const unsigned int axis;
+};
 
-#define LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC                                                                           \
-    IBTK_FC_FUNC_(lagrangian_piecewise_cubic_interp3d, LAGRANGIAN_PIECEWISE_CUBIC_INTERP3D)
-#define LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC                                                                           \
-    IBTK_FC_FUNC_(lagrangian_piecewise_cubic_spread3d, LAGRANGIAN_PIECEWISE_CUBIC_SPREAD3D)
+// Kernels whose weights are obtained by evaluating a delta function at the
+// stencil points.  Even-width stencils are centered on the nearest cell
+// boundary; odd-width stencils are centered on the cell containing X.
+template <int WIDTH, double (*delta_fcn)(double)>
+struct EvaluatedKernel
+{
+    static constexpr int width = WIDTH;
 
-#define LAGRANGIAN_IB_3_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_3_interp3d, LAGRANGIAN_IB_3_INTERP3D)
-#define LAGRANGIAN_IB_3_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_3_spread3d, LAGRANGIAN_IB_3_SPREAD3D)
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
 
-#define LAGRANGIAN_IB_4_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_4_interp3d, LAGRANGIAN_IB_4_INTERP3D)
-#define LAGRANGIAN_IB_4_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_4_spread3d, LAGRANGIAN_IB_4_SPREAD3D)
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        double r[BATCH_SIZE];
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            const double ic_center = std::floor(X_o_dx[b]);
+            const double shift = (width % 2 == 0 && X_o_dx[b] >= ic_center + 0.5) ? 1.0 : 0.0;
+            const double lower = ic_center - (width / 2) + shift;
+            ic_lower[b] = static_cast<int>(lower);
+            r[b] = X_o_dx[b] - (lower + 0.5);
+        }
+        for (int k = 0; k < width; ++k)
+        {
+            IBTK_SIMD_LOOP
+            for (int b = 0; b < BATCH_SIZE; ++b)
+            {
+                w[k][b] = delta_fcn(r[b] - k);
+            }
+        }
+    }
+};
 
-#define LAGRANGIAN_IB_4_W8_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_4_w8_interp3d, LAGRANGIAN_IB_4_W8_INTERP3D)
-#define LAGRANGIAN_IB_4_W8_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_4_w8_spread3d, LAGRANGIAN_IB_4_W8_SPREAD3D)
+// The delta functions are written so that each piece of the function is
+// evaluated and the result is selected without branching, which allows the
+// batched weight evaluation loops to be vectorized.
+inline double
+piecewise_cubic_delta(const double x)
+{
+    const double r = std::abs(x);
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double p0 = 1.0 - 0.5 * r - r2 + 0.5 * r3;
+    const double p1 = 1.0 - (11.0 / 6.0) * r + r2 - (1.0 / 6.0) * r3;
+    return r < 1.0 ? p0 : (r < 2.0 ? p1 : 0.0);
+}
 
-#define LAGRANGIAN_IB_5_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_5_interp3d, LAGRANGIAN_ib_5_INTERP3D)
-#define LAGRANGIAN_IB_5_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_5_spread3d, LAGRANGIAN_ib_5_SPREAD3D)
+inline double
+ib_3_delta(const double x)
+{
+    const double r = std::abs(x);
+    const double p0 = (1.0 + std::sqrt(std::max(1.0 - 3.0 * r * r, 0.0))) / 3.0;
+    const double p1 = (5.0 - 3.0 * r - std::sqrt(std::max(1.0 - 3.0 * (1.0 - r) * (1.0 - r), 0.0))) / 6.0;
+    return r < 0.5 ? p0 : (r < 1.5 ? p1 : 0.0);
+}
 
-#define LAGRANGIAN_IB_6_INTERP_FC IBTK_FC_FUNC_(lagrangian_ib_6_interp3d, LAGRANGIAN_IB_6_INTERP3D)
-#define LAGRANGIAN_IB_6_SPREAD_FC IBTK_FC_FUNC_(lagrangian_ib_6_spread3d, LAGRANGIAN_IB_6_SPREAD3D)
+inline double
+bspline_3_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 1.5;
+    const double r2 = r * r;
+    const double p0 = 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+    const double p1 = 0.5 * (r2 - 6.0 * r + 9.0);
+    return modx <= 0.5 ? p0 : (modx <= 1.5 ? p1 : 0.0);
+}
 
-#define LAGRANGIAN_BSPLINE_3_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_3_interp3d, LAGRANGIAN_BSPLINE_3_INTERP3D)
-#define LAGRANGIAN_BSPLINE_3_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_3_spread3d, LAGRANGIAN_BSPLINE_3_SPREAD3D)
+inline double
+bspline_4_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double p0 = (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+    const double p1 = (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+    return modx <= 1.0 ? p0 : (modx <= 2.0 ? p1 : 0.0);
+}
 
-#define LAGRANGIAN_BSPLINE_4_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_4_interp3d, LAGRANGIAN_BSPLINE_4_INTERP3D)
-#define LAGRANGIAN_BSPLINE_4_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_4_spread3d, LAGRANGIAN_BSPLINE_4_SPREAD3D)
+inline double
+bspline_5_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 2.5;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    const double p0 = (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+    const double p1 = (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+    const double p2 = (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+    return modx <= 0.5 ? p0 : (modx <= 1.5 ? p1 : (modx <= 2.5 ? p2 : 0.0));
+}
 
-#define LAGRANGIAN_BSPLINE_5_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_5_interp3d, LAGRANGIAN_BSPLINE_5_INTERP3D)
-#define LAGRANGIAN_BSPLINE_5_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_5_spread3d, LAGRANGIAN_BSPLINE_5_SPREAD3D)
+inline double
+bspline_6_delta(const double x)
+{
+    const double modx = std::abs(x);
+    const double r = modx + 3.0;
+    const double r2 = r * r;
+    const double r3 = r2 * r;
+    const double r4 = r3 * r;
+    const double r5 = r4 * r;
+    const double p0 = (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+    const double p1 = (1.0 / 120.0) * (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+    const double p2 = (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+    return modx <= 1.0 ? p0 : (modx <= 2.0 ? p1 : (modx <= 3.0 ? p2 : 0.0));
+}
 
-#define LAGRANGIAN_BSPLINE_6_INTERP_FC IBTK_FC_FUNC_(lagrangian_bspline_6_interp3d, LAGRANGIAN_BSPLINE_6_INTERP3D)
-#define LAGRANGIAN_BSPLINE_6_SPREAD_FC IBTK_FC_FUNC_(lagrangian_bspline_6_spread3d, LAGRANGIAN_BSPLINE_6_SPREAD3D)
-#endif
+using PiecewiseCubicKernel = EvaluatedKernel<4, &piecewise_cubic_delta>;
+using IB3Kernel = EvaluatedKernel<3, &ib_3_delta>;
+using BSpline3Kernel = EvaluatedKernel<3, &bspline_3_delta>;
+using BSpline4Kernel = EvaluatedKernel<4, &bspline_4_delta>;
+using BSpline5Kernel = EvaluatedKernel<5, &bspline_5_delta>;
+using BSpline6Kernel = EvaluatedKernel<6, &bspline_6_delta>;
 
-extern "C"
+struct IB4Kernel
 {
-    void LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC(const double*,
-                                                 const double*,
-                                                 const double*,
-                                                 const int&,
-#if (NDIM == 2)
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-#endif
-#if (NDIM == 3)
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-#endif
-                                                 const double*,
-                                                 const int*,
-                                                 const double*,
-                                                 const int&,
-                                                 const double*,
-                                                 double*);
-
-    void LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC(const double*,
-                                                 const double*,
-                                                 const double*,
-                                                 const int&,
-                                                 const int*,
-                                                 const double*,
-                                                 const int&,
-                                                 const double*,
-                                                 const double*,
-#if (NDIM == 2)
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-#endif
-#if (NDIM == 3)
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-                                                 const int&,
-#endif
-                                                 double*);
+    static constexpr int width = 4;
 
-    void LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP_FC(const double*,
-                                                   const double*,
-                                                   const double*,
-                                                   const int&,
-                                                   const int&,
-#if (NDIM == 2)
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-#endif
-#if (NDIM == 3)
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-#endif
-                                                   const double*,
-                                                   const int*,
-                                                   const double*,
-                                                   const int&,
-                                                   const double*,
-                                                   double*);
-
-    void LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD_FC(const double*,
-                                                   const double*,
-                                                   const double*,
-                                                   const int&,
-                                                   const int&,
-                                                   const int*,
-                                                   const double*,
-                                                   const int&,
-                                                   const double*,
-                                                   const double*,
-#if (NDIM == 2)
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-#endif
-#if (NDIM == 3)
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-                                                   const int&,
-#endif
-                                                   double*);
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
 
-    void LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC(const double*,
-                                               const double*,
-                                               const double*,
-                                               const int&,
-#if (NDIM == 2)
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-#endif
-#if (NDIM == 3)
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-#endif
-                                               const double*,
-                                               const int*,
-                                               const double*,
-                                               const int&,
-                                               const double*,
-                                               double*);
-
-    void LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC(const double*,
-                                               const double*,
-                                               const double*,
-                                               const int&,
-                                               const int*,
-                                               const double*,
-                                               const int&,
-                                               const double*,
-                                               const double*,
-#if (NDIM == 2)
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-#endif
-#if (NDIM == 3)
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-                                               const int&,
-#endif
-                                               double*);
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            ic_lower[b] = NINT(X_o_dx[b]) - 2;
+            const double r = X_o_dx[b] - (ic_lower[b] + 1.5);
+            const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+            w[0][b] = 0.125 * (3.0 - 2.0 * r - q);
+            w[1][b] = 0.125 * (3.0 - 2.0 * r + q);
+            w[2][b] = 0.125 * (1.0 + 2.0 * r + q);
+            w[3][b] = 0.125 * (1.0 + 2.0 * r - q);
+        }
+    }
+};
 
-    void LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC(const double*,
-                                              const double*,
-                                              const double*,
-                                              const int&,
-#if (NDIM == 2)
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-#endif
-#if (NDIM == 3)
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-#endif
-                                              const double*,
-                                              const int*,
-                                              const double*,
-                                              const int&,
-                                              const double*,
-                                              double*);
-
-    void LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC(const double*,
-                                              const double*,
-                                              const double*,
-                                              const int&,
-                                              const int*,
-                                              const double*,
-                                              const int&,
-                                              const double*,
-                                              const double*,
-#if (NDIM == 2)
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-#endif
-#if (NDIM == 3)
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-                                              const int&,
-#endif
-                                              double*);
+struct IB4W8Kernel
+{
+    static constexpr int width = 8;
 
-    void LAGRANGIAN_IB_3_INTERP_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   const double*,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   double*);
-
-    void LAGRANGIAN_IB_3_SPREAD_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   const double*,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   double*);
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
 
-    void LAGRANGIAN_IB_4_INTERP_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   const double*,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   double*);
-
-    void LAGRANGIAN_IB_4_SPREAD_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   const double*,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   double*);
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            ic_lower[b] = NINT(X_o_dx[b]) - 4;
+            const double r_odd = 0.5 * (X_o_dx[b] - (ic_lower[b] + 3.5));
+            const double q_odd = std::sqrt(1.0 + 4.0 * r_odd * (1.0 - r_odd));
+            w[1][b] = 0.0625 * (3.0 - 2.0 * r_odd - q_odd);
+            w[3][b] = 0.0625 * (3.0 - 2.0 * r_odd + q_odd);
+            w[5][b] = 0.0625 * (1.0 + 2.0 * r_odd + q_odd);
+            w[7][b] = 0.0625 * (1.0 + 2.0 * r_odd - q_odd);
+            const double r_even = r_odd + 0.5;
+            const double q_even = std::sqrt(1.0 + 4.0 * r_even * (1.0 - r_even));
+            w[0][b] = 0.0625 * (3.0 - 2.0 * r_even - q_even);
+            w[2][b] = 0.0625 * (3.0 - 2.0 * r_even + q_even);
+            w[4][b] = 0.0625 * (1.0 + 2.0 * r_even + q_even);
+            w[6][b] = 0.0625 * (1.0 + 2.0 * r_even - q_even);
+        }
+    }
+};
 
-    void LAGRANGIAN_IB_4_W8_INTERP_FC(const double*,
-                                      const double*,
-                                      const double*,
-                                      const int&,
-#if (NDIM == 2)
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-#endif
-#if (NDIM == 3)
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-#endif
-                                      const double*,
-                                      const int*,
-                                      const double*,
-                                      const int&,
-                                      const double*,
-                                      double*);
-
-    void LAGRANGIAN_IB_4_W8_SPREAD_FC(const double*,
-                                      const double*,
-                                      const double*,
-                                      const int&,
-                                      const int*,
-                                      const double*,
-                                      const int&,
-                                      const double*,
-                                      const double*,
-#if (NDIM == 2)
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-#endif
-#if (NDIM == 3)
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-                                      const int&,
-#endif
-                                      double*);
+struct IB5Kernel
+{
+    static constexpr int width = 5;
 
-    void LAGRANGIAN_IB_5_INTERP_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   const double*,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   double*);
-
-    void LAGRANGIAN_IB_5_SPREAD_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   const double*,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   double*);
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
 
-    void LAGRANGIAN_IB_6_INTERP_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   const double*,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   double*);
-
-    void LAGRANGIAN_IB_6_SPREAD_FC(const double*,
-                                   const double*,
-                                   const double*,
-                                   const int&,
-                                   const int*,
-                                   const double*,
-                                   const int&,
-                                   const double*,
-                                   const double*,
-#if (NDIM == 2)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-#if (NDIM == 3)
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-                                   const int&,
-#endif
-                                   double*);
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        const double K = (38.0 - std::sqrt(69.0)) / 60.0;
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            const double ic_center = std::floor(X_o_dx[b]);
+            ic_lower[b] = static_cast<int>(ic_center) - 2;
+            const double r = X_o_dx[b] - (ic_center + 0.5);
+            const double r2 = r * r;
+            const double r3 = r2 * r;
+            const double r4 = r2 * r2;
+            const double phi = (136.0 - 40.0 * K - 40.0 * r2 +
+                                std::sqrt(2.0) * std::sqrt(3123.0 - 6840.0 * K + 3600.0 * K * K - 12440.0 * r2 +
+                                                           25680.0 * K * r2 - 12600.0 * K * K * r2 + 8080.0 * r4 -
+                                                           8400.0 * K * r4 - 1400.0 * r4 * r2)) /
+                               280.0;
+            w[0][b] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K + r - 3.0 * K * r + 2.0 * r2 - r3);
+            w[1][b] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K - 4.0 * r + 3.0 * K * r - r2 + r3);
+            w[2][b] = phi;
+            w[3][b] = (1.0 / 6.0) * (4.0 - 4.0 * phi - K + 4.0 * r - 3.0 * K * r - r2 - r3);
+            w[4][b] = (1.0 / 12.0) * (-2.0 + 2.0 * phi + 2.0 * K - r + 3.0 * K * r + 2.0 * r2 + r3);
+        }
+    }
+};
 
-    void LAGRANGIAN_BSPLINE_3_INTERP_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
-#if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-#endif
+struct IB6Kernel
+{
+    static constexpr int width = 6;
+
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return width;
+    }
+
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        const double K = (59.0 / 60.0) * (1.0 - std::sqrt(1.0 - (3220.0 / 3481.0)));
+        const double sgn = (1.5 - K) >= 0.0 ? 1.0 : -1.0;
+        const double alpha = 28.0;
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            ic_lower[b] = NINT(X_o_dx[b]) - 3;
+            const double r = 1.0 - X_o_dx[b] + (ic_lower[b] + 2.5);
+            const double r2 = r * r;
+            const double r3 = r2 * r;
+            const double beta =
+                (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+            const double gamma = 0.25 * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * 0.5 * r2 +
+                                         (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r2 * r2 + (5.0 / 18.0) * r3 * r3);
+            const double discr = beta * beta - 4.0 * alpha * gamma;
+            const double pm3 = (-beta + sgn * std::sqrt(discr)) / (2.0 * alpha);
+            w[0][b] = pm3;
+            w[1][b] =
+                -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r + (1.0 / 12.0) * r3;
+            w[2][b] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+            w[3][b] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+            w[4][b] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+            w[5][b] =
+                pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+        }
+    }
+};
+
+// A kernel defined by the user-provided function LEInteractor::s_kernel_fcn.
+// The stencil width is only known at run time, and so the weight arrays are
+// allocated with the maximum supported width.
+struct UserDefinedKernel
+{
+    static constexpr int width = 16;
+
+    UserDefinedKernel(double (*kernel_fcn)(double), const int stencil_size)
+        : kernel_fcn(kernel_fcn), stencil_size(stencil_size)
+    {
+        // intentionally blank
+    }
+
+    inline int getStencilWidth(unsigned int /*d*/) const
+    {
+        return stencil_size;
+    }
+
+    inline void computeWeights(const double* const X_o_dx,
+                               unsigned int /*d*/,
+                               int* const ic_lower,
+                               double (*const w)[BATCH_SIZE]) const
+    {
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            const int ic_center = static_cast<int>(std::floor(X_o_dx[b]));
+            ic_lower[b] = ic_center - stencil_size / 2;
+            if (stencil_size % 2 == 0 && X_o_dx[b] >= ic_center + 0.5) ic_lower[b] += 1;
+            for (int k = 0; k < stencil_size; ++k)
+            {
+                w[k][b] = kernel_fcn(X_o_dx[b] - (ic_lower[b] + k + 0.5));
+            }
+        }
+    }
+
+    double (*const kernel_fcn)(double);
+    const int stencil_size;
+};
+
+// Indexing data that describes a collection of Lagrangian points and a
+// (Fortran-ordered) Cartesian grid patch data array.
+struct InteractionData
+{
+    const double* X;
+    const int* indices;
+    const double* X_shift;
+    int num_indices;
+    const int* ilower;
+    const int* iupper;
+    const int* nugc;
+    int depth;
+    const double* x_lower;
+    const double* dx;
+};
+
+// The stencils of a batch of Lagrangian points.
+template <int W>
+struct StencilBatch
+{
+    // Kernel weights, indexed by dimension, stencil point, and batch entry.
+    double w[NDIM][W][BATCH_SIZE];
+
+    // The range of stencil points that lie within the ghost box of the patch
+    // data, indexed by dimension and batch entry.
+    int istart[NDIM][BATCH_SIZE], istop[NDIM][BATCH_SIZE];
+
+    // The offset of the lowest stencil point in the patch data array.
+    int offset[BATCH_SIZE];
+
+    // Whether the complete stencil lies within the ghost box.
+    bool full_stencil[BATCH_SIZE];
+};
+
+// Determine the stencils of the Lagrangian points with local indices
+// l_begin, ..., l_begin + num_points - 1.  Batches that are not full are
+// padded by repeating the position of the last point.
+template <class Kernel>
+inline void
+compute_stencils(const Kernel& kernel,
+                 const InteractionData& data,
+                 const int l_begin,
+                 const int num_points,
+                 const int* const stride,
+                 StencilBatch<Kernel::width>& stencils)
+{
+    int ic_lower[BATCH_SIZE];
+    double X_o_dx[BATCH_SIZE];
+    IBTK_SIMD_LOOP
+    for (int b = 0; b < BATCH_SIZE; ++b)
+    {
+        stencils.offset[b] = 0;
+        stencils.full_stencil[b] = true;
+    }
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            const int l = l_begin + std::min(b, num_points - 1);
+            const int s = data.indices[l];
+            X_o_dx[b] = (data.X[NDIM * s + d] + data.X_shift[NDIM * l + d] - data.x_lower[d]) / data.dx[d];
+        }
+        kernel.computeWeights(X_o_dx, d, ic_lower, stencils.w[d]);
+        const int stencil_width = kernel.getStencilWidth(d);
+        const int ig_lower = data.ilower[d] - data.nugc[d];
+        const int ig_upper = data.iupper[d] + data.nugc[d];
+        IBTK_SIMD_LOOP
+        for (int b = 0; b < BATCH_SIZE; ++b)
+        {
+            const int ic_lo = ic_lower[b] + data.ilower[d];
+            const int ic_up = ic_lo + stencil_width - 1;
+            stencils.istart[d][b] = std::max(ig_lower - ic_lo, 0);
+            stencils.istop[d][b] = (stencil_width - 1) - std::max(ic_up - ig_upper, 0);
+            stencils.full_stencil[b] = stencils.full_stencil[b] && stencils.istart[d][b] == 0 &&
+                                       stencils.istop[d][b] == Kernel::width - 1;
+            stencils.offset[b] += (ic_lo - ig_lower) * stride[d];
+        }
+    }
+    return;
+} // compute_stencils
+
+// Compute the strides of the (Fortran-ordered) patch data array.  The final
+// entry is the stride between data depths.
+inline void
+compute_strides(const InteractionData& data, int* const stride)
+{
+    stride[0] = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        stride[d + 1] = stride[d] * (data.iupper[d] - data.ilower[d] + 1 + 2 * data.nugc[d]);
+    }
+    return;
+} // compute_strides
+
+// Interpolate u to a single Lagrangian point.  If FULL_STENCIL is true, the
+// loop bounds are fixed at compile time.
+template <int W, bool FULL_STENCIL>
+inline double
+interpolate_point(const double (&w)[NDIM][W],
+                  const int* const istart,
+                  const int* const istop,
+                  const double* const u,
+                  const int* const stride)
+{
+    const int i0_start = FULL_STENCIL ? 0 : istart[0], i0_stop = FULL_STENCIL ? W - 1 : istop[0];
+    const int i1_start = FULL_STENCIL ? 0 : istart[1], i1_stop = FULL_STENCIL ? W - 1 : istop[1];
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-#endif
-                                        const double*,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        double*);
-
-    void LAGRANGIAN_BSPLINE_3_SPREAD_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        const double*,
-#if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+    const int i2_start = FULL_STENCIL ? 0 : istart[2], i2_stop = FULL_STENCIL ? W - 1 : istop[2];
 #endif
+    double V = 0.0;
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+    for (int i2 = i2_start; i2 <= i2_stop; ++i2)
+    {
 #endif
-                                        double*);
-
-    void LAGRANGIAN_BSPLINE_4_INTERP_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
+        for (int i1 = i1_start; i1 <= i1_stop; ++i1)
+        {
 #if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+            const double w_outer = w[1][i1];
+            const double* const u_row = u + i1 * stride[1];
 #endif
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-#endif
-                                        const double*,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        double*);
-
-    void LAGRANGIAN_BSPLINE_4_SPREAD_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        const double*,
-#if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+            const double w_outer = w[1][i1] * w[2][i2];
+            const double* const u_row = u + i1 * stride[1] + i2 * stride[2];
 #endif
+            double V_row = 0.0;
+            for (int i0 = i0_start; i0 <= i0_stop; ++i0)
+            {
+                V_row += w[0][i0] * u_row[i0];
+            }
+            V += w_outer * V_row;
+        }
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+    }
 #endif
-                                        double*);
+    return V;
+} // interpolate_point
 
-    void LAGRANGIAN_BSPLINE_5_INTERP_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
-#if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-#endif
+// Spread V from a single Lagrangian point to u.  If FULL_STENCIL is true, the
+// loop bounds are fixed at compile time.
+template <int W, bool FULL_STENCIL>
+inline void
+spread_point(const double (&w)[NDIM][W],
+             const int* const istart,
+             const int* const istop,
+             const double V,
+             double* const u,
+             const int* const stride)
+{
+    const int i0_start = FULL_STENCIL ? 0 : istart[0], i0_stop = FULL_STENCIL ? W - 1 : istop[0];
+    const int i1_start = FULL_STENCIL ? 0 : istart[1], i1_stop = FULL_STENCIL ? W - 1 : istop[1];
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-#endif
-                                        const double*,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        double*);
-
-    void LAGRANGIAN_BSPLINE_5_SPREAD_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        const double*,
-#if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+    const int i2_start = FULL_STENCIL ? 0 : istart[2], i2_stop = FULL_STENCIL ? W - 1 : istop[2];
 #endif
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+    for (int i2 = i2_start; i2 <= i2_stop; ++i2)
+    {
 #endif
-                                        double*);
-
-    void LAGRANGIAN_BSPLINE_6_INTERP_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
+        for (int i1 = i1_start; i1 <= i1_stop; ++i1)
+        {
 #if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+            const double V_row = w[1][i1] * V;
+            double* const u_row = u + i1 * stride[1];
 #endif
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-#endif
-                                        const double*,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        double*);
-
-    void LAGRANGIAN_BSPLINE_6_SPREAD_FC(const double*,
-                                        const double*,
-                                        const double*,
-                                        const int&,
-                                        const int*,
-                                        const double*,
-                                        const int&,
-                                        const double*,
-                                        const double*,
-#if (NDIM == 2)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+            const double V_row = w[1][i1] * w[2][i2] * V;
+            double* const u_row = u + i1 * stride[1] + i2 * stride[2];
 #endif
+            for (int i0 = i0_start; i0 <= i0_stop; ++i0)
+            {
+                u_row[i0] += w[0][i0] * V_row;
+            }
+        }
 #if (NDIM == 3)
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
-                                        const int&,
+    }
 #endif
-                                        double*);
-}
-
-/////////////////////////////// NAMESPACE ////////////////////////////////////
-
-namespace IBTK
+    return;
+} // spread_point
+
+// Extract the weights and stencil bounds of entry b of a batch.
+template <int W>
+inline void
+unpack_stencil(const StencilBatch<W>& stencils,
+               const int b,
+               double (&w)[NDIM][W],
+               int* const istart,
+               int* const istop)
 {
-/////////////////////////////// STATIC ///////////////////////////////////////
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        for (int k = 0; k < W; ++k)
+        {
+            w[d][k] = stencils.w[d][k][b];
+        }
+        istart[d] = stencils.istart[d][b];
+        istop[d] = stencils.istop[d][b];
+    }
+    return;
+} // unpack_stencil
 
-namespace
+template <class Kernel>
+void
+interpolate_with_kernel(const Kernel& kernel, double* const V, const double* const u, const InteractionData& data)
 {
-inline double
-ib4_kernel_fcn(double r)
+    static constexpr int W = Kernel::width;
+    int stride[NDIM + 1];
+    compute_strides(data, stride);
+    StencilBatch<W> stencils;
+    double w[NDIM][W];
+    int istart[NDIM], istop[NDIM];
+    for (int l_begin = 0; l_begin < data.num_indices; l_begin += BATCH_SIZE)
+    {
+        const int num_points = std::min(BATCH_SIZE, data.num_indices - l_begin);
+        compute_stencils(kernel, data, l_begin, num_points, stride, stencils);
+        for (int b = 0; b < num_points; ++b)
+        {
+            const int s = data.indices[l_begin + b];
+            unpack_stencil(stencils, b, w, istart, istop);
+            for (int k = 0; k < data.depth; ++k)
+            {
+                const double* const u_k = u + k * stride[NDIM] + stencils.offset[b];
+                V[data.depth * s + k] = stencils.full_stencil[b] ?
+                                            interpolate_point<W, true>(w, istart, istop, u_k, stride) :
+                                            interpolate_point<W, false>(w, istart, istop, u_k, stride);
+            }
+        }
+    }
+    return;
+} // interpolate_with_kernel
+
+template <class Kernel>
+void
+spread_with_kernel(const Kernel& kernel, double* const u, const double* const V, const InteractionData& data)
 {
-    r = std::abs(r);
-    if (r < 1.0)
+    static constexpr int W = Kernel::width;
+    int stride[NDIM + 1];
+    compute_strides(data, stride);
+    double vol = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        const double t2 = r * r;
-        const double t6 = std::sqrt(-0.4e1 * t2 + 0.4e1 * r + 0.1e1);
-        return -r / 0.4e1 + 0.3e1 / 0.8e1 + t6 / 0.8e1;
+        vol *= data.dx[d];
     }
-    else if (r < 2.0)
+    StencilBatch<W> stencils;
+    double w[NDIM][W];
+    int istart[NDIM], istop[NDIM];
+    for (int l_begin = 0; l_begin < data.num_indices; l_begin += BATCH_SIZE)
     {
-        const double t2 = r * r;
-        const double t6 = std::sqrt(0.12e2 * r - 0.7e1 - 0.4e1 * t2);
-        return -r / 0.4e1 + 0.5e1 / 0.8e1 - t6 / 0.8e1;
+        const int num_points = std::min(BATCH_SIZE, data.num_indices - l_begin);
+        compute_stencils(kernel, data, l_begin, num_points, stride, stencils);
+        for (int b = 0; b < num_points; ++b)
+        {
+            const int s = data.indices[l_begin + b];
+            unpack_stencil(stencils, b, w, istart, istop);
+            for (int k = 0; k < data.depth; ++k)
+            {
+                double* const u_k = u + k * stride[NDIM] + stencils.offset[b];
+                const double V_k = V[data.depth * s + k] / vol;
+                if (stencils.full_stencil[b])
+                {
+                    spread_point<W, true>(w, istart, istop, V_k, u_k, stride);
+                }
+                else
+                {
+                    spread_point<W, false>(w, istart, istop, V_k, u_k, stride);
+                }
+            }
+        }
+    }
+    return;
+} // spread_with_kernel
+
+// Apply an operation to the kernel with the specified name.  Returns false if
+// the kernel name is unknown.
+template <class Operation>
+bool
+apply_kernel(const std::string& kernel_fcn, const int axis, const Operation& op)
+{
+    if (kernel_fcn == "PIECEWISE_CONSTANT")
+        op(PiecewiseConstantKernel());
+    else if (kernel_fcn == "DISCONTINUOUS_LINEAR")
+        op(DiscontinuousLinearKernel(axis));
+    else if (kernel_fcn == "PIECEWISE_LINEAR")
+        op(PiecewiseLinearKernel());
+    else if (kernel_fcn == "PIECEWISE_CUBIC")
+        op(PiecewiseCubicKernel());
+    else if (kernel_fcn == "IB_3")
+        op(IB3Kernel());
+    else if (kernel_fcn == "IB_4")
+        op(IB4Kernel());
+    else if (kernel_fcn == "IB_4_W8")
+        op(IB4W8Kernel());
+    else if (kernel_fcn == "IB_5")
+        op(IB5Kernel());
+    else if (kernel_fcn == "IB_6")
+        op(IB6Kernel());
+    else if (kernel_fcn == "BSPLINE_3")
+        op(BSpline3Kernel());
+    else if (kernel_fcn == "BSPLINE_4")
+        op(BSpline4Kernel());
+    else if (kernel_fcn == "BSPLINE_5")
+        op(BSpline5Kernel());
+    else if (kernel_fcn == "BSPLINE_6")
+        op(BSpline6Kernel());
+    else if (kernel_fcn == "USER_DEFINED")
+    {
+        if (LEInteractor::s_kernel_fcn_stencil_size > UserDefinedKernel::width)
+        {
+            TBOX_ERROR("LEInteractor: user-defined kernel stencil size "
+                       << LEInteractor::s_kernel_fcn_stencil_size << " exceeds the maximum supported stencil size "
+                       << UserDefinedKernel::width << std::endl);
+        }
+        op(UserDefinedKernel(LEInteractor::s_kernel_fcn, LEInteractor::s_kernel_fcn_stencil_size));
     }
     else
+        return false;
+    return true;
+} // apply_kernel
+
+struct InterpolateOperation
+{
+    template <class Kernel>
+    void operator()(const Kernel& kernel) const
     {
-        return 0.0;
+        interpolate_with_kernel(kernel, V, u, data);
     }
-}
 
-inline int
-NINT(double a)
+    double* const V;
+    const double* const u;
+    const InteractionData& data;
+};
+
+struct SpreadOperation
 {
-    return (a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5));
-}
+    template <class Kernel>
+    void operator()(const Kernel& kernel) const
+    {
+        spread_with_kernel(kernel, u, V, data);
+    }
+
+    double* const u;
+    const double* const V;
+    const InteractionData& data;
+};
 
 using Weight = boost::multi_array<double, 1>;
 using TensorProductWeights = std::array<Weight, NDIM>;
@@ -1314,10 +1191,31 @@ spread_data(const int stencil_sz,
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+int LEInteractor::s_num_spread_threads = 1;
+int LEInteractor::s_min_threaded_spread_size = 1024;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("num_spread_threads")) s_num_spread_threads = db->getInteger("num_spread_threads");
+    if (db->keyExists("min_threaded_spread_size"))
+        s_min_threaded_spread_size = db->getInteger("min_threaded_spread_size");
+#ifdef _OPENMP
+    if (s_num_spread_threads == 0) s_num_spread_threads = omp_get_max_threads();
+#else
+    if (s_num_spread_threads != 1)
+    {
+        TBOX_WARNING("LEInteractor::setFromDatabase():\n"
+                     << "  IBTK was not compiled with OpenMP support; threaded spreading is disabled.\n");
+        s_num_spread_threads = 1;
+    }
+#endif
+    if (s_num_spread_threads < 1)
+    {
+        TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                   << "  num_spread_threads must be at least 1, or 0 to use all available OpenMP threads.\n");
+    }
     return;
 }
 
@@ -1325,6 +1223,8 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_num_spread_threads = " << s_num_spread_threads << "\n";
+    os << "  s_min_threaded_spread_size = " << s_min_threaded_spread_size << "\n";
     return;
 }
 
@@ -3676,476 +3576,51 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
 }
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
-
-void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const double* const q_data,
-                          const Box<NDIM>& q_data_box,
-                          const IntVector<NDIM>& q_gcw,
-                          const int q_depth,
-                          const double* const x_lower,
-                          const double* const x_upper,
-                          const double* const dx,
-                          const std::array<int, NDIM>& /*patch_touches_lower_physical_bdry*/,
-                          const std::array<int, NDIM>& /*patch_touches_upper_physical_bdry*/,
-                          const std::vector<int>& local_indices,
-                          const std::vector<double>& periodic_shifts,
-                          const std::string& interp_fcn,
-                          const int axis)
-{
-    const int stencil_size = getStencilSize(interp_fcn);
-    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
-    const int q_gcw_min = q_gcw.min();
-    if (q_gcw_min < min_ghosts)
-    {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells:"
-                   << "  kernel function          = " << interp_fcn << "\n"
-                   << "  kernel stencil size      = " << stencil_size << "\n"
-                   << "  minimum ghost cell width = " << min_ghosts << "\n"
-                   << "  ghost cell width         = " << q_gcw_min << "\n");
-    }
-    if (local_indices.empty()) return;
-    const int local_indices_size = static_cast<int>(local_indices.size());
-    const IntVector<NDIM>& ilower = q_data_box.lower();
-    const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (interp_fcn == "PIECEWISE_CONSTANT")
-    {
-        LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC(dx,
-                                                x_lower,
-                                                x_upper,
-                                                q_depth,
-#if (NDIM == 2)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                q_gcw(0),
-                                                q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                ilower(2),
-                                                iupper(2),
-                                                q_gcw(0),
-                                                q_gcw(1),
-                                                q_gcw(2),
-#endif
-                                                q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
-                                                X_data,
-                                                Q_data);
-    }
-    else if (interp_fcn == "DISCONTINUOUS_LINEAR")
-    {
-        LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP_FC(dx,
-                                                  x_lower,
-                                                  x_upper,
-                                                  q_depth,
-                                                  axis,
-#if (NDIM == 2)
-                                                  ilower(0),
-                                                  iupper(0),
-                                                  ilower(1),
-                                                  iupper(1),
-                                                  q_gcw(0),
-                                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                                  ilower(0),
-                                                  iupper(0),
-                                                  ilower(1),
-                                                  iupper(1),
-                                                  ilower(2),
-                                                  iupper(2),
-                                                  q_gcw(0),
-                                                  q_gcw(1),
-                                                  q_gcw(2),
-#endif
-                                                  q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
-                                                  X_data,
-                                                  Q_data);
-    }
-    else if (interp_fcn == "PIECEWISE_LINEAR")
-    {
-        LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC(dx,
-                                              x_lower,
-                                              x_upper,
-                                              q_depth,
-#if (NDIM == 2)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              q_gcw(0),
-                                              q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              ilower(2),
-                                              iupper(2),
-                                              q_gcw(0),
-                                              q_gcw(1),
-                                              q_gcw(2),
-#endif
-                                              q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
-                                              X_data,
-                                              Q_data);
-    }
-    else if (interp_fcn == "PIECEWISE_CUBIC")
-    {
-        LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC(dx,
-                                             x_lower,
-                                             x_upper,
-                                             q_depth,
-#if (NDIM == 2)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             q_gcw(0),
-                                             q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             ilower(2),
-                                             iupper(2),
-                                             q_gcw(0),
-                                             q_gcw(1),
-                                             q_gcw(2),
-#endif
-                                             q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
-                                             X_data,
-                                             Q_data);
-    }
-    else if (interp_fcn == "IB_3")
-    {
-        LAGRANGIAN_IB_3_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "IB_4")
-    {
-        LAGRANGIAN_IB_4_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "IB_4_W8")
-    {
-        LAGRANGIAN_IB_4_W8_INTERP_FC(dx,
-                                     x_lower,
-                                     x_upper,
-                                     q_depth,
-#if (NDIM == 2)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     q_gcw(0),
-                                     q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     ilower(2),
-                                     iupper(2),
-                                     q_gcw(0),
-                                     q_gcw(1),
-                                     q_gcw(2),
-#endif
-                                     q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
-                                     X_data,
-                                     Q_data);
-    }
-    else if (interp_fcn == "IB_5")
-    {
-        LAGRANGIAN_IB_5_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "IB_6")
-    {
-        LAGRANGIAN_IB_6_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_3")
-    {
-        LAGRANGIAN_BSPLINE_3_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_4")
-    {
-        LAGRANGIAN_BSPLINE_4_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_5")
-    {
-        LAGRANGIAN_BSPLINE_5_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_6")
-    {
-        LAGRANGIAN_BSPLINE_6_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "USER_DEFINED")
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int /*Q_depth*/,
+                          const double* const X_data,
+                          const double* const q_data,
+                          const Box<NDIM>& q_data_box,
+                          const IntVector<NDIM>& q_gcw,
+                          const int q_depth,
+                          const double* const x_lower,
+                          const double* const /*x_upper*/,
+                          const double* const dx,
+                          const std::array<int, NDIM>& /*patch_touches_lower_physical_bdry*/,
+                          const std::array<int, NDIM>& /*patch_touches_upper_physical_bdry*/,
+                          const std::vector<int>& local_indices,
+                          const std::vector<double>& periodic_shifts,
+                          const std::string& interp_fcn,
+                          const int axis)
+{
+    const int stencil_size = getStencilSize(interp_fcn);
+    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const int q_gcw_min = q_gcw.min();
+    if (q_gcw_min < min_ghosts)
     {
-        userDefinedInterpolate(Q_data,
-                               Q_depth,
-                               X_data,
-                               q_data,
-                               q_data_box,
-                               q_gcw,
-                               q_depth,
-                               x_lower,
-                               x_upper,
-                               dx,
-                               &local_indices[0],
-                               &periodic_shifts[0],
-                               local_indices_size);
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells:"
+                   << "  kernel function          = " << interp_fcn << "\n"
+                   << "  kernel stencil size      = " << stencil_size << "\n"
+                   << "  minimum ghost cell width = " << min_ghosts << "\n"
+                   << "  ghost cell width         = " << q_gcw_min << "\n");
     }
-    else
+    if (local_indices.empty()) return;
+    const int local_indices_size = static_cast<int>(local_indices.size());
+    const InteractionData data{ X_data,
+                                &local_indices[0],
+                                &periodic_shifts[0],
+                                local_indices_size,
+                                q_data_box.lower(),
+                                q_data_box.upper(),
+                                q_gcw,
+                                q_depth,
+                                x_lower,
+                                dx };
+    if (!apply_kernel(interp_fcn, axis, InterpolateOperation{ Q_data, q_data, data }))
     {
         TBOX_ERROR("LEInteractor::interpolate()\n"
                    << "  Unknown interpolation kernel function " << interp_fcn << std::endl);
@@ -4190,445 +3665,172 @@ LEInteractor::spread(double* const q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
-    const IntVector<NDIM>& ilower = q_data_box.lower();
-    const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (spread_fcn == "PIECEWISE_CONSTANT")
-    {
-        LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC(dx,
-                                                x_lower,
-                                                x_upper,
-                                                q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
-                                                X_data,
-                                                Q_data,
-#if (NDIM == 2)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                q_gcw(0),
-                                                q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                ilower(2),
-                                                iupper(2),
-                                                q_gcw(0),
-                                                q_gcw(1),
-                                                q_gcw(2),
-#endif
-                                                q_data);
-    }
-    else if (spread_fcn == "DISCONTINUOUS_LINEAR")
-    {
-        LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD_FC(dx,
-                                                  x_lower,
-                                                  x_upper,
-                                                  q_depth,
-                                                  axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
-                                                  X_data,
-                                                  Q_data,
-#if (NDIM == 2)
-                                                  ilower(0),
-                                                  iupper(0),
-                                                  ilower(1),
-                                                  iupper(1),
-                                                  q_gcw(0),
-                                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                                  ilower(0),
-                                                  iupper(0),
-                                                  ilower(1),
-                                                  iupper(1),
-                                                  ilower(2),
-                                                  iupper(2),
-                                                  q_gcw(0),
-                                                  q_gcw(1),
-                                                  q_gcw(2),
-#endif
-                                                  q_data);
-    }
-    else if (spread_fcn == "PIECEWISE_LINEAR")
-    {
-        LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC(dx,
-                                              x_lower,
-                                              x_upper,
-                                              q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
-                                              X_data,
-                                              Q_data,
-#if (NDIM == 2)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              q_gcw(0),
-                                              q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              ilower(2),
-                                              iupper(2),
-                                              q_gcw(0),
-                                              q_gcw(1),
-                                              q_gcw(2),
-#endif
-                                              q_data);
-    }
-    else if (spread_fcn == "PIECEWISE_CUBIC")
-    {
-        LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC(dx,
-                                             x_lower,
-                                             x_upper,
-                                             q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
-                                             X_data,
-                                             Q_data,
-#if (NDIM == 2)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             q_gcw(0),
-                                             q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             ilower(2),
-                                             iupper(2),
-                                             q_gcw(0),
-                                             q_gcw(1),
-                                             q_gcw(2),
-#endif
-                                             q_data);
-    }
-    else if (spread_fcn == "IB_3")
-    {
-        LAGRANGIAN_IB_3_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
-    }
-    else if (spread_fcn == "IB_4")
-    {
-        LAGRANGIAN_IB_4_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
+#ifdef _OPENMP
+    if (s_num_spread_threads > 1 && local_indices_size >= s_min_threaded_spread_size && !omp_in_parallel())
+    {
+        spreadThreaded(q_data,
+                       q_data_box,
+                       q_gcw,
+                       q_depth,
+                       Q_data,
+                       Q_depth,
+                       X_data,
+                       x_lower,
+                       x_upper,
+                       dx,
+                       patch_touches_lower_physical_bdry,
+                       patch_touches_upper_physical_bdry,
+                       local_indices,
+                       periodic_shifts,
+                       spread_fcn,
+                       axis);
+        return;
     }
-    else if (spread_fcn == "IB_4_W8")
+#else
+    NULL_USE(Q_depth);
+    NULL_USE(x_upper);
+#endif
+    const InteractionData data{ X_data,
+                                &local_indices[0],
+                                &periodic_shifts[0],
+                                local_indices_size,
+                                q_data_box.lower(),
+                                q_data_box.upper(),
+                                q_gcw,
+                                q_depth,
+                                x_lower,
+                                dx };
+    if (!apply_kernel(spread_fcn, axis, SpreadOperation{ q_data, Q_data, data }))
     {
-        LAGRANGIAN_IB_4_W8_SPREAD_FC(dx,
-                                     x_lower,
-                                     x_upper,
-                                     q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
-                                     X_data,
-                                     Q_data,
-#if (NDIM == 2)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     q_gcw(0),
-                                     q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     ilower(2),
-                                     iupper(2),
-                                     q_gcw(0),
-                                     q_gcw(1),
-                                     q_gcw(2),
-#endif
-                                     q_data);
+        TBOX_ERROR("LEInteractor::spread()\n"
+                   << "  Unknown spreading kernel function " << spread_fcn << std::endl);
     }
-    else if (spread_fcn == "IB_5")
+    return;
+}
+
+void
+LEInteractor::spreadThreaded(double* const q_data,
+                             const Box<NDIM>& q_data_box,
+                             const IntVector<NDIM>& q_gcw,
+                             const int q_depth,
+                             const double* const Q_data,
+                             const int Q_depth,
+                             const double* const X_data,
+                             const double* const x_lower,
+                             const double* const x_upper,
+                             const double* const dx,
+                             const std::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                             const std::array<int, NDIM>& patch_touches_upper_physical_bdry,
+                             const std::vector<int>& local_indices,
+                             const std::vector<double>& periodic_shifts,
+                             const std::string& spread_fcn,
+                             const int axis)
+{
+    NULL_USE(Q_depth);
+    NULL_USE(x_upper);
+    NULL_USE(patch_touches_lower_physical_bdry);
+    NULL_USE(patch_touches_upper_physical_bdry);
+
+    // Partition the ghost box into tiles that are wider than the kernel
+    // stencil.  The tiles are colored by the parity of their tile indices, so
+    // that any two tiles of the same color are separated by at least one full
+    // tile and the spreading stencils of the nodes they contain are disjoint.
+    const int tile_width = getStencilSize(spread_fcn) + 1;
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    const hier::Index<NDIM>& ilower = q_data_box.lower();
+    std::array<int, NDIM> num_tiles;
+    int total_num_tiles = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        LAGRANGIAN_IB_5_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
+        num_tiles[d] = (ghost_box.numberCells(d) + tile_width - 1) / tile_width;
+        total_num_tiles *= num_tiles[d];
     }
-    else if (spread_fcn == "IB_6")
+
+    // Bin the nodes by tile.  Nodes that lie outside of the ghost box are
+    // assigned to the nearest boundary tile.
+    const int local_indices_size = static_cast<int>(local_indices.size());
+    std::vector<int> tile_offsets(total_num_tiles + 1, 0);
+    std::vector<int> node_tile(local_indices_size);
+    for (int k = 0; k < local_indices_size; ++k)
     {
-        LAGRANGIAN_IB_6_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
+        const int s = local_indices[k];
+        int tile = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const double X = X_data[NDIM * s + d] + periodic_shifts[NDIM * k + d];
+            const int i = static_cast<int>(std::floor((X - x_lower[d]) / dx[d])) + ilower(d);
+            const int t = std::min(std::max((i - ghost_box.lower(d)) / tile_width, 0), num_tiles[d] - 1);
+            tile = tile * num_tiles[d] + t;
+        }
+        node_tile[k] = tile;
+        ++tile_offsets[tile + 1];
     }
-    else if (spread_fcn == "BSPLINE_3")
+    for (int tile = 0; tile < total_num_tiles; ++tile)
     {
-        LAGRANGIAN_BSPLINE_3_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
+        tile_offsets[tile + 1] += tile_offsets[tile];
     }
-    else if (spread_fcn == "BSPLINE_4")
+    std::vector<int> tile_local_indices(local_indices_size);
+    std::vector<double> tile_periodic_shifts(NDIM * local_indices_size);
     {
-        LAGRANGIAN_BSPLINE_4_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
+        std::vector<int> tile_pos(tile_offsets.begin(), tile_offsets.end() - 1);
+        for (int k = 0; k < local_indices_size; ++k)
+        {
+            const int pos = tile_pos[node_tile[k]]++;
+            tile_local_indices[pos] = local_indices[k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                tile_periodic_shifts[NDIM * pos + d] = periodic_shifts[NDIM * k + d];
+            }
+        }
     }
-    else if (spread_fcn == "BSPLINE_5")
+
+    // Collect the nonempty tiles of each color.
+    static const int num_colors = 1 << NDIM;
+    std::array<std::vector<int>, num_colors> color_tiles;
+    for (int tile = 0; tile < total_num_tiles; ++tile)
     {
-        LAGRANGIAN_BSPLINE_5_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
+        if (tile_offsets[tile + 1] == tile_offsets[tile]) continue;
+        int color = 0, t = tile;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            color |= ((t % num_tiles[d]) % 2) << d;
+            t /= num_tiles[d];
+        }
+        color_tiles[color].push_back(tile);
     }
-    else if (spread_fcn == "BSPLINE_6")
+
+    // Spread the nodes in all tiles of a given color concurrently.  Because the
+    // stencils do not overlap within a color and because the colors are
+    // processed in a fixed order, the accumulation is race-free and the result
+    // is independent of the number of threads.
+    for (const std::vector<int>& tiles : color_tiles)
     {
-        LAGRANGIAN_BSPLINE_6_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
+        const int num_color_tiles = static_cast<int>(tiles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(s_num_spread_threads)
 #endif
-                                       q_data);
-    }
-    else if (spread_fcn == "USER_DEFINED")
-    {
-        userDefinedSpread(q_data,
-                          q_data_box,
-                          q_gcw,
-                          q_depth,
-                          x_lower,
-                          x_upper,
-                          dx,
-                          Q_data,
-                          Q_depth,
-                          X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
-                          local_indices_size);
-    }
-    else
-    {
-        TBOX_ERROR("LEInteractor::spread()\n"
-                   << "  Unknown spreading kernel function " << spread_fcn << std::endl);
+        for (int n = 0; n < num_color_tiles; ++n)
+        {
+            // Call the serial kernel directly rather than spread(): inside a
+            // team of one thread omp_in_parallel() is false, so spread() would
+            // re-enter this function for large tiles.
+            const int tile = tiles[n];
+            const InteractionData data{ X_data,
+                                        &tile_local_indices[tile_offsets[tile]],
+                                        &tile_periodic_shifts[NDIM * tile_offsets[tile]],
+                                        tile_offsets[tile + 1] - tile_offsets[tile],
+                                        q_data_box.lower(),
+                                        q_data_box.upper(),
+                                        q_gcw,
+                                        q_depth,
+                                        x_lower,
+                                        dx };
+            if (!apply_kernel(spread_fcn, axis, SpreadOperation{ q_data, Q_data, data }))
+            {
+                TBOX_ERROR("LEInteractor::spreadThreaded()\n"
+                           << "  Unknown spreading kernel function " << spread_fcn << std::endl);
+            }
+        }
     }
     return;
 }
@@ -4737,433 +3939,4 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
     return;
 }
 
-void
-LEInteractor::userDefinedInterpolate(double* Q,
-                                     const int Q_depth,
-                                     const double* const X,
-                                     const double* const q,
-                                     const Box<NDIM>& q_data_box,
-                                     const int* const q_gcw,
-                                     const int q_depth,
-                                     const double* const x_lower,
-                                     const double* const /*x_upper*/,
-                                     const double* const dx,
-                                     const int* const local_indices,
-                                     const double* const X_shift,
-                                     const int num_local_indices)
-{
-    const int* const ilower = q_data_box.lower();
-    const int* const iupper = q_data_box.upper();
-    using range = boost::multi_array_types::extent_range;
-    boost::const_multi_array_ref<double, NDIM + 1> q_data(
-        q,
-        (boost::extents[range(ilower[0] - q_gcw[0], iupper[0] + q_gcw[0] + 1)]
-                       [range(ilower[1] - q_gcw[1], iupper[1] + q_gcw[1] + 1)]
-#if (NDIM == 3)
-                       [range(ilower[2] - q_gcw[2], iupper[2] + q_gcw[2] + 1)]
-#endif
-                       [range(0, q_depth)]),
-        boost::fortran_storage_order());
-    std::array<double, NDIM> X_cell;
-    std::array<int, NDIM> stencil_center, stencil_lower, stencil_upper;
-    for (int l = 0; l < num_local_indices; ++l)
-    {
-        const int s = local_indices[l];
-
-        // Determine the Cartesian cell in which X(s) is located.
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            stencil_center[d] =
-                static_cast<int>(std::floor((X[d + s * NDIM] + X_shift[d + l * NDIM] - x_lower[d]) / dx[d])) +
-                ilower[d];
-            X_cell[d] = x_lower[d] + (static_cast<double>(stencil_center[d] - ilower[d]) + 0.5) * dx[d];
-        }
-
-        // Determine the interpolation stencil corresponding to the position of
-        // X(s) within the cell.
-        if (s_kernel_fcn_stencil_size % 2 == 0)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                if (X[d + s * NDIM] < X_cell[d])
-                {
-                    stencil_lower[d] = stencil_center[d] - s_kernel_fcn_stencil_size / 2;
-                    stencil_upper[d] = stencil_center[d] + s_kernel_fcn_stencil_size / 2 - 1;
-                }
-                else
-                {
-                    stencil_lower[d] = stencil_center[d] - s_kernel_fcn_stencil_size / 2 + 1;
-                    stencil_upper[d] = stencil_center[d] + s_kernel_fcn_stencil_size / 2;
-                }
-            }
-        }
-        else
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                stencil_lower[d] = stencil_center[d] - s_kernel_fcn_stencil_size / 2;
-                stencil_upper[d] = stencil_center[d] + s_kernel_fcn_stencil_size / 2;
-            }
-        }
-
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            stencil_lower[d] = std::min(std::max(stencil_lower[d], ilower[d] - q_gcw[d]), iupper[d] + q_gcw[d]);
-            stencil_upper[d] = std::min(std::max(stencil_upper[d], ilower[d] - q_gcw[d]), iupper[d] + q_gcw[d]);
-        }
-
-        // Compute the kernel function weights.
-        boost::multi_array<double, 1> w0(boost::extents[range(stencil_lower[0], stencil_upper[0] + 1)]);
-        for (int ic0 = stencil_lower[0]; ic0 <= stencil_upper[0]; ++ic0)
-        {
-            w0[ic0] = s_kernel_fcn((X[0 + s * NDIM] + X_shift[0 + l * NDIM] -
-                                    (X_cell[0] + static_cast<double>(ic0 - stencil_center[0]) * dx[0])) /
-                                   dx[0]);
-        }
-
-        boost::multi_array<double, 1> w1(boost::extents[range(stencil_lower[1], stencil_upper[1] + 1)]);
-        for (int ic1 = stencil_lower[1]; ic1 <= stencil_upper[1]; ++ic1)
-        {
-            w1[ic1] = s_kernel_fcn((X[1 + s * NDIM] + X_shift[1 + l * NDIM] -
-                                    (X_cell[1] + static_cast<double>(ic1 - stencil_center[1]) * dx[1])) /
-                                   dx[1]);
-        }
-#if (NDIM == 3)
-        boost::multi_array<double, 1> w2(boost::extents[range(stencil_lower[2], stencil_upper[2] + 1)]);
-        for (int ic2 = stencil_lower[2]; ic2 <= stencil_upper[2]; ++ic2)
-        {
-            w2[ic2] = s_kernel_fcn((X[2 + s * NDIM] + X_shift[2 + l * NDIM] -
-                                    (X_cell[2] + static_cast<double>(ic2 - stencil_center[2]) * dx[2])) /
-                                   dx[2]);
-        }
-#endif
-        // Interpolate u onto V.
-        for (int d = 0; d < Q_depth; ++d)
-        {
-            Q[d + s * Q_depth] = 0.0;
-#if (NDIM == 3)
-            for (int ic2 = stencil_lower[2]; ic2 <= stencil_upper[2]; ++ic2)
-            {
-#endif
-                for (int ic1 = stencil_lower[1]; ic1 <= stencil_upper[1]; ++ic1)
-                {
-                    for (int ic0 = stencil_lower[0]; ic0 <= stencil_upper[0]; ++ic0)
-                    {
-#if (NDIM == 2)
-                        Q[d + s * Q_depth] += w0[ic0] * w1[ic1] * q_data[ic0][ic1][d];
-#endif
-#if (NDIM == 3)
-                        Q[d + s * Q_depth] += w0[ic0] * w1[ic1] * w2[ic2] * q_data[ic0][ic1][ic2][d];
-#endif
-                    }
-                }
-#if (NDIM == 3)
-            }
-#endif
-        }
-    }
-    return;
-}
-
-void
-LEInteractor::userDefinedSpread(double* q,
-                                const Box<NDIM>& q_data_box,
-                                const int* const q_gcw,
-                                const int q_depth,
-                                const double* const x_lower,
-                                const double* const /*x_upper*/,
-                                const double* const dx,
-                                const double* const Q,
-                                const int Q_depth,
-                                const double* const X,
-                                const int* const local_indices,
-                                const double* const X_shift,
-                                const int num_local_indices)
-{
-    const int* const ilower = q_data_box.lower();
-    const int* const iupper = q_data_box.upper();
-    using range = boost::multi_array_types::extent_range;
-    boost::multi_array_ref<double, NDIM + 1> q_data(
-        q,
-        (boost::extents[range(ilower[0] - q_gcw[0], iupper[0] + q_gcw[0] + 1)]
-                       [range(ilower[1] - q_gcw[1], iupper[1] + q_gcw[1] + 1)]
-#if (NDIM == 3)
-                       [range(ilower[2] - q_gcw[2], iupper[2] + q_gcw[2] + 1)]
-#endif
-                       [range(0, q_depth)]),
-        boost::fortran_storage_order());
-    std::array<double, NDIM> X_cell;
-    std::array<int, NDIM> stencil_center, stencil_lower, stencil_upper;
-    for (int l = 0; l < num_local_indices; ++l)
-    {
-        const int s = local_indices[l];
-
-        // Determine the Cartesian cell in which X(s) is located.
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            stencil_center[d] =
-                static_cast<int>(std::floor((X[d + s * NDIM] + X_shift[d + l * NDIM] - x_lower[d]) / dx[d])) +
-                ilower[d];
-            X_cell[d] = x_lower[d] + (static_cast<double>(stencil_center[d] - ilower[d]) + 0.5) * dx[d];
-        }
-
-        // Determine the interpolation stencil corresponding to the position of
-        // X(s) within the cell.
-        if (s_kernel_fcn_stencil_size % 2 == 0)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                if (X[d + s * NDIM] < X_cell[d])
-                {
-                    stencil_lower[d] = stencil_center[d] - s_kernel_fcn_stencil_size / 2;
-                    stencil_upper[d] = stencil_center[d] + s_kernel_fcn_stencil_size / 2 - 1;
-                }
-                else
-                {
-                    stencil_lower[d] = stencil_center[d] - s_kernel_fcn_stencil_size / 2 + 1;
-                    stencil_upper[d] = stencil_center[d] + s_kernel_fcn_stencil_size / 2;
-                }
-            }
-        }
-        else
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                stencil_lower[d] = stencil_center[d] - s_kernel_fcn_stencil_size / 2;
-                stencil_upper[d] = stencil_center[d] + s_kernel_fcn_stencil_size / 2;
-            }
-        }
-
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            stencil_lower[d] = std::min(std::max(stencil_lower[d], ilower[d] - q_gcw[d]), iupper[d] + q_gcw[d]);
-            stencil_upper[d] = std::min(std::max(stencil_upper[d], ilower[d] - q_gcw[d]), iupper[d] + q_gcw[d]);
-        }
-
-        // Compute the kernel function weights.
-        boost::multi_array<double, 1> w0(boost::extents[range(stencil_lower[0], stencil_upper[0] + 1)]);
-        for (int ic0 = stencil_lower[0]; ic0 <= stencil_upper[0]; ++ic0)
-        {
-            w0[ic0] = s_kernel_fcn((X[0 + s * NDIM] + X_shift[0 + l * NDIM] -
-                                    (X_cell[0] + static_cast<double>(ic0 - stencil_center[0]) * dx[0])) /
-                                   dx[0]);
-        }
-
-        boost::multi_array<double, 1> w1(boost::extents[range(stencil_lower[1], stencil_upper[1] + 1)]);
-        for (int ic1 = stencil_lower[1]; ic1 <= stencil_upper[1]; ++ic1)
-        {
-            w1[ic1] = s_kernel_fcn((X[1 + s * NDIM] + X_shift[1 + l * NDIM] -
-                                    (X_cell[1] + static_cast<double>(ic1 - stencil_center[1]) * dx[1])) /
-                                   dx[1]);
-        }
-#if (NDIM == 3)
-        boost::multi_array<double, 1> w2(boost::extents[range(stencil_lower[2], stencil_upper[2] + 1)]);
-        for (int ic2 = stencil_lower[2]; ic2 <= stencil_upper[2]; ++ic2)
-        {
-            w2[ic2] = s_kernel_fcn((X[2 + s * NDIM] + X_shift[2 + l * NDIM] -
-                                    (X_cell[2] + static_cast<double>(ic2 - stencil_center[2]) * dx[2])) /
-                                   dx[2]);
-        }
-#endif
-        // Spread V onto u.
-        for (int d = 0; d < Q_depth; ++d)
-        {
-#if (NDIM == 3)
-            for (int ic2 = stencil_lower[2]; ic2 <= stencil_upper[2]; ++ic2)
-            {
-#endif
-                for (int ic1 = stencil_lower[1]; ic1 <= stencil_upper[1]; ++ic1)
-                {
-                    for (int ic0 = stencil_lower[0]; ic0 <= stencil_upper[0]; ++ic0)
-                    {
-#if (NDIM == 2)
-                        q_data[ic0][ic1][d] += w0[ic0] * w1[ic1] * Q[d + s * Q_depth] / (dx[0] * dx[1]);
-#endif
-#if (NDIM == 3)
-                        q_data[ic0][ic1][ic2][d] +=
-                            w0[ic0] * w1[ic1] * w2[ic2] * Q[d + s * Q_depth] / (dx[0] * dx[1] * dx[2]);
-#endif
-                    }
-                }
-#if (NDIM == 3)
-            }
-#endif
-        }
-    }
-    return;
-}
-
-/////////////////////////////// NAMESPACE ////////////////////////////////////
-
-} // namespace IBTK
-
-/////////////////////////////// TEMPLATE INSTANTIATION ///////////////////////
-
-template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
-                                              const SAMRAI::tbox::Pointer<LData> X_data,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
-                                              const SAMRAI::tbox::Pointer<LData> X_data,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
-                                              const SAMRAI::tbox::Pointer<LData> X_data,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
-                                              const SAMRAI::tbox::Pointer<LData> X_data,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(double* const Q_data,
-                                              const int Q_depth,
-                                              const double* const X_data,
-                                              const int X_depth,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(double* const Q_data,
-                                              const int Q_depth,
-                                              const double* const X_data,
-                                              const int X_depth,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(double* const Q_data,
-                                              const int Q_depth,
-                                              const double* const X_data,
-                                              const int X_depth,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::interpolate(double* const Q_data,
-                                              const int Q_depth,
-                                              const double* const X_data,
-                                              const int X_depth,
-                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
-                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                              const SAMRAI::hier::Box<NDIM>& interp_box,
-                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                              const std::string& interp_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
-                                         const SAMRAI::tbox::Pointer<LData> Q_data,
-                                         const SAMRAI::tbox::Pointer<LData> X_data,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
-                                         const SAMRAI::tbox::Pointer<LData> Q_data,
-                                         const SAMRAI::tbox::Pointer<LData> X_data,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
-                                         const SAMRAI::tbox::Pointer<LData> Q_data,
-                                         const SAMRAI::tbox::Pointer<LData> X_data,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
-                                         const SAMRAI::tbox::Pointer<LData> Q_data,
-                                         const SAMRAI::tbox::Pointer<LData> X_data,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
-                                         const double* const Q_data,
-                                         const int Q_depth,
-                                         const double* const X_data,
-                                         const int X_depth,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
-                                         const double* const Q_data,
-                                         const int Q_depth,
-                                         const double* const X_data,
-                                         const int X_depth,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
-                                         const double* const Q_data,
-                                         const int Q_depth,
-                                         const double* const X_data,
-                                         const int X_depth,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
-                                         const double* const Q_data,
-                                         const int Q_depth,
-                                         const double* const X_data,
-                                         const int X_depth,
-                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
-                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                         const SAMRAI::hier::Box<NDIM>& spread_box,
-                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                         const std::string& spread_fcn);
-
-template void IBTK::LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
-                                                    std::vector<double>& periodic_shifts,
-                                                    const SAMRAI::hier::Box<NDIM>& box,
-                                                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                                                    const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
-                                                    const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data);
-
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,359 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/LHDF5DataWriter.h"
+#include "ibtk/hdf5_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "IntVector.h"
+#include "tbox/Utilities.h"
+
+#include "hdf5.h"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The names of the HDF5 and XDMF files.
+static const int HDF5_NAME_BUFSIZE = 128;
+static const std::string HDF5_FILE_PREFIX = "lag_data.cycle_";
+static const std::string HDF5_FILE_POSTFIX = ".h5";
+static const std::string XDMF_FILE_POSTFIX = ".xmf";
+
+/*!
+ * \brief The information about the datasets of a level that is required to
+ * describe its meshes in XDMF.
+ */
+struct XdmfLevelDescription
+{
+    std::string h5_level_path;
+    hsize_t num_nodes;
+    std::vector<std::string> var_names;
+    std::vector<int> var_plot_depths;
+};
+
+/*!
+ * \brief Describe a mesh whose nodes are a range of rows of the level
+ * datasets as an XDMF grid.
+ */
+std::string
+xdmf_grid(const std::string& name,
+          const std::string& topology,
+          const XdmfLevelDescription& level,
+          const hsize_t node_offset,
+          const hsize_t num_nodes)
+{
+    std::ostringstream os;
+    os << "<Grid Name=\"" << name << "\" GridType=\"Uniform\">\n" << topology;
+    os << "<Geometry GeometryType=\"" << (NDIM == 2 ? "XY" : "XYZ") << "\">\n"
+       << xdmf_hyperslab(level.h5_level_path + "/X", level.num_nodes, NDIM, node_offset, num_nodes, "Float", 8)
+       << "</Geometry>\n";
+    for (unsigned int v = 0; v < level.var_names.size(); ++v)
+    {
+        const int depth = level.var_plot_depths[v];
+        const char* const attribute_type = depth == 1 ? "Scalar" : (depth == NDIM ? "Vector" : "Matrix");
+        os << "<Attribute Name=\"" << level.var_names[v] << "\" AttributeType=\"" << attribute_type
+           << "\" Center=\"Node\">\n"
+           << xdmf_hyperslab(level.h5_level_path + "/" + level.var_names[v],
+                             level.num_nodes,
+                             depth,
+                             node_offset,
+                             num_nodes,
+                             "Float",
+                             8)
+           << "</Attribute>\n";
+    }
+    os << "</Grid>\n";
+    return os.str();
+} // xdmf_grid
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LHDF5DataWriter::LHDF5DataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart)
+    : LSiloDataWriter(std::move(object_name), std::move(dump_directory_name), register_for_restart)
+{
+    // intentionally blank
+    return;
+} // LHDF5DataWriter
+
+void
+LHDF5DataWriter::setChunkSize(const int chunk_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(chunk_size > 0);
+#endif
+    d_chunk_size = chunk_size;
+    return;
+} // setChunkSize
+
+void
+LHDF5DataWriter::setCompressionLevel(const int compression_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= compression_level && compression_level <= 9);
+#endif
+    d_compression_level = compression_level;
+    return;
+} // setCompressionLevel
+
+void
+LHDF5DataWriter::writePlotData(const int time_step_number, const double simulation_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(time_step_number >= 0);
+    TBOX_ASSERT(!d_dump_directory_name.empty());
+#endif
+
+    if (time_step_number <= d_time_step_number)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  time step number: " << time_step_number
+                                 << " is <= last time step number: " << d_time_step_number << std::endl);
+    }
+    d_time_step_number = time_step_number;
+
+    if (d_dump_directory_name.empty())
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  dump directory name is empty" << std::endl);
+    }
+
+    // The directory may be shared with an LSiloDataWriter that is still
+    // writing asynchronously.
+    waitForPendingWrites(d_dump_directory_name);
+
+    // Construct the VecScatter objects required to write the plot data.
+    updateVecScatters();
+
+    Utilities::recursiveMkdir(d_dump_directory_name);
+    char temp_buf[HDF5_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+    const std::string file_name = HDF5_FILE_PREFIX + temp_buf + HDF5_FILE_POSTFIX;
+    const std::string xdmf_file_name = HDF5_FILE_PREFIX + temp_buf + XDMF_FILE_POSTFIX;
+
+    // Collect the local data on each level and determine which rows of the
+    // level datasets are written by this process. The XDMF description of the
+    // local meshes is assembled at the same time.
+    std::vector<std::string> group_names;
+    std::vector<HDF5DatasetRows> datasets;
+    std::vector<std::vector<double> > X_vals(d_finest_ln + 1);
+    std::vector<std::vector<std::vector<double> > > plot_vals(d_finest_ln + 1);
+    std::vector<std::vector<int> > edges(d_finest_ln + 1);
+    std::string xdmf_grids;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (!d_coords_data[ln]) continue;
+
+        std::vector<std::vector<double> > var_vals;
+        getLocalPlotData(ln, X_vals[ln], var_vals);
+        const int num_local_nodes = static_cast<int>(X_vals[ln].size() / NDIM);
+
+        // Extract the plotted components of the variables.
+        plot_vals[ln].resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            const int start_depth = d_var_start_depths[ln][v];
+            const int plot_depth = d_var_plot_depths[ln][v];
+            const int depth = d_var_depths[ln][v];
+            plot_vals[ln][v].resize(plot_depth * num_local_nodes);
+            for (int i = 0; i < num_local_nodes; ++i)
+            {
+                for (int d = 0; d < plot_depth; ++d)
+                {
+                    plot_vals[ln][v][plot_depth * i + d] = var_vals[v][depth * i + start_depth + d];
+                }
+            }
+        }
+
+        // Determine the (pruned) edges of the local unstructured meshes in
+        // terms of the local indices of the mesh vertices.
+        std::vector<int> num_mesh_edges(d_nucd_meshes[ln]);
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
+            std::map<int, int> local_vertex_map;
+            for (int idx : vertices)
+            {
+                const int local_idx = static_cast<int>(local_vertex_map.size());
+                local_vertex_map[idx] = local_idx;
+            }
+            std::set<std::pair<int, int> > local_edge_set;
+            for (const auto& edge_pair : d_ucd_mesh_edge_maps[ln][mesh])
+            {
+                std::pair<int, int> e = edge_pair.second;
+                if (e.first > e.second) std::swap<int>(e.first, e.second);
+                local_edge_set.insert(e);
+            }
+            for (const auto& e : local_edge_set)
+            {
+                edges[ln].push_back(local_vertex_map[e.first]);
+                edges[ln].push_back(local_vertex_map[e.second]);
+            }
+            num_mesh_edges[mesh] = static_cast<int>(local_edge_set.size());
+        }
+        const int num_local_edges = static_cast<int>(edges[ln].size() / 2);
+
+        const std::pair<hsize_t, hsize_t> node_range = compute_hdf5_row_range(num_local_nodes);
+        const std::pair<hsize_t, hsize_t> edge_range = compute_hdf5_row_range(num_local_edges);
+        if (node_range.second == 0) continue;
+
+        const std::string level_path = "/level_" + std::to_string(ln);
+        group_names.push_back(level_path);
+        datasets.push_back({ level_path + "/X",
+                             H5T_NATIVE_DOUBLE,
+                             H5T_IEEE_F64LE,
+                             node_range.second,
+                             NDIM,
+                             node_range.first,
+                             static_cast<hsize_t>(num_local_nodes),
+                             X_vals[ln].data() });
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            datasets.push_back({ level_path + "/" + d_var_names[ln][v],
+                                 H5T_NATIVE_DOUBLE,
+                                 H5T_IEEE_F64LE,
+                                 node_range.second,
+                                 static_cast<hsize_t>(d_var_plot_depths[ln][v]),
+                                 node_range.first,
+                                 static_cast<hsize_t>(num_local_nodes),
+                                 plot_vals[ln][v].data() });
+        }
+        if (edge_range.second > 0)
+        {
+            datasets.push_back({ level_path + "/edges",
+                                 H5T_NATIVE_INT,
+                                 H5T_STD_I32LE,
+                                 edge_range.second,
+                                 2,
+                                 edge_range.first,
+                                 static_cast<hsize_t>(num_local_edges),
+                                 edges[ln].data() });
+        }
+
+        // Describe the local meshes, which are stored in the order in which
+        // they appear in the local data.
+        const XdmfLevelDescription level{
+            file_name + ":" + level_path, node_range.second, d_var_names[ln], d_var_plot_depths[ln]
+        };
+        std::ostringstream os;
+        hsize_t node_offset = node_range.first;
+        for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+        {
+            const int nmarks = d_cloud_nmarks[ln][cloud];
+            std::ostringstream topology;
+            topology << "<Topology TopologyType=\"Polyvertex\" NumberOfElements=\"" << nmarks
+                     << "\" NodesPerElement=\"1\"/>\n";
+            os << xdmf_grid(d_cloud_names[ln][cloud], topology.str(), level, node_offset, nmarks);
+            node_offset += nmarks;
+        }
+        auto block_topology = [](const IntVector<NDIM>& nelem) {
+            std::ostringstream topology;
+            topology << "<Topology TopologyType=\"" << NDIM << "DSMesh\" Dimensions=\"";
+            for (int d = NDIM - 1; d >= 0; --d) topology << nelem(d) << (d > 0 ? " " : "");
+            topology << "\"/>\n";
+            return topology.str();
+        };
+        for (int block = 0; block < d_nblocks[ln]; ++block)
+        {
+            const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
+            os << xdmf_grid(d_block_names[ln][block], block_topology(nelem), level, node_offset, nelem.getProduct());
+            node_offset += nelem.getProduct();
+        }
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            os << "<Grid Name=\"" << d_mb_names[ln][mb] << "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n";
+            for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
+            {
+                const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
+                os << xdmf_grid(d_mb_names[ln][mb] + "_block_" + std::to_string(block),
+                                block_topology(nelem),
+                                level,
+                                node_offset,
+                                nelem.getProduct());
+                node_offset += nelem.getProduct();
+            }
+            os << "</Grid>\n";
+        }
+        hsize_t edge_offset = edge_range.first;
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            const hsize_t num_vertices = d_ucd_mesh_vertices[ln][mesh].size();
+            std::ostringstream topology;
+            topology << "<Topology TopologyType=\"Polyline\" NodesPerElement=\"2\" NumberOfElements=\""
+                     << num_mesh_edges[mesh] << "\">\n"
+                     << xdmf_hyperslab(file_name + ":" + level_path + "/edges",
+                                       edge_range.second,
+                                       2,
+                                       edge_offset,
+                                       num_mesh_edges[mesh],
+                                       "Int",
+                                       4)
+                     << "</Topology>\n";
+            os << xdmf_grid(d_ucd_mesh_names[ln][mesh], topology.str(), level, node_offset, num_vertices);
+            node_offset += num_vertices;
+            edge_offset += num_mesh_edges[mesh];
+        }
+        xdmf_grids += os.str();
+    }
+
+    // Write the HDF5 file.
+    write_hdf5_datasets(
+        d_dump_directory_name + "/" + file_name, group_names, datasets, d_chunk_size, d_compression_level);
+
+    // Write the XDMF file on the root MPI process.
+    xdmf_grids = gather_strings_on_root(xdmf_grids);
+    if (IBTK_MPI::getRank() == 0)
+    {
+        std::ofstream xdmf_file((d_dump_directory_name + "/" + xdmf_file_name).c_str(), std::ios::out);
+        xdmf_file << "<?xml version=\"1.0\" ?>\n"
+                  << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+                  << "<Xdmf Version=\"2.0\">\n"
+                  << "<Domain>\n"
+                  << "<Grid Name=\"lag_data\" GridType=\"Collection\" CollectionType=\"Spatial\">\n"
+                  << "<Time Value=\"" << simulation_time << "\"/>\n"
+                  << xdmf_grids << "</Grid>\n"
+                  << "</Domain>\n"
+                  << "</Xdmf>\n";
+    }
+    IBTK_MPI::barrier();
+    return;
+} // writePlotData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
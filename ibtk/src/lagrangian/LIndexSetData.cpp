@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,26 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Interleave the bits of the (nonnegative) cell index components to obtain the
+// cell's position along the Morton (Z-order) space-filling curve.
+inline std::uint64_t
+morton_key(const std::array<std::uint32_t, NDIM>& i)
+{
+    static const int num_bits = 64 / NDIM;
+    std::uint64_t key = 0;
+    for (int b = 0; b < num_bits; ++b)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key |= static_cast<std::uint64_t>((i[d] >> b) & 1U) << (NDIM * b + d);
+        }
+    }
+    return key;
+} // morton_key
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 template <class T>
@@ -50,7 +71,9 @@ LIndexSetData<T>::LIndexSetData(Box<NDIM> box, IntVector<NDIM> ghosts) : LSetDat
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const bool use_morton_ordering)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -78,9 +101,38 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
     }
 
+    // Determine the order in which to visit the index sets.
+    std::vector<std::pair<CellIndex<NDIM>, const LSet<T>*> > idx_sets;
     for (typename LSetData<T>::SetIterator it(*this); it; it++)
     {
-        const CellIndex<NDIM>& i = it.getIndex();
+        idx_sets.emplace_back(it.getIndex(), &(*it));
+    }
+    if (use_morton_ordering)
+    {
+        const hier::Index<NDIM>& ghost_lower = this->getGhostBox().lower();
+        std::vector<std::pair<std::uint64_t, std::size_t> > keys(idx_sets.size());
+        for (std::size_t k = 0; k < idx_sets.size(); ++k)
+        {
+            std::array<std::uint32_t, NDIM> i;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                i[d] = static_cast<std::uint32_t>(idx_sets[k].first(d) - ghost_lower(d));
+            }
+            keys[k] = std::make_pair(morton_key(i), k);
+        }
+        std::sort(keys.begin(), keys.end());
+        std::vector<std::pair<CellIndex<NDIM>, const LSet<T>*> > sorted_idx_sets;
+        sorted_idx_sets.reserve(idx_sets.size());
+        for (const auto& key : keys)
+        {
+            sorted_idx_sets.push_back(idx_sets[key.second]);
+        }
+        idx_sets.swap(sorted_idx_sets);
+    }
+
+    for (const auto& idx_set_pair : idx_sets)
+    {
+        const CellIndex<NDIM>& i = idx_set_pair.first;
         std::array<int, NDIM> offset;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -98,7 +150,7 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
                 offset[d] = 0;
             }
         }
-        const LSet<T>& idx_set = *it;
+        const LSet<T>& idx_set = *idx_set_pair.second;
         const bool patch_owns_idx_set = patch_box.contains(i);
         for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
         {
@@ -36,11 +36,15 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 // IWYU pragma: no_include "petsc-private/vecimpl.h"
@@ -57,9 +61,8 @@ namespace IBTK
 
 namespace
 {
-// The rank of the root MPI process and the MPI tag number.
+// The rank of the root MPI process.
 static const int SILO_MPI_ROOT = 0;
-static const int SILO_MPI_TAG = 0;
 
 // The name of the Silo dumps and database filenames.
 static const int SILO_NAME_BUFSIZE = 128;
@@ -74,6 +77,27 @@ static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
 #if defined(IBTK_HAVE_SILO)
+/*!
+ * \brief Exception used to report errors that occur while plot files are
+ * written.
+ *
+ * The files may be written on a separate thread, on which TBOX_ERROR cannot be
+ * used, so errors are handed back to the main thread and reported there.
+ */
+class SiloWriteError : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+#define IBTK_SILO_WRITE_ERROR(X)                                                                                       \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        std::ostringstream os;                                                                                         \
+        os << X;                                                                                                       \
+        throw SiloWriteError(os.str());                                                                                \
+    } while (0)
+
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
  * points.
@@ -124,8 +148,8 @@ build_local_marker_cloud(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
-                   << "  Could not set directory " << dirname << std::endl);
+        IBTK_SILO_WRITE_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+                              << "  Could not set directory " << dirname << std::endl);
     }
 
     // Write out the variables.
@@ -176,8 +200,8 @@ build_local_marker_cloud(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
-                   << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
+        IBTK_SILO_WRITE_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+                              << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
     }
     return;
 } // build_local_marker_cloud
@@ -287,8 +311,8 @@ build_local_curv_block(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
-                   << "  Could not set directory " << dirname << std::endl);
+        IBTK_SILO_WRITE_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+                              << "  Could not set directory " << dirname << std::endl);
     }
 
     // Write out the variables.
@@ -376,8 +400,8 @@ build_local_curv_block(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
-                   << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
+        IBTK_SILO_WRITE_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+                              << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
     }
     return;
 } // build_local_curv_block
@@ -469,8 +493,8 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
-                   << "  Could not set directory " << dirname << std::endl);
+        IBTK_SILO_WRITE_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+                              << "  Could not set directory " << dirname << std::endl);
     }
 
     // Node coordinates.
@@ -593,17 +617,598 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
-                   << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
+        IBTK_SILO_WRITE_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+                              << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
     }
     return;
 } // build_local_ucd_mesh
+
+/*!
+ * \brief The names and sizes of the meshes on one level of one MPI process
+ * that are needed to build the multimesh and multivar objects.
+ */
+struct LevelMeshMetadata
+{
+    std::vector<std::string> cloud_names, block_names, mb_names, ucd_mesh_names;
+    std::vector<int> mb_nblocks;
+};
+
+/*!
+ * \brief The local data and mesh descriptions of one level.
+ */
+struct LevelPlotData
+{
+    bool has_coords = false;
+    std::vector<double> X;
+    std::vector<std::vector<double> > var_vals;
+
+    LevelMeshMetadata names;
+    std::vector<int> cloud_nmarks;
+    std::vector<IntVector<NDIM> > block_nelems, block_periodic;
+    std::vector<std::vector<IntVector<NDIM> > > mb_nelems, mb_periodic;
+    std::vector<std::set<int> > ucd_mesh_vertices;
+    std::vector<std::multimap<int, std::pair<int, int> > > ucd_mesh_edge_maps;
+
+    int nvars = 0;
+    std::vector<std::string> var_names;
+    std::vector<int> var_start_depths, var_plot_depths, var_depths;
+};
+
+/*!
+ * \brief A copy of all of the data required to write one set of plot files,
+ * so that the files can be written while the simulation continues.
+ */
+struct PlotSnapshot
+{
+    std::string object_name;
+    int time_step_number = -1;
+    double simulation_time = 0.0;
+    std::string dump_directory_name, current_dump_directory_name, dump_dirname;
+    int mpi_rank = 0, mpi_nodes = 1;
+    int coarsest_ln = 0, finest_ln = 0;
+    std::vector<LevelPlotData> levels;
+
+    // Only set on the root MPI process: indexed by processor and then level.
+    std::vector<std::vector<LevelMeshMetadata> > metadata_per_proc;
+};
+
+void
+pack_int(std::vector<char>& buf, const int val)
+{
+    const char* const val_ptr = reinterpret_cast<const char*>(&val);
+    buf.insert(buf.end(), val_ptr, val_ptr + sizeof(int));
+} // pack_int
+
+void
+pack_strings(std::vector<char>& buf, const std::vector<std::string>& strs)
+{
+    pack_int(buf, static_cast<int>(strs.size()));
+    for (const std::string& str : strs)
+    {
+        pack_int(buf, static_cast<int>(str.size()));
+        buf.insert(buf.end(), str.begin(), str.end());
+    }
+} // pack_strings
+
+int
+unpack_int(const char*& ptr)
+{
+    int val;
+    std::memcpy(&val, ptr, sizeof(int));
+    ptr += sizeof(int);
+    return val;
+} // unpack_int
+
+std::vector<std::string>
+unpack_strings(const char*& ptr)
+{
+    std::vector<std::string> strs(unpack_int(ptr));
+    for (std::string& str : strs)
+    {
+        const int len = unpack_int(ptr);
+        str.assign(ptr, len);
+        ptr += len;
+    }
+    return strs;
+} // unpack_strings
+
+/*!
+ * \brief Collect the mesh names and sizes of all MPI processes on the root
+ * MPI process using a single gather operation.
+ */
+void
+gather_mesh_metadata(PlotSnapshot& snapshot)
+{
+    std::vector<char> send_buf;
+    for (int ln = snapshot.coarsest_ln; ln <= snapshot.finest_ln; ++ln)
+    {
+        const LevelMeshMetadata& names = snapshot.levels[ln].names;
+        pack_strings(send_buf, names.cloud_names);
+        pack_strings(send_buf, names.block_names);
+        pack_strings(send_buf, names.mb_names);
+        for (const int nblocks : names.mb_nblocks) pack_int(send_buf, nblocks);
+        pack_strings(send_buf, names.ucd_mesh_names);
+    }
+
+    const int mpi_nodes = snapshot.mpi_nodes;
+    const bool is_root = snapshot.mpi_rank == SILO_MPI_ROOT;
+    int send_size = static_cast<int>(send_buf.size());
+    std::vector<int> recv_sizes(is_root ? mpi_nodes : 0), recv_offsets(is_root ? mpi_nodes : 0);
+    MPI_Gather(&send_size, 1, MPI_INT, recv_sizes.data(), 1, MPI_INT, SILO_MPI_ROOT, IBTK_MPI::getCommunicator());
+    std::vector<char> recv_buf;
+    if (is_root)
+    {
+        int recv_size = 0;
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            recv_offsets[proc] = recv_size;
+            recv_size += recv_sizes[proc];
+        }
+        recv_buf.resize(recv_size);
+    }
+    MPI_Gatherv(send_buf.data(),
+                send_size,
+                MPI_CHAR,
+                recv_buf.data(),
+                recv_sizes.data(),
+                recv_offsets.data(),
+                MPI_CHAR,
+                SILO_MPI_ROOT,
+                IBTK_MPI::getCommunicator());
+    if (!is_root) return;
+
+    snapshot.metadata_per_proc.resize(mpi_nodes);
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        snapshot.metadata_per_proc[proc].resize(snapshot.finest_ln + 1);
+        const char* ptr = recv_buf.data() + recv_offsets[proc];
+        for (int ln = snapshot.coarsest_ln; ln <= snapshot.finest_ln; ++ln)
+        {
+            LevelMeshMetadata& names = snapshot.metadata_per_proc[proc][ln];
+            names.cloud_names = unpack_strings(ptr);
+            names.block_names = unpack_strings(ptr);
+            names.mb_names = unpack_strings(ptr);
+            names.mb_nblocks.resize(names.mb_names.size());
+            for (int& nblocks : names.mb_nblocks) nblocks = unpack_int(ptr);
+            names.ucd_mesh_names = unpack_strings(ptr);
+        }
+        TBOX_ASSERT(ptr == recv_buf.data() + recv_offsets[proc] + recv_sizes[proc]);
+    }
+    return;
+} // gather_mesh_metadata
+
+/*!
+ * \brief Write the local data of a snapshot to the DBfile of this MPI process.
+ */
+void
+write_local_plot_data(const PlotSnapshot& snapshot)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", snapshot.mpi_rank);
+    std::string current_file_name = snapshot.dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
+    current_file_name += temp_buf;
+    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+
+    DBfile* dbfile;
+    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    {
+        IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                   << "  Could not create DBfile named " << current_file_name
+                                                   << std::endl);
+    }
+
+    for (int ln = snapshot.coarsest_ln; ln <= snapshot.finest_ln; ++ln)
+    {
+        const LevelPlotData& level_data = snapshot.levels[ln];
+        if (!level_data.has_coords) continue;
+        const LevelMeshMetadata& names = level_data.names;
+
+        // Keep track of the current offset in the local data.
+        int offset = 0;
+        std::vector<const double*> var_vals(level_data.nvars);
+        auto set_var_vals = [&](const int first_idx) {
+            for (int v = 0; v < level_data.nvars; ++v)
+            {
+                var_vals[v] = level_data.var_vals[v].data() + level_data.var_depths[v] * first_idx;
+            }
+        };
+
+        // Add the local clouds to the local DBfile.
+        for (unsigned int cloud = 0; cloud < names.cloud_names.size(); ++cloud)
+        {
+            const int nmarks = level_data.cloud_nmarks[cloud];
+
+            std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                           << "  Could not create directory named " << dirname
+                                                           << std::endl);
+            }
+
+            set_var_vals(offset);
+            build_local_marker_cloud(dbfile,
+                                     dirname,
+                                     nmarks,
+                                     level_data.X.data() + NDIM * offset,
+                                     level_data.nvars,
+                                     level_data.var_names,
+                                     level_data.var_start_depths,
+                                     level_data.var_plot_depths,
+                                     level_data.var_depths,
+                                     var_vals,
+                                     snapshot.time_step_number,
+                                     snapshot.simulation_time);
+
+            offset += nmarks;
+        }
+
+        // Add the local blocks to the local DBfile.
+        for (unsigned int block = 0; block < names.block_names.size(); ++block)
+        {
+            const IntVector<NDIM>& nelem = level_data.block_nelems[block];
+            const IntVector<NDIM>& periodic = level_data.block_periodic[block];
+            const int ntot = nelem.getProduct();
+
+            std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                           << "  Could not create directory named " << dirname
+                                                           << std::endl);
+            }
+
+            set_var_vals(offset);
+            build_local_curv_block(dbfile,
+                                   dirname,
+                                   nelem,
+                                   periodic,
+                                   level_data.X.data() + NDIM * offset,
+                                   level_data.nvars,
+                                   level_data.var_names,
+                                   level_data.var_start_depths,
+                                   level_data.var_plot_depths,
+                                   level_data.var_depths,
+                                   var_vals,
+                                   snapshot.time_step_number,
+                                   snapshot.simulation_time);
+
+            offset += ntot;
+        }
+
+        // Add the local multiblocks to the local DBfile.
+        for (unsigned int mb = 0; mb < names.mb_names.size(); ++mb)
+        {
+            for (int block = 0; block < names.mb_nblocks[mb]; ++block)
+            {
+                const IntVector<NDIM>& nelem = level_data.mb_nelems[mb][block];
+                const IntVector<NDIM>& periodic = level_data.mb_periodic[mb][block];
+                const int ntot = nelem.getProduct();
+
+                std::string dirname =
+                    "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                {
+                    IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                               << "  Could not create directory named " << dirname
+                                                               << std::endl);
+                }
+
+                set_var_vals(offset);
+                build_local_curv_block(dbfile,
+                                       dirname,
+                                       nelem,
+                                       periodic,
+                                       level_data.X.data() + NDIM * offset,
+                                       level_data.nvars,
+                                       level_data.var_names,
+                                       level_data.var_start_depths,
+                                       level_data.var_plot_depths,
+                                       level_data.var_depths,
+                                       var_vals,
+                                       snapshot.time_step_number,
+                                       snapshot.simulation_time);
+
+                offset += ntot;
+            }
+        }
+
+        // Add the local UCD meshes to the local DBfile.
+        for (unsigned int mesh = 0; mesh < names.ucd_mesh_names.size(); ++mesh)
+        {
+            const std::set<int>& vertices = level_data.ucd_mesh_vertices[mesh];
+            const std::multimap<int, std::pair<int, int> >& edge_map = level_data.ucd_mesh_edge_maps[mesh];
+            const size_t ntot = vertices.size();
+
+            std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                           << "  Could not create directory named " << dirname
+                                                           << std::endl);
+            }
+
+            set_var_vals(offset);
+            build_local_ucd_mesh(dbfile,
+                                 dirname,
+                                 vertices,
+                                 edge_map,
+                                 level_data.X.data() + NDIM * offset,
+                                 level_data.nvars,
+                                 level_data.var_names,
+                                 level_data.var_start_depths,
+                                 level_data.var_plot_depths,
+                                 level_data.var_depths,
+                                 var_vals,
+                                 snapshot.time_step_number,
+                                 snapshot.simulation_time);
+
+            offset += ntot;
+        }
+    }
+
+    DBClose(dbfile);
+    return;
+} // write_local_plot_data
+
+/*!
+ * \brief Write the multimesh and multivar objects of a snapshot to the
+ * summary DBfile and update the dumps file. Only called on the root MPI
+ * process.
+ */
+void
+write_plot_summary(const PlotSnapshot& snapshot)
+{
+    // Create and initialize the multimesh Silo database on the root MPI
+    // process.
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", snapshot.time_step_number);
+    std::string summary_file_name =
+        snapshot.dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+    DBfile* dbfile;
+    if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    {
+        IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                   << "  Could not create DBfile named " << summary_file_name
+                                                   << std::endl);
+    }
+
+    int cycle = snapshot.time_step_number;
+    auto time = static_cast<float>(snapshot.simulation_time);
+    double dtime = snapshot.simulation_time;
+
+    static const int MAX_OPTS = 3;
+    DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+    DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+    DBAddOption(optlist, DBOPT_TIME, &time);
+    DBAddOption(optlist, DBOPT_DTIME, &dtime);
+
+    for (int proc = 0; proc < snapshot.mpi_nodes; ++proc)
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
+        std::string current_file_name = SILO_PROCESSOR_FILE_PREFIX;
+        current_file_name += temp_buf;
+        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+
+        for (int ln = snapshot.coarsest_ln; ln <= snapshot.finest_ln; ++ln)
+        {
+            const LevelMeshMetadata& names = snapshot.metadata_per_proc[proc][ln];
+            const std::vector<std::string>& var_names = snapshot.levels[ln].var_names;
+
+            for (unsigned int cloud = 0; cloud < names.cloud_names.size(); ++cloud)
+            {
+                std::string meshname =
+                    current_file_name + ":level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud) + "/mesh";
+                auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_POINTMESH;
+
+                const std::string& cloud_name = names.cloud_names[cloud];
+
+                DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
+                {
+                    IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                               << "  Could not create directory named " << cloud_name
+                                                               << std::endl);
+                }
+            }
+
+            for (unsigned int block = 0; block < names.block_names.size(); ++block)
+            {
+                std::string meshname =
+                    current_file_name + ":level_" + std::to_string(ln) + "_block_" + std::to_string(block) + "/mesh";
+                auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_QUAD_CURV;
+
+                const std::string& block_name = names.block_names[block];
+
+                DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                if (DBMkDir(dbfile, block_name.c_str()) == -1)
+                {
+                    IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                               << "  Could not create directory named " << block_name
+                                                               << std::endl);
+                }
+            }
+
+            for (unsigned int mb = 0; mb < names.mb_names.size(); ++mb)
+            {
+                const int nblocks = names.mb_nblocks[mb];
+                std::vector<std::string> meshnames;
+                for (int block = 0; block < nblocks; ++block)
+                {
+                    meshnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
+                                        std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
+                }
+                std::vector<const char*> meshnames_ptrs;
+                for (int block = 0; block < nblocks; ++block)
+                {
+                    meshnames_ptrs.push_back(meshnames[block].c_str());
+                }
+                std::vector<int> meshtypes(nblocks, DB_QUAD_CURV);
+
+                const std::string& mb_name = names.mb_names[mb];
+
+                DBPutMultimesh(dbfile, mb_name.c_str(), nblocks, meshnames_ptrs.data(), meshtypes.data(), optlist);
+
+                if (DBMkDir(dbfile, mb_name.c_str()) == -1)
+                {
+                    IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                               << "  Could not create directory named " << mb_name
+                                                               << std::endl);
+                }
+            }
+
+            for (unsigned int mesh = 0; mesh < names.ucd_mesh_names.size(); ++mesh)
+            {
+                std::string meshname =
+                    current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
+                auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_UCDMESH;
+
+                const std::string& mesh_name = names.ucd_mesh_names[mesh];
+
+                DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
+                {
+                    IBTK_SILO_WRITE_ERROR(snapshot.object_name << "::writePlotData()\n"
+                                                               << "  Could not create directory named " << mesh_name
+                                                               << std::endl);
+                }
+            }
+
+            for (const std::string& var_name : var_names)
+            {
+                for (unsigned int cloud = 0; cloud < names.cloud_names.size(); ++cloud)
+                {
+                    std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
+                                          std::to_string(cloud) + "/" + var_name;
+                    auto varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_POINTVAR;
+
+                    std::string multivar_name = names.cloud_names[cloud] + "/" + var_name;
+
+                    DBPutMultivar(dbfile, multivar_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+
+                for (unsigned int block = 0; block < names.block_names.size(); ++block)
+                {
+                    std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
+                                          std::to_string(block) + "/" + var_name;
+                    auto varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_QUADVAR;
+
+                    std::string multivar_name = names.block_names[block] + "/" + var_name;
+
+                    DBPutMultivar(dbfile, multivar_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+
+                for (unsigned int mb = 0; mb < names.mb_names.size(); ++mb)
+                {
+                    const int nblocks = names.mb_nblocks[mb];
+
+                    std::vector<std::string> varnames;
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        varnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
+                                           std::to_string(mb) + "_block_" + std::to_string(block) + var_name);
+                    }
+                    std::vector<const char*> varnames_ptrs;
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        varnames_ptrs.push_back(varnames[block].c_str());
+                    }
+                    std::vector<int> vartypes(nblocks, DB_QUADVAR);
+
+                    std::string multivar_name = names.mb_names[mb] + "/" + var_name;
+
+                    DBPutMultivar(
+                        dbfile, multivar_name.c_str(), nblocks, varnames_ptrs.data(), vartypes.data(), optlist);
+                }
+
+                for (unsigned int mesh = 0; mesh < names.ucd_mesh_names.size(); ++mesh)
+                {
+                    std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" +
+                                          std::to_string(mesh) + "/" + var_name;
+                    auto varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_UCDVAR;
+
+                    std::string multivar_name = names.ucd_mesh_names[mesh] + "/" + var_name;
+
+                    DBPutMultivar(dbfile, multivar_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+            }
+        }
+    }
+
+    DBFreeOptlist(optlist);
+    DBClose(dbfile);
+
+    // Create or update the dumps file on the root MPI process.
+    static bool summary_file_opened = false;
+    std::string path = snapshot.dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", snapshot.time_step_number);
+    std::string file =
+        snapshot.current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+    if (!summary_file_opened)
+    {
+        summary_file_opened = true;
+        std::ofstream sfile(path.c_str(), std::ios::out);
+        sfile << file << std::endl;
+        sfile.close();
+    }
+    else
+    {
+        std::ofstream sfile(path.c_str(), std::ios::app);
+        sfile << file << std::endl;
+        sfile.close();
+    }
+    return;
+} // write_plot_summary
+
+/*!
+ * \brief Write all files of a snapshot. This function does not communicate
+ * and may therefore be run on a separate thread.
+ *
+ * \return An error message, which is empty if the files were written
+ * successfully.
+ */
+std::string
+write_plot_snapshot(const PlotSnapshot& snapshot)
+{
+    try
+    {
+        write_local_plot_data(snapshot);
+        if (snapshot.mpi_rank == SILO_MPI_ROOT) write_plot_summary(snapshot);
+    }
+    catch (const SiloWriteError& e)
+    {
+        return e.what();
+    }
+    return {};
+} // write_plot_snapshot
+
+#undef IBTK_SILO_WRITE_ERROR
 #endif // if defined(IBTK_HAVE_SILO)
 } // namespace
 
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+std::set<LSiloDataWriter*> LSiloDataWriter::s_data_writers;
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart)
+LSiloDataWriter::LSiloDataWriter(std::string object_name,
+                                 std::string dump_directory_name,
+                                 bool register_for_restart,
+                                 Pointer<Database> input_db)
     : d_object_name(std::move(object_name)),
       d_registered_for_restart(register_for_restart),
       d_dump_directory_name(std::move(dump_directory_name)),
@@ -644,6 +1249,13 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
 #else
     TBOX_WARNING("LSiloDataWriter::LSiloDataWriter(): SILO is not installed; cannot write data." << std::endl);
 #endif
+    if (input_db)
+    {
+        if (input_db->keyExists("write_asynchronously"))
+            d_write_asynchronously = input_db->getBool("write_asynchronously");
+    }
+    s_data_writers.insert(this);
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->registerRestartItem(d_object_name, this);
@@ -660,6 +1272,9 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    waitForPendingWrites();
+    s_data_writers.erase(this);
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -1167,6 +1782,44 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
     return;
 } // registerLagrangianAO
 
+bool
+LSiloDataWriter::getAsynchronousWritesEnabled() const
+{
+    return d_write_asynchronously;
+} // getAsynchronousWritesEnabled
+
+void
+LSiloDataWriter::waitForPendingWrites()
+{
+    if (d_write_thread.joinable()) d_write_thread.join();
+    if (!d_write_error.empty())
+    {
+        const std::string write_error = std::move(d_write_error);
+        d_write_error.clear();
+        TBOX_ERROR(d_object_name << "::waitForPendingWrites()\n"
+                                 << "  asynchronous write of plot data failed:\n"
+                                 << write_error);
+    }
+    return;
+} // waitForPendingWrites
+
+void
+LSiloDataWriter::waitForAllPendingWrites()
+{
+    for (LSiloDataWriter* const data_writer : s_data_writers) data_writer->waitForPendingWrites();
+    return;
+} // waitForAllPendingWrites
+
+void
+LSiloDataWriter::waitForPendingWrites(const std::string& dump_directory_name)
+{
+    for (LSiloDataWriter* const data_writer : s_data_writers)
+    {
+        if (data_writer->d_dump_directory_name == dump_directory_name) data_writer->waitForPendingWrites();
+    }
+    return;
+} // waitForPendingWrites
+
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1176,6 +1829,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     TBOX_ASSERT(!d_dump_directory_name.empty());
 #endif
 
+    // Silo is not thread-safe: finish writing any previous snapshot, including
+    // the ones of other data writers, before doing anything else.
+    waitForAllPendingWrites();
+
     if (time_step_number <= d_time_step_number)
     {
         TBOX_ERROR(d_object_name << "::writePlotData()\n"
@@ -1192,22 +1849,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                                  << "  dump directory name is empty" << std::endl);
     }
 
-    int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
-    const int mpi_rank = IBTK_MPI::getRank();
-    const int mpi_nodes = IBTK_MPI::getNodes();
 
     // Construct the VecScatter objects required to write the plot data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        if (d_build_vec_scatters[ln])
-        {
-            buildVecScatters(d_ao[ln], ln);
-        }
-        d_build_vec_scatters[ln] = false;
-    }
+    updateVecScatters();
 
     // Create the working directory.
     std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
@@ -1216,747 +1861,65 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
-    {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named " << current_file_name << std::endl);
-    }
-
-    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
-    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
-
-    // Set the local data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        if (d_coords_data[ln])
-        {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
-            IBTK_CHKERRQ(ierr);
-
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
-
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
-
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
-            }
-
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
-
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
-            }
-
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
-            {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
-
-                offset += ntot;
-            }
-
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
-                {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
-
-                    std::string dirname =
-                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
-
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << dirname << std::endl);
-                    }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
-                    {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                    }
-
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
-                }
-            }
-
-            // Add the local UCD meshes to the local DBfile.
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
-            }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
-    }
-
-    DBClose(dbfile);
-
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
-
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
-    }
-
+    // Copy everything that is needed to write the plot files so that the
+    // files may be written while the simulation continues.
+    auto snapshot = std::make_shared<PlotSnapshot>();
+    snapshot->object_name = d_object_name;
+    snapshot->time_step_number = time_step_number;
+    snapshot->simulation_time = simulation_time;
+    snapshot->dump_directory_name = d_dump_directory_name;
+    snapshot->current_dump_directory_name = current_dump_directory_name;
+    snapshot->dump_dirname = dump_dirname;
+    snapshot->mpi_rank = IBTK_MPI::getRank();
+    snapshot->mpi_nodes = IBTK_MPI::getNodes();
+    snapshot->coarsest_ln = d_coarsest_ln;
+    snapshot->finest_ln = d_finest_ln;
+    snapshot->levels.resize(d_finest_ln + 1);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (mpi_rank == SILO_MPI_ROOT)
-        {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
-
-            // Set the values for the root process.
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
-        }
-
-        // Get the values for the non-root processes.
-        int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
-            {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
-            {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-                {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
-
-                int num_bytes;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
-            {
-                IBTK_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                IBTK_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
-                {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-
-                IBTK_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                IBTK_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
-            {
-                IBTK_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-                {
-                    IBTK_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    IBTK_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             IBTK_MPI::getCommunicator());
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
-                mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                IBTK_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-
-                    IBTK_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    IBTK_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-
-                    MPI_Status status;
-                    MPI_Recv(
-                        name.data(), num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, IBTK_MPI::getCommunicator(), &status);
-
-                    mb_names_per_proc[ln][proc][mb].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-                {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name.data());
-                }
-            }
-
-            IBTK_MPI::barrier();
-        }
+        LevelPlotData& level_data = snapshot->levels[ln];
+        level_data.names.cloud_names = d_cloud_names[ln];
+        level_data.names.block_names = d_block_names[ln];
+        level_data.names.mb_names = d_mb_names[ln];
+        level_data.names.mb_nblocks = d_mb_nblocks[ln];
+        level_data.names.ucd_mesh_names = d_ucd_mesh_names[ln];
+        level_data.cloud_nmarks = d_cloud_nmarks[ln];
+        level_data.block_nelems = d_block_nelems[ln];
+        level_data.block_periodic = d_block_periodic[ln];
+        level_data.mb_nelems = d_mb_nelems[ln];
+        level_data.mb_periodic = d_mb_periodic[ln];
+        level_data.ucd_mesh_vertices = d_ucd_mesh_vertices[ln];
+        level_data.ucd_mesh_edge_maps = d_ucd_mesh_edge_maps[ln];
+        level_data.nvars = d_nvars[ln];
+        level_data.var_names = d_var_names[ln];
+        level_data.var_start_depths = d_var_start_depths[ln];
+        level_data.var_plot_depths = d_var_plot_depths[ln];
+        level_data.var_depths = d_var_depths[ln];
+
+        if (!d_coords_data[ln]) continue;
+        level_data.has_coords = true;
+
+        // Scatter the data from "global" to "local" form and copy it into the
+        // snapshot.
+        getLocalPlotData(ln, level_data.X, level_data.var_vals);
+    }
+
+    // Collect the data required to create the multimesh and multivar objects
+    // on the root MPI process.
+    gather_mesh_metadata(*snapshot);
+
+    if (d_write_asynchronously)
+    {
+        // Errors are reported by the next call to waitForPendingWrites(),
+        // which joins the writer thread before the error message is read.
+        d_write_thread = std::thread([this, snapshot]() { d_write_error = write_plot_snapshot(*snapshot); });
     }
-
-    if (mpi_rank == SILO_MPI_ROOT)
+    else
     {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
-        {
-            TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named " << summary_file_name << std::endl);
-        }
-
-        int cycle = time_step_number;
-        auto time = static_cast<float>(simulation_time);
-        double dtime = simulation_time;
-
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
-
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-            {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                           std::to_string(cloud) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
-
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << cloud_name << std::endl);
-                    }
-                }
-
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                           std::to_string(block) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
-
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << block_name << std::endl);
-                    }
-                }
-
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                    std::vector<std::string> meshnames;
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        meshnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
-                                            std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
-                    }
-                    std::vector<const char*> meshnames_ptrs;
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        meshnames_ptrs.push_back(meshnames[block].c_str());
-                    }
-
-                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                    DBPutMultimesh(dbfile,
-                                   mb_name.c_str(),
-                                   nblocks,
-                                   meshnames_ptrs.data(),
-                                   &multimeshtypes_per_proc[ln][proc][mb][0],
-                                   optlist);
-
-                    if (DBMkDir(dbfile, mb_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << mb_name << std::endl);
-                    }
-                }
-
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname =
-                        current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_UCDMESH;
-
-                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                    DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << mesh_name << std::endl);
-                    }
-                }
-
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                              std::to_string(cloud) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_POINTVAR;
-
-                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                        std::string var_name = cloud_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                              std::to_string(block) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = vartypes_per_proc[ln][proc][block];
-
-                        std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                        std::string var_name = block_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-
-                        std::vector<std::string> varnames;
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            varnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
-                                               std::to_string(mb) + "_block_" + std::to_string(block) +
-                                               d_var_names[ln][v]);
-                        }
-                        std::vector<const char*> varnames_ptrs;
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            varnames_ptrs.push_back(varnames[block].c_str());
-                        }
-
-                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                        std::string var_name = mb_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile,
-                                      var_name.c_str(),
-                                      nblocks,
-                                      varnames_ptrs.data(),
-                                      &multivartypes_per_proc[ln][proc][mb][0],
-                                      optlist);
-                    }
-
-                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" +
-                                              std::to_string(mesh) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_UCDVAR;
-
-                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                        std::string var_name = mesh_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-                }
-            }
-        }
-
-        DBFreeOptlist(optlist);
-        DBClose(dbfile);
-
-        // Create or update the dumps file on the root MPI process.
-        static bool summary_file_opened = false;
-        std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string file =
-            current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!summary_file_opened)
-        {
-            summary_file_opened = true;
-            std::ofstream sfile(path.c_str(), std::ios::out);
-            sfile << file << std::endl;
-            sfile.close();
-        }
-        else
-        {
-            std::ofstream sfile(path.c_str(), std::ios::app);
-            sfile << file << std::endl;
-            sfile.close();
-        }
+        const std::string write_error = write_plot_snapshot(*snapshot);
+        if (!write_error.empty()) TBOX_ERROR(write_error);
+        IBTK_MPI::barrier();
     }
-    IBTK_MPI::barrier();
 #else
     TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
 #endif // if defined(IBTK_HAVE_SILO)
@@ -2106,6 +2069,62 @@ LSiloDataWriter::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSiloDataWriter::updateVecScatters()
+{
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_build_vec_scatters[ln])
+        {
+            buildVecScatters(d_ao[ln], ln);
+        }
+        d_build_vec_scatters[ln] = false;
+    }
+    return;
+} // updateVecScatters
+
+void
+LSiloDataWriter::getLocalPlotData(const int level_number,
+                                  std::vector<double>& X_vals,
+                                  std::vector<std::vector<double> >& var_vals)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coords_data[level_number]);
+#endif
+    const int ln = level_number;
+    auto scatter_to_local = [&](const int depth, Vec global_vec, std::vector<double>& local_vals) {
+        int ierr;
+        Vec local_vec;
+        ierr = VecDuplicate(d_dst_vec[ln][depth], &local_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterBegin(d_vec_scatter[ln][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(d_vec_scatter[ln][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+
+        PetscInt local_size;
+        ierr = VecGetLocalSize(local_vec, &local_size);
+        IBTK_CHKERRQ(ierr);
+        const double* local_arr;
+        ierr = VecGetArrayRead(local_vec, &local_arr);
+        IBTK_CHKERRQ(ierr);
+        local_vals.assign(local_arr, local_arr + local_size);
+        ierr = VecRestoreArrayRead(local_vec, &local_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&local_vec);
+        IBTK_CHKERRQ(ierr);
+    };
+    scatter_to_local(NDIM, d_coords_data[ln]->getVec(), X_vals);
+    var_vals.resize(d_nvars[ln]);
+    for (int v = 0; v < d_nvars[ln]; ++v)
+    {
+        scatter_to_local(d_var_depths[ln][v], d_var_data[ln][v]->getVec(), var_vals[v]);
+    }
+    return;
+} // getLocalPlotData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -138,6 +138,9 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_hypre_data")) d_reuse_hypre_data = input_db->getBool("reuse_hypre_data");
+        if (input_db->keyExists("solver_setup_reuse_interval"))
+            d_solver_setup_reuse_interval = input_db->getInteger("solver_setup_reuse_interval");
 
         if (d_solver_type == "SMG" || d_precond_type == "SMG" || d_solver_type == "PFMG" || d_precond_type == "PFMG")
         {
@@ -180,6 +183,13 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+
+    // Deallocate any hypre data structures that were retained for reuse.
+    if (d_grid)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -283,6 +293,8 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     if (d_is_initialized) deallocateSolverState();
 
     // Get the hierarchy information.
+    const Pointer<PatchHierarchy<NDIM> > old_hierarchy = d_hierarchy;
+    const int old_level_num = d_level_num;
     d_hierarchy = x.getPatchHierarchy();
     d_level_num = x.getCoarsestLevelNumber();
     TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
@@ -292,26 +304,41 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
+    // Determine the structure of the hypre data.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
-    {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
             var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
     }
-    allocateHypreData();
+
+    // Reuse the hypre data structures retained from the previous
+    // initialization only if they were built for the same grid and stencil.
+    const bool reuse_hypre_data = d_grid && d_hierarchy == old_hierarchy && d_level_num == old_level_num &&
+                                  depth == d_depth && grid_aligned_anisotropy == d_grid_aligned_anisotropy &&
+                                  hypreGridMatchesLevel();
+    if (!reuse_hypre_data)
+    {
+        if (d_grid)
+        {
+            destroyHypreSolver();
+            deallocateHypreData();
+        }
+        d_depth = depth;
+        d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+        allocateHypreData();
+    }
+
+    // Set the matrix coefficients.  When the hypre data structures are reused,
+    // the values of the existing matrices are overwritten in place.
     if (d_grid_aligned_anisotropy)
     {
         setMatrixCoefficients_aligned();
@@ -320,7 +347,19 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     {
         setMatrixCoefficients_nonaligned();
     }
-    setupHypreSolver();
+
+    // Setup the hypre solver, unless the existing setup may be reused with the
+    // updated matrix coefficients.
+    if (reuse_hypre_data && d_num_solver_setup_reuses < d_solver_setup_reuse_interval)
+    {
+        ++d_num_solver_setup_reuses;
+    }
+    else
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+        d_num_solver_setup_reuses = 0;
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -336,9 +375,13 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures, unless they are to be reused the
+    // next time that the solver is initialized.
+    if (!d_reuse_hypre_data)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -363,12 +406,14 @@ CCPoissonHypreLevelSolver::allocateHypreData()
     const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
 
     HYPRE_StructGridCreate(communicator, NDIM, &d_grid);
+    d_hypre_patch_boxes.clear();
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
         hier::Index<NDIM> lower = patch_box.lower();
         hier::Index<NDIM> upper = patch_box.upper();
         HYPRE_StructGridSetExtents(d_grid, lower, upper);
+        d_hypre_patch_boxes.push_back(patch_box);
     }
 
     int hypre_periodic_shift[3];
@@ -474,6 +519,22 @@ CCPoissonHypreLevelSolver::allocateHypreData()
     return;
 } // allocateHypreData
 
+bool
+CCPoissonHypreLevelSolver::hypreGridMatchesLevel() const
+{
+    // NOTE: This check is collective because the hypre grid is shared by all
+    // processes.
+    bool local_match = true;
+    unsigned int patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p && local_match; p++, ++patch_counter)
+    {
+        const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+        local_match = patch_counter < d_hypre_patch_boxes.size() && patch_box == d_hypre_patch_boxes[patch_counter];
+    }
+    local_match = local_match && patch_counter == d_hypre_patch_boxes.size();
+    return IBTK_MPI::minReduction(static_cast<int>(local_match)) == 1;
+} // hypreGridMatchesLevel
+
 void
 CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
 {
@@ -20,29 +20,42 @@
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CellNoCornersFillPattern.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/SinglePrecisionGhostFill.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "CoarseFineBoundary.h"
 #include "CoarsenOperator.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "HierarchyDataOpsReal.h"
+#include "Index.h"
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
+#include "PatchCellDataBasicOps.h"
 #include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "RefineSchedule.h"
 #include "SideData.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
@@ -56,6 +69,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -69,12 +83,16 @@
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth2d, VCCELLGSSMOOTH2D)
 #define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth2d, VCCELLRBGSSMOOTH2D)
+#define JACOBI_CORRECTION_FC IBTK_FC_FUNC(jacobicorrection2d, JACOBICORRECTION2D)
+#define VC_CELL_JACOBI_CORRECTION_FC IBTK_FC_FUNC(vccelljacobicorrection2d, VCCELLJACOBICORRECTION2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth3d, VCCELLGSSMOOTH3D)
 #define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth3d, VCCELLRBGSSMOOTH3D)
+#define JACOBI_CORRECTION_FC IBTK_FC_FUNC(jacobicorrection3d, JACOBICORRECTION3D)
+#define VC_CELL_JACOBI_CORRECTION_FC IBTK_FC_FUNC(vccelljacobicorrection3d, VCCELLJACOBICORRECTION3D)
 #endif
 
 // Function interfaces
@@ -155,6 +173,47 @@ extern "C"
 #endif
                                  const double* dx,
                                  const int& red_or_black);
+
+    void JACOBI_CORRECTION_FC(double* Z,
+                              const int& Z_gcw,
+                              const double* U,
+                              const int& U_gcw,
+                              const double& alpha,
+                              const double& beta,
+                              const double* F,
+                              const int& F_gcw,
+                              const int& ilower0,
+                              const int& iupper0,
+                              const int& ilower1,
+                              const int& iupper1,
+#if (NDIM == 3)
+                              const int& ilower2,
+                              const int& iupper2,
+#endif
+                              const double* dx);
+
+    void VC_CELL_JACOBI_CORRECTION_FC(double* Z,
+                                      const int& Z_gcw,
+                                      const double* U,
+                                      const int& U_gcw,
+                                      const double* alpha0,
+                                      const double* alpha1,
+#if (NDIM == 3)
+                                      const double* alpha2,
+#endif
+                                      const int& alpha_gcw,
+                                      const double& beta,
+                                      const double* F,
+                                      const int& F_gcw,
+                                      const int& ilower0,
+                                      const int& iupper0,
+                                      const int& ilower1,
+                                      const int& iupper1,
+#if (NDIM == 3)
+                                      const int& ilower2,
+                                      const int& iupper2,
+#endif
+                                      const double* dx);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -195,6 +254,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -203,8 +263,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -234,6 +295,17 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Deterministic pseudo-random values in [-1,1) that are used to initialize the
+// power iteration that estimates the largest eigenvalue of the smoother.
+inline double
+pseudo_random_value(const hier::Index<NDIM>& i, const int depth)
+{
+    unsigned int hash = 2166136261u;
+    for (unsigned int d = 0; d < NDIM; ++d) hash = (hash ^ static_cast<unsigned int>(i(d))) * 16777619u;
+    hash = (hash ^ static_cast<unsigned int>(depth)) * 16777619u;
+    return static_cast<double>(hash % 2048u) / 1024.0 - 1.0;
+} // pseudo_random_value
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -279,6 +351,15 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
         }
+        if (input_db->keyExists("communication_avoiding_smoothing"))
+            setUseCommunicationAvoidingSmoothing(input_db->getBool("communication_avoiding_smoothing"));
+        if (input_db->keyExists("chebyshev_eigenvalue_estimate_iterations"))
+            d_chebyshev_eigenvalue_estimate_iterations =
+                input_db->getInteger("chebyshev_eigenvalue_estimate_iterations");
+        if (input_db->keyExists("chebyshev_lower_eigenvalue_factor"))
+            d_chebyshev_lower_eigenvalue_factor = input_db->getDouble("chebyshev_lower_eigenvalue_factor");
+        if (input_db->keyExists("chebyshev_upper_eigenvalue_factor"))
+            d_chebyshev_upper_eigenvalue_factor = input_db->getDouble("chebyshev_upper_eigenvalue_factor");
         if (input_db->isDatabase("bottom_solver"))
         {
             tbox::pout << "WARNING: ``bottom_solver'' input entry is no longer used by class "
@@ -348,13 +429,27 @@ CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 } // setCoarseSolverType
 
+void
+CCPoissonPointRelaxationFACOperator::setUseCommunicationAvoidingSmoothing(
+    const bool use_communication_avoiding_smoothing)
+{
+    if (use_communication_avoiding_smoothing && d_gcw.min() < 2)
+    {
+        TBOX_WARNING(d_object_name << "::setUseCommunicationAvoidingSmoothing():\n"
+                                   << "  communication-avoiding smoothing requires ghost_cell_width >= 2.\n"
+                                   << "  ghost cells will be filled before every sweep.\n");
+    }
+    d_use_communication_avoiding_smoothing = use_communication_avoiding_smoothing;
+    return;
+} // setUseCommunicationAvoidingSmoothing
+
 void
 CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
                                                  int level_num,
                                                  int num_sweeps,
-                                                 bool /*performing_pre_sweeps*/,
-                                                 bool /*performing_post_sweeps*/)
+                                                 bool performing_pre_sweeps,
+                                                 bool performing_post_sweeps)
 {
     if (num_sweeps == 0) return;
 
@@ -373,6 +468,92 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Chebyshev smoothing is handled separately.
+    if (smoother_type == CHEBYSHEV)
+    {
+        smoothErrorChebyshev(error, residual, level_num, num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
+    // Perform several red-black half-sweeps per ghost cell fill when possible.
+    //
+    // NOTE: Once the ghost cells of width k have been filled, the first
+    // half-sweep produces exact values on the patch box grown by k - 1, the
+    // second on the patch box grown by k - 2, and so on.  Physical boundary
+    // ghost cell values are reset after each half-sweep so that they are
+    // consistent with the updated values.
+    if (d_use_communication_avoiding_smoothing && red_black_ordering && d_poisson_spec.dIsConstant() &&
+        d_level_supports_wide_ghost_fill[level_num])
+    {
+        const int gcw = d_gcw.min();
+        const double alpha = d_poisson_spec.getDConstant();
+        const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+        // The residual is unchanged between the pre- and postsmoothing steps,
+        // so its ghost cells are only filled once per cycle.
+        const int residual_idx = residual.getComponentDescriptorIndex(0);
+        if (!performing_post_sweeps || d_wide_ghost_filled_residual_idx[level_num] != residual_idx)
+        {
+            xeqScheduleWideGhostFill(residual_idx, level_num);
+        }
+        d_wide_ghost_filled_residual_idx[level_num] = performing_pre_sweeps ? residual_idx : IBTK::invalid_index;
+        const int num_half_sweeps = 2 * num_sweeps;
+        int isweep = 0;
+        while (isweep < num_half_sweeps)
+        {
+            xeqScheduleWideGhostFill(error_idx, level_num);
+            const int num_sweeps_per_fill = std::min(gcw, num_half_sweeps - isweep);
+            for (int k = 0; k < num_sweeps_per_fill; ++k, ++isweep)
+            {
+                const int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                const int box_growth = num_sweeps_per_fill - k - 1;
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                    Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+#if !defined(NDEBUG)
+                    TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
+                    TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
+                    TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
+#endif
+                    const Box<NDIM> smooth_box = Box<NDIM>::grow(patch->getBox(), box_growth);
+                    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                    const double* const dx = pgeom->getDx();
+                    for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                    {
+                        // The array extents are unchanged when the box is grown
+                        // and the ghost cell widths are reduced by the same
+                        // amount.
+                        double* const U = error_data->getPointer(depth);
+                        const int U_ghosts = (error_data->getGhostCellWidth()).max() - box_growth;
+                        const double* const F = residual_data->getPointer(depth);
+                        const int F_ghosts = (residual_data->getGhostCellWidth()).max() - box_growth;
+                        RB_GS_SMOOTH_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        smooth_box.lower(0),
+                                        smooth_box.upper(0),
+                                        smooth_box.lower(1),
+                                        smooth_box.upper(1),
+#if (NDIM == 3)
+                                        smooth_box.lower(2),
+                                        smooth_box.upper(2),
+#endif
+                                        dx,
+                                        red_or_black);
+                    }
+                }
+                if (k + 1 < num_sweeps_per_fill) setPhysicalBoundaryConditions(error_idx, level_num);
+            }
+        }
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -790,6 +971,75 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         }
     }
 
+    // Indicate that the Chebyshev smoother eigenvalue estimates must be
+    // recomputed.
+    d_chebyshev_max_eigenvalue_estimates.resize(d_finest_ln + 1, 0.0);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        d_chebyshev_max_eigenvalue_estimates[ln] = 0.0;
+    }
+
+    // Setup communication schedules for communication-avoiding smoothing.
+    //
+    // NOTE: These schedules are used only on levels without coarse-fine
+    // interfaces, since coarse-fine interface ghost cell values are only
+    // interpolated to a width of one cell.  Red-black orderings are consistent
+    // across periodic boundaries only when the number of cells in each
+    // periodic direction is even.
+    d_level_supports_wide_ghost_fill.resize(d_finest_ln + 1, false);
+    d_wide_ghost_filled_residual_idx.resize(d_finest_ln + 1, IBTK::invalid_index);
+    d_wide_ghostfill_refine_schedules.resize(d_finest_ln + 1);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        d_level_supports_wide_ghost_fill[ln] = false;
+        d_wide_ghost_filled_residual_idx[ln] = IBTK::invalid_index;
+        d_wide_ghostfill_refine_schedules[ln].setNull();
+    }
+    if (d_use_communication_avoiding_smoothing && d_gcw.min() >= 2)
+    {
+        const int sol_idx = d_solution->getComponentDescriptorIndex(0);
+        d_wide_ghostfill_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_wide_ghostfill_refine_algorithm->registerRefine(sol_idx, sol_idx, sol_idx, Pointer<RefineOperator<NDIM> >());
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            bool level_supports_wide_ghost_fill = true;
+            const IntVector<NDIM>& periodic_shift = geometry->getPeriodicShift(level->getRatio());
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (periodic_shift(d) % 2 != 0) level_supports_wide_ghost_fill = false;
+            }
+            if (ln > 0)
+            {
+                CoarseFineBoundary<NDIM> cf_boundary(*d_hierarchy, ln, IntVector<NDIM>(1));
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    for (int codim = 1; codim <= NDIM; ++codim)
+                    {
+                        if (cf_boundary.getBoundaries(p(), codim).size() > 0) level_supports_wide_ghost_fill = false;
+                    }
+                }
+            }
+            d_level_supports_wide_ghost_fill[ln] = IBTK_MPI::minReduction(level_supports_wide_ghost_fill ? 1 : 0) == 1;
+            d_wide_ghostfill_refine_schedules[ln] =
+                d_wide_ghostfill_refine_algorithm->createSchedule(level, d_bc_op.getPointer());
+        }
+        if (d_use_single_precision_ghost_fill)
+        {
+            if (!d_single_precision_wide_ghost_fill_op)
+            {
+                d_single_precision_wide_ghost_fill_op =
+                    new SinglePrecisionGhostFill(d_object_name + "::single_precision_wide_ghost_fill");
+            }
+            d_single_precision_wide_ghost_fill_op->initializeOperatorState(
+                std::vector<int>(1, d_scratch_idx),
+                std::vector<Pointer<VariableFillPattern<NDIM> > >(1, Pointer<VariableFillPattern<NDIM> >()),
+                d_hierarchy,
+                coarsest_reset_ln,
+                finest_reset_ln);
+        }
+    }
+
     // Get overlap information for re-setting patch boundary conditions during
     // smoothing.
     d_patch_neighbor_overlap.resize(d_finest_ln + 1);
@@ -822,15 +1072,32 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    if (d_single_precision_wide_ghost_fill_op)
+    {
+        if (d_in_initialize_operator_state)
+        {
+            d_single_precision_wide_ghost_fill_op->deallocateOperatorState(coarsest_reset_ln, finest_reset_ln);
+        }
+        else
+        {
+            d_single_precision_wide_ghost_fill_op->deallocateOperatorState();
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_chebyshev_max_eigenvalue_estimates.clear();
+        d_level_supports_wide_ghost_fill.clear();
+        d_wide_ghost_filled_residual_idx.clear();
+        d_wide_ghostfill_refine_algorithm.setNull();
+        d_wide_ghostfill_refine_schedules.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -838,6 +1105,355 @@ CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+CCPoissonPointRelaxationFACOperator::smoothErrorChebyshev(SAMRAIVectorReal<NDIM, double>& error,
+                                                          const SAMRAIVectorReal<NDIM, double>& residual,
+                                                          const int level_num,
+                                                          const int num_sweeps)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const int error_idx = error.getComponentDescriptorIndex(0);
+    const int scratch_idx = d_scratch_idx;
+
+    // Estimate the largest eigenvalue of the Jacobi-preconditioned operator if
+    // necessary.  This must be done before the scratch data are used to cache
+    // coarse-fine interface ghost cell values.
+    if (d_chebyshev_max_eigenvalue_estimates[level_num] <= 0.0) estimateMaxEigenvalue(level_num);
+    const double lambda_max = d_chebyshev_upper_eigenvalue_factor * d_chebyshev_max_eigenvalue_estimates[level_num];
+    const double lambda_min = d_chebyshev_lower_eigenvalue_factor * d_chebyshev_max_eigenvalue_estimates[level_num];
+#if !defined(NDEBUG)
+    TBOX_ASSERT(lambda_max > lambda_min && lambda_min > 0.0);
+#endif
+    const double theta = 0.5 * (lambda_max + lambda_min);
+    const double delta = 0.5 * (lambda_max - lambda_min);
+    const double sigma = theta / delta;
+
+    // Cache coarse-fine interface ghost cell values in the "scratch" data.
+    if (level_num > d_coarsest_ln && num_sweeps > 1)
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+#if !defined(NDEBUG)
+            const Box<NDIM>& ghost_box = error_data->getGhostBox();
+            TBOX_ASSERT(ghost_box == scratch_data->getGhostBox());
+            TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
+            TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
+#endif
+            scratch_data->getArrayData().copy(
+                error_data->getArrayData(), d_patch_bc_box_overlap[level_num][patch_counter], IntVector<NDIM>(0));
+        }
+    }
+
+    // Allocate temporary data to store the Jacobi corrections and the search
+    // directions.
+    const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+    std::vector<Pointer<CellData<NDIM, double> > > z_data(num_local_patches), dir_data(num_local_patches);
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            const Box<NDIM>& patch_box = patch->getBox();
+            z_data[patch_counter] = new CellData<NDIM, double>(patch_box, error_data->getDepth(), IntVector<NDIM>(0));
+            dir_data[patch_counter] = new CellData<NDIM, double>(patch_box, error_data->getDepth(), IntVector<NDIM>(0));
+        }
+    }
+
+    // Smooth the error by the specified number of sweeps.
+    PatchCellDataBasicOps<NDIM, double> patch_ops;
+    double rho = 1.0 / sigma;
+    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    {
+        // Re-fill ghost cell data as needed.
+        if (level_num > d_coarsest_ln)
+        {
+            if (isweep > 0)
+            {
+                // Copy the coarse-fine interface ghost cell values which are
+                // cached in the scratch data into the error data.
+                int patch_counter = 0;
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                    Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                    error_data->getArrayData().copy(scratch_data->getArrayData(),
+                                                    d_patch_bc_box_overlap[level_num][patch_counter],
+                                                    IntVector<NDIM>(0));
+                }
+
+                // Fill the non-coarse-fine interface ghost cell values.
+                xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+            }
+
+            // Complete the coarse-fine interface interpolation by computing the
+            // normal extension.
+            d_cf_bdry_op->setPatchDataIndex(error_idx);
+            const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const IntVector<NDIM>& ghost_width_to_fill = d_gcw;
+                d_cf_bdry_op->computeNormalExtension(*patch, ratio, ghost_width_to_fill);
+            }
+        }
+        else if (isweep > 0)
+        {
+            xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+        }
+
+        // Update the search directions and the error on the patches.
+        const double rho_new = isweep == 0 ? rho : 1.0 / (2.0 * sigma - rho);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > z = z_data[patch_counter];
+            Pointer<CellData<NDIM, double> > dir = dir_data[patch_counter];
+            const Box<NDIM>& patch_box = patch->getBox();
+            computeJacobiCorrection(z, error_data, residual_data, patch);
+            if (isweep == 0)
+            {
+                patch_ops.scale(dir, 1.0 / theta, z, patch_box);
+            }
+            else
+            {
+                patch_ops.linearSum(dir, rho_new * rho, dir, 2.0 * rho_new / delta, z, patch_box);
+            }
+            patch_ops.add(error_data, error_data, dir, patch_box);
+        }
+        rho = rho_new;
+    }
+    return;
+} // smoothErrorChebyshev
+
+void
+CCPoissonPointRelaxationFACOperator::estimateMaxEigenvalue(const int level_num)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const int scratch_idx = d_scratch_idx;
+
+    // Initialize the iteration with deterministic pseudo-random values.  The
+    // coarse-fine interface ghost cell values are set to zero and are not
+    // modified by the ghost cell fills below.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(scratch_idx);
+        x_data->fillAll(0.0);
+        for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+        {
+            const CellIndex<NDIM>& i = ic();
+            for (int depth = 0; depth < x_data->getDepth(); ++depth)
+            {
+                (*x_data)(i, depth) = pseudo_random_value(i, depth);
+            }
+        }
+    }
+
+    // Allocate temporary data to store the Jacobi corrections and the
+    // homogeneous right-hand side.
+    const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+    std::vector<Pointer<CellData<NDIM, double> > > z_data(num_local_patches), f_data(num_local_patches);
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(scratch_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            z_data[patch_counter] = new CellData<NDIM, double>(patch_box, x_data->getDepth(), IntVector<NDIM>(0));
+            f_data[patch_counter] = new CellData<NDIM, double>(patch_box, x_data->getDepth(), IntVector<NDIM>(0));
+            f_data[patch_counter]->fillAll(0.0);
+        }
+    }
+
+    // Apply the power iteration to the Jacobi-preconditioned operator.  The
+    // homogeneous right-hand side makes the Jacobi correction equal to
+    // -D^{-1} A x.
+    double lambda = 0.0;
+    for (int k = 0; k < d_chebyshev_eigenvalue_estimate_iterations; ++k)
+    {
+        const double norm = d_level_data_ops[level_num]->L2Norm(scratch_idx);
+        if (norm == 0.0) break;
+        d_level_data_ops[level_num]->scale(scratch_idx, 1.0 / norm, scratch_idx);
+        xeqScheduleGhostFillNoCoarse(scratch_idx, level_num);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(scratch_idx);
+            computeJacobiCorrection(z_data[patch_counter], x_data, f_data[patch_counter], patch);
+            x_data->copy(*z_data[patch_counter]);
+        }
+        lambda = d_level_data_ops[level_num]->L2Norm(scratch_idx);
+    }
+    d_chebyshev_max_eigenvalue_estimates[level_num] = lambda > 0.0 ? lambda : 1.0;
+    return;
+} // estimateMaxEigenvalue
+
+void
+CCPoissonPointRelaxationFACOperator::computeJacobiCorrection(Pointer<CellData<NDIM, double> > z_data,
+                                                             Pointer<CellData<NDIM, double> > u_data,
+                                                             Pointer<CellData<NDIM, double> > f_data,
+                                                             Pointer<Patch<NDIM> > patch)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(z_data->getDepth() == u_data->getDepth());
+    TBOX_ASSERT(f_data->getDepth() == u_data->getDepth());
+#endif
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const bool D_is_constant = d_poisson_spec.dIsConstant();
+    const double alpha = D_is_constant ? d_poisson_spec.getDConstant() : 0.0;
+    Pointer<SideData<NDIM, double> > alpha_data = nullptr;
+    if (!D_is_constant)
+    {
+        alpha_data = patch->getPatchData(d_poisson_spec.getDPatchDataId());
+#if !defined(NDEBUG)
+        TBOX_ASSERT(alpha_data);
+#endif
+    }
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    for (int depth = 0; depth < u_data->getDepth(); ++depth)
+    {
+        double* const Z = z_data->getPointer(depth);
+        const int Z_ghosts = (z_data->getGhostCellWidth()).max();
+        const double* const U = u_data->getPointer(depth);
+        const int U_ghosts = (u_data->getGhostCellWidth()).max();
+        const double* const F = f_data->getPointer(depth);
+        const int F_ghosts = (f_data->getGhostCellWidth()).max();
+        if (D_is_constant)
+        {
+            JACOBI_CORRECTION_FC(Z,
+                                 Z_ghosts,
+                                 U,
+                                 U_ghosts,
+                                 alpha,
+                                 beta,
+                                 F,
+                                 F_ghosts,
+                                 patch_box.lower(0),
+                                 patch_box.upper(0),
+                                 patch_box.lower(1),
+                                 patch_box.upper(1),
+#if (NDIM == 3)
+                                 patch_box.lower(2),
+                                 patch_box.upper(2),
+#endif
+                                 dx);
+        }
+        else
+        {
+            const double* const alpha0 = alpha_data->getPointer(0, depth);
+            const double* const alpha1 = alpha_data->getPointer(1, depth);
+#if (NDIM == 3)
+            const double* const alpha2 = alpha_data->getPointer(2, depth);
+#endif
+            const int alpha_ghosts = (alpha_data->getGhostCellWidth()).max();
+            VC_CELL_JACOBI_CORRECTION_FC(Z,
+                                         Z_ghosts,
+                                         U,
+                                         U_ghosts,
+                                         alpha0,
+                                         alpha1,
+#if (NDIM == 3)
+                                         alpha2,
+#endif
+                                         alpha_ghosts,
+                                         beta,
+                                         F,
+                                         F_ghosts,
+                                         patch_box.lower(0),
+                                         patch_box.upper(0),
+                                         patch_box.lower(1),
+                                         patch_box.upper(1),
+#if (NDIM == 3)
+                                         patch_box.lower(2),
+                                         patch_box.upper(2),
+#endif
+                                         dx);
+        }
+    }
+    return;
+} // computeJacobiCorrection
+
+void
+CCPoissonPointRelaxationFACOperator::xeqScheduleWideGhostFill(const int dst_idx, const int dst_ln)
+{
+    d_bc_op->setPatchDataIndex(dst_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(dst_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    if (d_use_single_precision_ghost_fill)
+    {
+        d_single_precision_wide_ghost_fill_op->fillData(std::vector<int>(1, dst_idx), dst_ln, d_solution_time);
+        setPhysicalBoundaryConditions(dst_idx, dst_ln);
+    }
+    else
+    {
+        RefineAlgorithm<NDIM> refiner;
+        refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >());
+        refiner.resetSchedule(d_wide_ghostfill_refine_schedules[dst_ln]);
+        d_wide_ghostfill_refine_schedules[dst_ln]->fillData(d_solution_time);
+        d_wide_ghostfill_refine_algorithm->resetSchedule(d_wide_ghostfill_refine_schedules[dst_ln]);
+    }
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // xeqScheduleWideGhostFill
+
+void
+CCPoissonPointRelaxationFACOperator::setPhysicalBoundaryConditions(const int dst_idx, const int dst_ln)
+{
+    d_bc_op->setPatchDataIndex(dst_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(dst_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+        {
+            d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, d_gcw);
+        }
+    }
+    for (const auto& bc_coef : d_bc_coefs)
+    {
+        auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    }
+    return;
+} // setPhysicalBoundaryConditions
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
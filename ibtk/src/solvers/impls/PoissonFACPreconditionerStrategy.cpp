@@ -21,6 +21,7 @@
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/SinglePrecisionGhostFill.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -33,6 +34,8 @@
 #include "HierarchyDataOpsReal.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
+#include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
@@ -122,6 +125,8 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(std::string o
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("use_single_precision_ghost_fill"))
+            d_use_single_precision_ghost_fill = input_db->getBool("use_single_precision_ghost_fill");
     }
 
     // Setup scratch variables.
@@ -252,6 +257,18 @@ PoissonFACPreconditionerStrategy::setRestrictionMethod(const std::string& restri
     return;
 } // setRestrictionMethod
 
+void
+PoissonFACPreconditionerStrategy::setUseSinglePrecisionGhostFill(const bool use_single_precision_ghost_fill)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setUseSinglePrecisionGhostFill()\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    d_use_single_precision_ghost_fill = use_single_precision_ghost_fill;
+    return;
+} // setUseSinglePrecisionGhostFill
+
 void
 PoissonFACPreconditionerStrategy::setToZero(SAMRAIVectorReal<NDIM, double>& vec, int level_num)
 {
@@ -443,6 +460,20 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
             d_ghostfill_nocoarse_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln), d_bc_op.getPointer());
         d_synch_refine_schedules[ln] = d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln));
     }
+    if (d_use_single_precision_ghost_fill)
+    {
+        if (!d_single_precision_ghost_fill_op)
+        {
+            d_single_precision_ghost_fill_op =
+                new SinglePrecisionGhostFill(d_object_name + "::single_precision_ghost_fill");
+        }
+        d_single_precision_ghost_fill_op->initializeOperatorState(
+            std::vector<int>(1, d_scratch_idx),
+            std::vector<Pointer<VariableFillPattern<NDIM> > >(1, d_op_stencil_fill_pattern),
+            d_hierarchy,
+            coarsest_reset_ln,
+            finest_reset_ln);
+    }
 
     // Indicate that the operator is initialized.
     d_is_initialized = true;
@@ -475,6 +506,17 @@ PoissonFACPreconditionerStrategy::deallocateOperatorState()
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         if (level->checkAllocated(d_scratch_idx)) level->deallocatePatchData(d_scratch_idx);
     }
+    if (d_single_precision_ghost_fill_op)
+    {
+        if (d_in_initialize_operator_state)
+        {
+            d_single_precision_ghost_fill_op->deallocateOperatorState(coarsest_reset_ln, finest_reset_ln);
+        }
+        else
+        {
+            d_single_precision_ghost_fill_op->deallocateOperatorState();
+        }
+    }
 
     // Delete the solution and rhs vectors.
     d_solution->freeVectorComponents();
@@ -578,11 +620,29 @@ PoissonFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const int dst_idx
             extended_bc_coef->setHomogeneousBc(true);
         }
     }
-    RefineAlgorithm<NDIM> refiner;
-    refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_op_stencil_fill_pattern);
-    refiner.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
-    d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_solution_time);
-    d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    if (d_use_single_precision_ghost_fill)
+    {
+        // Physical boundary conditions are set in double precision once the
+        // same-level ghost cell values have been filled.
+        d_single_precision_ghost_fill_op->fillData(std::vector<int>(1, dst_idx), dst_ln, d_solution_time);
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+            {
+                d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, d_gcw);
+            }
+        }
+    }
+    else
+    {
+        RefineAlgorithm<NDIM> refiner;
+        refiner.registerRefine(dst_idx, dst_idx, dst_idx, Pointer<RefineOperator<NDIM> >(), d_op_stencil_fill_pattern);
+        refiner.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+        d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_solution_time);
+        d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    }
     for (const auto& bc_coef : d_bc_coefs)
     {
         auto extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
@@ -106,6 +106,9 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_hypre_data")) d_reuse_hypre_data = input_db->getBool("reuse_hypre_data");
+        if (input_db->keyExists("solver_setup_reuse_interval"))
+            d_solver_setup_reuse_interval = input_db->getInteger("solver_setup_reuse_interval");
 
         if (d_solver_type == "SysPFMG" || d_precond_type == "SysPFMG")
         {
@@ -144,6 +147,13 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+
+    // Deallocate any hypre data structures that were retained for reuse.
+    if (d_grid)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -249,6 +259,8 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     if (d_is_initialized) deallocateSolverState();
 
     // Get the hierarchy information.
+    const Pointer<PatchHierarchy<NDIM> > old_hierarchy = d_hierarchy;
+    const int old_level_num = d_level_num;
     d_hierarchy = x.getPatchHierarchy();
     d_level_num = x.getCoarsestLevelNumber();
     TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
@@ -258,10 +270,36 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
+    // Allocate the hypre data structures, unless the data structures retained
+    // from the previous initialization were built for the same grid.
+    const bool reuse_hypre_data =
+        d_grid && d_hierarchy == old_hierarchy && d_level_num == old_level_num && hypreGridMatchesLevel();
+    if (!reuse_hypre_data)
+    {
+        if (d_grid)
+        {
+            destroyHypreSolver();
+            deallocateHypreData();
+        }
+        allocateHypreData();
+    }
+
+    // Set the matrix coefficients.  When the hypre data structures are reused,
+    // the values of the existing matrix are overwritten in place.
     setMatrixCoefficients();
-    setupHypreSolver();
+
+    // Setup the hypre solver, unless the existing setup may be reused with the
+    // updated matrix coefficients.
+    if (reuse_hypre_data && d_num_solver_setup_reuses < d_solver_setup_reuse_interval)
+    {
+        ++d_num_solver_setup_reuses;
+    }
+    else
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+        d_num_solver_setup_reuses = 0;
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -277,9 +315,13 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures, unless they are to be reused the
+    // next time that the solver is initialized.
+    if (!d_reuse_hypre_data)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -304,12 +346,14 @@ SCPoissonHypreLevelSolver::allocateHypreData()
     const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
 
     HYPRE_SStructGridCreate(communicator, NDIM, NPARTS, &d_grid);
+    d_hypre_patch_boxes.clear();
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
         hier::Index<NDIM> lower = patch_box.lower();
         hier::Index<NDIM> upper = patch_box.upper();
         HYPRE_SStructGridSetExtents(d_grid, PART, lower, upper);
+        d_hypre_patch_boxes.push_back(patch_box);
     }
 
     int hypre_periodic_shift[3];
@@ -376,6 +420,22 @@ SCPoissonHypreLevelSolver::allocateHypreData()
     return;
 } // allocateHypreData
 
+bool
+SCPoissonHypreLevelSolver::hypreGridMatchesLevel() const
+{
+    // NOTE: This check is collective because the hypre grid is shared by all
+    // processes.
+    bool local_match = true;
+    unsigned int patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p && local_match; p++, ++patch_counter)
+    {
+        const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+        local_match = patch_counter < d_hypre_patch_boxes.size() && patch_box == d_hypre_patch_boxes[patch_counter];
+    }
+    local_match = local_match && patch_counter == d_hypre_patch_boxes.size();
+    return IBTK_MPI::minReduction(static_cast<int>(local_match)) == 1;
+} // hypreGridMatchesLevel
+
 void
 SCPoissonHypreLevelSolver::setMatrixCoefficients()
 {
@@ -37,12 +37,15 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CoarsenOperator.h"
+#include "HierarchyDataOpsReal.h"
 #include "HierarchySideDataOpsReal.h"
+#include "Index.h"
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
 #include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "PatchSideDataBasicOps.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
 #include "SAMRAIVectorReal.h"
@@ -78,12 +81,16 @@
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define JACOBI_CORRECTION_FC IBTK_FC_FUNC(jacobicorrection2d, JACOBICORRECTION2D)
+#define JACOBI_CORRECTION_MASK_FC IBTK_FC_FUNC(jacobicorrectionmask2d, JACOBICORRECTIONMASK2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define JACOBI_CORRECTION_FC IBTK_FC_FUNC(jacobicorrection3d, JACOBICORRECTION3D)
+#define JACOBI_CORRECTION_MASK_FC IBTK_FC_FUNC(jacobicorrectionmask3d, JACOBICORRECTIONMASK3D)
 #endif
 
 // Function interfaces
@@ -158,6 +165,44 @@ extern "C"
 #endif
                               const double* dx,
                               const int& red_or_black);
+
+    void JACOBI_CORRECTION_FC(double* Z,
+                              const int& Z_gcw,
+                              const double* U,
+                              const int& U_gcw,
+                              const double& alpha,
+                              const double& beta,
+                              const double* F,
+                              const int& F_gcw,
+                              const int& ilower0,
+                              const int& iupper0,
+                              const int& ilower1,
+                              const int& iupper1,
+#if (NDIM == 3)
+                              const int& ilower2,
+                              const int& iupper2,
+#endif
+                              const double* dx);
+
+    void JACOBI_CORRECTION_MASK_FC(double* Z,
+                                   const int& Z_gcw,
+                                   const double* U,
+                                   const int& U_gcw,
+                                   const double& alpha,
+                                   const double& beta,
+                                   const double* F,
+                                   const int& F_gcw,
+                                   const int* mask,
+                                   const int& mask_gcw,
+                                   const int& ilower0,
+                                   const int& iupper0,
+                                   const int& ilower1,
+                                   const int& iupper1,
+#if (NDIM == 3)
+                                   const int& ilower2,
+                                   const int& iupper2,
+#endif
+                                   const double* dx);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -198,6 +243,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -206,8 +252,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -237,6 +284,17 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Deterministic pseudo-random values in [-1,1) that are used to initialize the
+// power iteration that estimates the largest eigenvalue of the smoother.
+inline double
+pseudo_random_value(const hier::Index<NDIM>& i, const int component)
+{
+    unsigned int hash = 2166136261u;
+    for (unsigned int d = 0; d < NDIM; ++d) hash = (hash ^ static_cast<unsigned int>(i(d))) * 16777619u;
+    hash = (hash ^ static_cast<unsigned int>(component)) * 16777619u;
+    return static_cast<double>(hash % 2048u) / 1024.0 - 1.0;
+} // pseudo_random_value
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -279,6 +337,13 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
         if (input_db->keyExists("coarse_solver_prefix"))
             d_coarse_solver_default_options_prefix = input_db->getString("coarse_solver_prefix");
+        if (input_db->keyExists("chebyshev_eigenvalue_estimate_iterations"))
+            d_chebyshev_eigenvalue_estimate_iterations =
+                input_db->getInteger("chebyshev_eigenvalue_estimate_iterations");
+        if (input_db->keyExists("chebyshev_lower_eigenvalue_factor"))
+            d_chebyshev_lower_eigenvalue_factor = input_db->getDouble("chebyshev_lower_eigenvalue_factor");
+        if (input_db->keyExists("chebyshev_upper_eigenvalue_factor"))
+            d_chebyshev_upper_eigenvalue_factor = input_db->getDouble("chebyshev_upper_eigenvalue_factor");
         if (input_db->isDatabase("coarse_solver_db"))
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
@@ -386,6 +451,14 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Chebyshev smoothing is handled separately.
+    if (smoother_type == CHEBYSHEV)
+    {
+        smoothErrorChebyshev(error, residual, level_num, num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -799,6 +872,14 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     }
     d_synch_fill_pattern = new SideSynchCopyFillPattern();
 
+    // Indicate that the Chebyshev smoother eigenvalue estimates must be
+    // recomputed.
+    d_chebyshev_max_eigenvalue_estimates.resize(d_finest_ln + 1, 0.0);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        d_chebyshev_max_eigenvalue_estimates[ln] = 0.0;
+    }
+
     // Get overlap information for setting patch boundary conditions.
     d_patch_bc_box_overlap.resize(d_finest_ln + 1);
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
@@ -869,11 +950,304 @@ SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_chebyshev_max_eigenvalue_estimates.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
 } // deallocateOperatorStateSpecialized
 
+void
+SCPoissonPointRelaxationFACOperator::smoothErrorChebyshev(SAMRAIVectorReal<NDIM, double>& error,
+                                                          const SAMRAIVectorReal<NDIM, double>& residual,
+                                                          const int level_num,
+                                                          const int num_sweeps)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const int error_idx = error.getComponentDescriptorIndex(0);
+    const int scratch_idx = d_scratch_idx;
+
+    // Estimate the largest eigenvalue of the Jacobi-preconditioned operator if
+    // necessary.  This must be done before the scratch data are used to cache
+    // coarse-fine interface ghost cell values.
+    if (d_chebyshev_max_eigenvalue_estimates[level_num] <= 0.0) estimateMaxEigenvalue(level_num);
+    const double lambda_max = d_chebyshev_upper_eigenvalue_factor * d_chebyshev_max_eigenvalue_estimates[level_num];
+    const double lambda_min = d_chebyshev_lower_eigenvalue_factor * d_chebyshev_max_eigenvalue_estimates[level_num];
+#if !defined(NDEBUG)
+    TBOX_ASSERT(lambda_max > lambda_min && lambda_min > 0.0);
+#endif
+    const double theta = 0.5 * (lambda_max + lambda_min);
+    const double delta = 0.5 * (lambda_max - lambda_min);
+    const double sigma = theta / delta;
+
+    // Cache coarse-fine interface ghost cell values in the "scratch" data.
+    if (level_num > d_coarsest_ln && num_sweeps > 1)
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+#if !defined(NDEBUG)
+            const Box<NDIM>& ghost_box = error_data->getGhostBox();
+            TBOX_ASSERT(ghost_box == scratch_data->getGhostBox());
+            TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
+            TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
+#endif
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                scratch_data->getArrayData(axis).copy(error_data->getArrayData(axis),
+                                                      d_patch_bc_box_overlap[level_num][patch_counter][axis],
+                                                      IntVector<NDIM>(0));
+            }
+        }
+    }
+
+    // Allocate temporary data to store the Jacobi corrections and the search
+    // directions.
+    const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+    std::vector<Pointer<SideData<NDIM, double> > > z_data(num_local_patches), dir_data(num_local_patches);
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            const Box<NDIM>& patch_box = patch->getBox();
+            z_data[patch_counter] = new SideData<NDIM, double>(patch_box, error_data->getDepth(), IntVector<NDIM>(0));
+            dir_data[patch_counter] = new SideData<NDIM, double>(patch_box, error_data->getDepth(), IntVector<NDIM>(0));
+        }
+    }
+
+    // Smooth the error by the specified number of sweeps.
+    PatchSideDataBasicOps<NDIM, double> patch_ops;
+    double rho = 1.0 / sigma;
+    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    {
+        // Re-fill ghost cell data as needed.
+        if (level_num > d_coarsest_ln)
+        {
+            if (isweep > 0)
+            {
+                // Copy the coarse-fine interface ghost cell values which are
+                // cached in the scratch data into the error data.
+                int patch_counter = 0;
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                    Pointer<SideData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        error_data->getArrayData(axis).copy(scratch_data->getArrayData(axis),
+                                                            d_patch_bc_box_overlap[level_num][patch_counter][axis],
+                                                            IntVector<NDIM>(0));
+                    }
+                }
+
+                // Fill the non-coarse-fine interface ghost cell values.
+                xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+            }
+
+            // Complete the coarse-fine interface interpolation by computing the
+            // normal extension.
+            d_cf_bdry_op->setPatchDataIndex(error_idx);
+            const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const IntVector<NDIM>& ghost_width_to_fill = d_gcw;
+                d_cf_bdry_op->computeNormalExtension(*patch, ratio, ghost_width_to_fill);
+            }
+        }
+        else if (isweep > 0)
+        {
+            xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+        }
+
+        // Update the search directions and the error on the patches.
+        const double rho_new = isweep == 0 ? rho : 1.0 / (2.0 * sigma - rho);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, double> > z = z_data[patch_counter];
+            Pointer<SideData<NDIM, double> > dir = dir_data[patch_counter];
+            const Box<NDIM>& patch_box = patch->getBox();
+
+            // Enforce any Dirichlet boundary conditions.
+            if (d_bc_helper->patchTouchesDirichletBoundary(patch))
+            {
+                d_bc_helper->copyDataAtDirichletBoundaries(error_data, residual_data, patch);
+            }
+
+            computeJacobiCorrection(z, error_data, residual_data, patch);
+            if (isweep == 0)
+            {
+                patch_ops.scale(dir, 1.0 / theta, z, patch_box);
+            }
+            else
+            {
+                patch_ops.linearSum(dir, rho_new * rho, dir, 2.0 * rho_new / delta, z, patch_box);
+            }
+            patch_ops.add(error_data, error_data, dir, patch_box);
+        }
+        rho = rho_new;
+    }
+
+    // Synchronize data along patch boundaries.
+    xeqScheduleDataSynch(error_idx, level_num);
+    return;
+} // smoothErrorChebyshev
+
+void
+SCPoissonPointRelaxationFACOperator::estimateMaxEigenvalue(const int level_num)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const int scratch_idx = d_scratch_idx;
+
+    // Initialize the iteration with deterministic pseudo-random values.  The
+    // coarse-fine interface ghost cell values are set to zero and are not
+    // modified by the ghost cell fills below.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(scratch_idx);
+        x_data->fillAll(0.0);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            ArrayData<NDIM, double>& x_array = x_data->getArrayData(axis);
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch->getBox(), axis)); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                for (int depth = 0; depth < x_data->getDepth(); ++depth)
+                {
+                    x_array(i, depth) = pseudo_random_value(i, NDIM * depth + axis);
+                }
+            }
+        }
+    }
+
+    // Allocate temporary data to store the Jacobi corrections and the
+    // homogeneous right-hand side.
+    const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+    std::vector<Pointer<SideData<NDIM, double> > > z_data(num_local_patches), f_data(num_local_patches);
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(scratch_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            z_data[patch_counter] = new SideData<NDIM, double>(patch_box, x_data->getDepth(), IntVector<NDIM>(0));
+            f_data[patch_counter] = new SideData<NDIM, double>(patch_box, x_data->getDepth(), IntVector<NDIM>(0));
+            f_data[patch_counter]->fillAll(0.0);
+        }
+    }
+
+    // Apply the power iteration to the Jacobi-preconditioned operator.  The
+    // homogeneous right-hand side makes the Jacobi correction equal to
+    // -D^{-1} A x.
+    double lambda = 0.0;
+    for (int k = 0; k < d_chebyshev_eigenvalue_estimate_iterations; ++k)
+    {
+        const double norm = d_level_data_ops[level_num]->L2Norm(scratch_idx);
+        if (norm == 0.0) break;
+        d_level_data_ops[level_num]->scale(scratch_idx, 1.0 / norm, scratch_idx);
+        xeqScheduleGhostFillNoCoarse(scratch_idx, level_num);
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(scratch_idx);
+            computeJacobiCorrection(z_data[patch_counter], x_data, f_data[patch_counter], patch);
+            x_data->copy(*z_data[patch_counter]);
+        }
+        lambda = d_level_data_ops[level_num]->L2Norm(scratch_idx);
+    }
+    d_chebyshev_max_eigenvalue_estimates[level_num] = lambda > 0.0 ? lambda : 1.0;
+    return;
+} // estimateMaxEigenvalue
+
+void
+SCPoissonPointRelaxationFACOperator::computeJacobiCorrection(Pointer<SideData<NDIM, double> > z_data,
+                                                             Pointer<SideData<NDIM, double> > u_data,
+                                                             Pointer<SideData<NDIM, double> > f_data,
+                                                             Pointer<Patch<NDIM> > patch)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(z_data->getDepth() == u_data->getDepth());
+    TBOX_ASSERT(f_data->getDepth() == u_data->getDepth());
+#endif
+    Pointer<SideData<NDIM, int> > mask_data = patch->getPatchData(d_mask_idx);
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const bool patch_has_dirichlet_bdry = d_bc_helper->patchTouchesDirichletBoundary(patch);
+    const double& alpha = d_poisson_spec.getDConstant();
+    const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    for (int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        for (int depth = 0; depth < u_data->getDepth(); ++depth)
+        {
+            double* const Z = z_data->getPointer(axis, depth);
+            const int Z_ghosts = (z_data->getGhostCellWidth()).max();
+            const double* const U = u_data->getPointer(axis, depth);
+            const int U_ghosts = (u_data->getGhostCellWidth()).max();
+            const double* const F = f_data->getPointer(axis, depth);
+            const int F_ghosts = (f_data->getGhostCellWidth()).max();
+            const int* const mask = mask_data->getPointer(axis, depth);
+            const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
+            if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
+            {
+                JACOBI_CORRECTION_MASK_FC(Z,
+                                          Z_ghosts,
+                                          U,
+                                          U_ghosts,
+                                          alpha,
+                                          beta,
+                                          F,
+                                          F_ghosts,
+                                          mask,
+                                          mask_ghosts,
+                                          side_patch_box.lower(0),
+                                          side_patch_box.upper(0),
+                                          side_patch_box.lower(1),
+                                          side_patch_box.upper(1),
+#if (NDIM == 3)
+                                          side_patch_box.lower(2),
+                                          side_patch_box.upper(2),
+#endif
+                                          dx);
+            }
+            else
+            {
+                JACOBI_CORRECTION_FC(Z,
+                                     Z_ghosts,
+                                     U,
+                                     U_ghosts,
+                                     alpha,
+                                     beta,
+                                     F,
+                                     F_ghosts,
+                                     side_patch_box.lower(0),
+                                     side_patch_box.upper(0),
+                                     side_patch_box.lower(1),
+                                     side_patch_box.upper(1),
+#if (NDIM == 3)
+                                     side_patch_box.lower(2),
+                                     side_patch_box.upper(2),
+#endif
+                                     dx);
+            }
+        }
+    }
+    return;
+} // computeJacobiCorrection
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -33,8 +33,10 @@
 #include "MultiblockDataTranslator.h"
 #include "NodeData.h"
 #include "NodeVariable.h"
+#include "Patch.h"
 #include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
 #include "SideVariable.h"
 #include "VariableFillPattern.h"
 #include "tbox/Database.h"
@@ -50,12 +52,14 @@
 #define VC_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcgssmoothmask2d, VCGSSMOOTHMASK2D)
 #define VC_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vcrbgssmooth2d, VCRBGSSMOOTH2D)
 #define VC_RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcrbgssmoothmask2d, VCRBGSSMOOTHMASK2D)
+#define VC_JACOBI_CORRECTION_MASK_FC IBTK_FC_FUNC(vcjacobicorrectionmask2d, VCJACOBICORRECTIONMASK2D)
 #endif
 #if (NDIM == 3)
 #define VC_GS_SMOOTH_FC IBTK_FC_FUNC(vcgssmooth3d, VCGSSMOOTH3D)
 #define VC_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcgssmoothmask3d, VCGSSMOOTHMASK3D)
 #define VC_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vcrbgssmooth3d, VCRBGSSMOOTH3D)
 #define VC_RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(vcrbgssmoothmask3d, VCRBGSSMOOTHMASK3D)
+#define VC_JACOBI_CORRECTION_MASK_FC IBTK_FC_FUNC(vcjacobicorrectionmask3d, VCJACOBICORRECTIONMASK3D)
 #endif
 
 // Function interfaces
@@ -238,6 +242,59 @@ extern "C"
                                  const int& var_c,
                                  const int& use_harmonic_interp,
                                  const int& red_or_black);
+
+    void VC_JACOBI_CORRECTION_MASK_FC(double* Z0,
+                                      double* Z1,
+#if (NDIM == 3)
+                                      double* Z2,
+#endif
+                                      const int& Z_gcw,
+                                      const double* U0,
+                                      const double* U1,
+#if (NDIM == 3)
+                                      const double* U2,
+#endif
+                                      const int& U_gcw,
+                                      const double* F0,
+                                      const double* F1,
+#if (NDIM == 3)
+                                      const double* F2,
+#endif
+                                      const int& F_gcw,
+                                      const int* mask0,
+                                      const int* mask1,
+#if (NDIM == 3)
+                                      const int* mask2,
+#endif
+                                      const int& mask_gcw,
+                                      const double* C0,
+                                      const double* C1,
+#if (NDIM == 3)
+                                      const double* C2,
+#endif
+                                      const int& C_gcw,
+#if (NDIM == 2)
+                                      const double* mu,
+#endif
+#if (NDIM == 3)
+                                      const double* mu0,
+                                      const double* mu1,
+                                      const double* mu2,
+#endif
+                                      const int& mu_gcw,
+                                      const double& alpha,
+                                      const double& beta,
+                                      const int& ilower0,
+                                      const int& iupper0,
+                                      const int& ilower1,
+                                      const int& iupper1,
+#if (NDIM == 3)
+                                      const int& ilower2,
+                                      const int& iupper2,
+#endif
+                                      const double* dx,
+                                      const int& var_c,
+                                      const int& use_harmonic_interp);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -273,6 +330,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -281,8 +339,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -369,6 +428,14 @@ VCSCViscousOpPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // Chebyshev smoothing is handled separately.
+    if (smoother_type == CHEBYSHEV)
+    {
+        smoothErrorChebyshev(error, residual, level_num, num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -929,6 +996,160 @@ VCSCViscousOpPointRelaxationFACOperator::initializeOperatorStateSpecialized(
     return;
 } // initializeOperatorStateSpecialized
 
+void
+VCSCViscousOpPointRelaxationFACOperator::computeJacobiCorrection(Pointer<SideData<NDIM, double> > z_data,
+                                                                 Pointer<SideData<NDIM, double> > u_data,
+                                                                 Pointer<SideData<NDIM, double> > f_data,
+                                                                 Pointer<Patch<NDIM> > patch)
+{
+#if (NDIM == 2)
+    Pointer<NodeData<NDIM, double> > mu_data = patch->getPatchData(d_poisson_spec.getDPatchDataId());
+#endif
+#if (NDIM == 3)
+    Pointer<EdgeData<NDIM, double> > mu_data = patch->getPatchData(d_poisson_spec.getDPatchDataId());
+#endif
+#if !defined(NDEBUG)
+    TBOX_ASSERT(z_data->getDepth() == u_data->getDepth());
+    TBOX_ASSERT(f_data->getDepth() == u_data->getDepth());
+    TBOX_ASSERT(mu_data->getDepth() == u_data->getDepth());
+    TBOX_ASSERT(mu_data->getGhostCellWidth() >= d_gcw);
+#endif
+    Pointer<SideData<NDIM, double> > C_data = nullptr;
+    if (d_poisson_spec.cIsVariable())
+    {
+        C_data = patch->getPatchData(d_poisson_spec.getCPatchDataId());
+    }
+    Pointer<SideData<NDIM, int> > mask_data = patch->getPatchData(d_mask_idx);
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const bool use_harmonic_interp = (d_D_interp_type == VC_HARMONIC_INTERP);
+    double alpha = 1.0;
+    double beta = 0.0;
+    const int C_is_varying = d_poisson_spec.cIsVariable();
+    if (d_poisson_spec.cIsConstant())
+    {
+        beta = d_poisson_spec.getCConstant();
+    }
+    else if (d_poisson_spec.cIsVariable())
+    {
+        beta = 1.0;
+    }
+
+    // NOTE: The masked kernel is always used because the mask data vanish away
+    // from Dirichlet boundaries.
+    for (int depth = 0; depth < u_data->getDepth(); ++depth)
+    {
+        double* const Z0 = z_data->getPointer(0, depth);
+        double* const Z1 = z_data->getPointer(1, depth);
+#if (NDIM == 3)
+        double* const Z2 = z_data->getPointer(2, depth);
+#endif
+        const int Z_ghosts = (z_data->getGhostCellWidth()).max();
+
+        const double* const U0 = u_data->getPointer(0, depth);
+        const double* const U1 = u_data->getPointer(1, depth);
+#if (NDIM == 3)
+        const double* const U2 = u_data->getPointer(2, depth);
+#endif
+        const int U_ghosts = (u_data->getGhostCellWidth()).max();
+
+        const double* const F0 = f_data->getPointer(0, depth);
+        const double* const F1 = f_data->getPointer(1, depth);
+#if (NDIM == 3)
+        const double* const F2 = f_data->getPointer(2, depth);
+#endif
+        const int F_ghosts = (f_data->getGhostCellWidth()).max();
+
+        const int* const mask0 = mask_data->getPointer(0, depth);
+        const int* const mask1 = mask_data->getPointer(1, depth);
+#if (NDIM == 3)
+        const int* const mask2 = mask_data->getPointer(2, depth);
+#endif
+        const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
+
+#if (NDIM == 2)
+        const double* const mu = mu_data->getPointer(depth);
+#endif
+#if (NDIM == 3)
+        const double* const mu0 = mu_data->getPointer(0, depth);
+        const double* const mu1 = mu_data->getPointer(1, depth);
+        const double* const mu2 = mu_data->getPointer(2, depth);
+#endif
+        const int mu_ghosts = (mu_data->getGhostCellWidth()).max();
+
+        const double* C0 = nullptr;
+        const double* C1 = nullptr;
+#if (NDIM == 3)
+        const double* C2 = nullptr;
+#endif
+        int C_ghosts = 0;
+        if (d_poisson_spec.cIsVariable())
+        {
+            C0 = C_data->getPointer(0, depth);
+            C1 = C_data->getPointer(1, depth);
+#if (NDIM == 3)
+            C2 = C_data->getPointer(2, depth);
+#endif
+            C_ghosts = (C_data->getGhostCellWidth()).max();
+        }
+
+        VC_JACOBI_CORRECTION_MASK_FC(Z0,
+                                     Z1,
+#if (NDIM == 3)
+                                     Z2,
+#endif
+                                     Z_ghosts,
+                                     U0,
+                                     U1,
+#if (NDIM == 3)
+                                     U2,
+#endif
+                                     U_ghosts,
+                                     F0,
+                                     F1,
+#if (NDIM == 3)
+                                     F2,
+#endif
+                                     F_ghosts,
+                                     mask0,
+                                     mask1,
+#if (NDIM == 3)
+                                     mask2,
+#endif
+                                     mask_ghosts,
+                                     C0,
+                                     C1,
+#if (NDIM == 3)
+                                     C2,
+#endif
+                                     C_ghosts,
+#if (NDIM == 2)
+                                     mu,
+#endif
+#if (NDIM == 3)
+                                     mu0,
+                                     mu1,
+                                     mu2,
+#endif
+                                     mu_ghosts,
+                                     alpha,
+                                     beta,
+                                     patch_box.lower(0),
+                                     patch_box.upper(0),
+                                     patch_box.lower(1),
+                                     patch_box.upper(1),
+#if (NDIM == 3)
+                                     patch_box.lower(2),
+                                     patch_box.upper(2),
+#endif
+                                     dx,
+                                     C_is_varying,
+                                     use_harmonic_interp);
+    }
+    return;
+} // computeJacobiCorrection
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
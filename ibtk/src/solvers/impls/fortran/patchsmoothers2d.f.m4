@@ -126,7 +126,7 @@ c
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
                U(i0,i1) = fac*(
      &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
      &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
@@ -263,7 +263,7 @@ c
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and.
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and.
      &           (mask(i0,i1) .eq. 0) ) then
                U(i0,i1) = fac*(
      &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
@@ -277,6 +277,141 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the Jacobi correction Z = D^{-1} (F - A U) for A U = alpha
+c     div grad U + beta U, in which D is the diagonal part of A.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine jacobicorrection2d(
+     &     Z,Z_gcw,
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER Z_gcw,U_gcw,F_gcw
+
+      REAL alpha,beta
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Output.
+c
+      REAL Z(ilower0-Z_gcw:iupper0+Z_gcw,
+     &       ilower1-Z_gcw:iupper1+Z_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Compute the Jacobi correction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            Z(i0,i1) = fac*(
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &           F(i0,i1)) - U(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the Jacobi correction Z = D^{-1} (F - A U) for A U = alpha
+c     div grad U + beta U, in which D is the diagonal part of A, with
+c     masking of certain degrees of freedom.
+c
+c     NOTE: The correction Z is zero at masked degrees of freedom.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine jacobicorrectionmask2d(
+     &     Z,Z_gcw,
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     mask,mask_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER Z_gcw,U_gcw,F_gcw,mask_gcw
+
+      REAL alpha,beta
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &             ilower1-mask_gcw:iupper1+mask_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Output.
+c
+      REAL Z(ilower0-Z_gcw:iupper0+Z_gcw,
+     &       ilower1-Z_gcw:iupper1+Z_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Compute the Jacobi correction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if (mask(i0,i1) .eq. 0) then
+               Z(i0,i1) = fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1)) - U(i0,i1)
+            else
+               Z(i0,i1) = 0.d0
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 
 c              Variable coefficient patch smoothers
 
@@ -416,7 +551,7 @@ c
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
                facu0 = alpha0(i0+1,i1)/(hx*hx)
                facl0 = alpha0(i0,i1)/(hx*hx)
                facu1 = alpha1(i0,i1+1)/(hy*hy)
@@ -437,6 +572,84 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
+c     Compute the Jacobi correction Z = D^{-1} (F - A U) for A U = div
+c     alpha grad U + beta U, in which D is the diagonal part of A.
+c
+c     The correction is written for cell-centered U and side-centered
+c     alpha = (alpha0,alpha1)
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine vccelljacobicorrection2d(
+     &     Z,Z_gcw,
+     &     U,U_gcw,
+     &     alpha0,alpha1,alpha_gcw,
+     &     beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER Z_gcw,U_gcw,F_gcw,alpha_gcw
+
+      REAL beta
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL alpha0(SIDE2d0(ilower,iupper,alpha_gcw))
+      REAL alpha1(SIDE2d1(ilower,iupper,alpha_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Output.
+c
+      REAL Z(ilower0-Z_gcw:iupper0+Z_gcw,
+     &       ilower1-Z_gcw:iupper1+Z_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    hx,hy
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    fac
+c
+c     Compute the Jacobi correction.
+c
+      hx = dx(0)
+      hy = dx(1)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            facu0 = alpha0(i0+1,i1)/(hx*hx)
+            facl0 = alpha0(i0,i1)/(hx*hx)
+            facu1 = alpha1(i0,i1+1)/(hy*hy)
+            facl1 = alpha1(i0,i1)/(hy*hy)
+            fac   = 1.d0/(facu0+facl0+facu1+facl1-beta)
+            Z(i0,i1) = fac*(
+     &           facu0*U(i0+1,i1) +
+     &           facl0*U(i0-1,i1) +
+     &           facu1*U(i0,i1+1) +
+     &           facl1*U(i0,i1-1) -
+     &           F(i0,i1)) - U(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
 c  Perform a single Gauss-Seidel sweep for 
 c     (f0,f1) = alpha div mu (grad (u0,u1) + grad (u0, u1)^T) + beta c (u0,u1).
 c
@@ -642,7 +855,7 @@ c
       fac = 2.d0*fac0**2.d0
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0+1
-            if (mod(i0+i1,2) .eq. red_or_black) then
+            if (modulo(i0+i1,2) .eq. red_or_black) then
          
             c = beta
             if (var_c .eq. 1) then
@@ -681,7 +894,7 @@ c
       fac = 2.d0*fac1**2.d0
       do i1 = ilower1,iupper1+1
          do i0 = ilower0,iupper0
-            if (mod(i0+i1,2) .eq. red_or_black) then  
+            if (modulo(i0+i1,2) .eq. red_or_black) then  
   
             c = beta
             if (var_c .eq. 1) then
@@ -952,7 +1165,7 @@ c
       fac = 2.d0*fac0**2.d0
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0+1
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and. 
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and. 
      &           (mask0(i0,i1) .eq. 0) ) then
          
             c = beta      
@@ -992,7 +1205,7 @@ c
       fac = 2.d0*fac1**2.d0
       do i1 = ilower1,iupper1+1
          do i0 = ilower0,iupper0
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and. 
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and. 
      &           (mask1(i0,i1) .eq. 0) ) then  
   
             c = beta
@@ -1035,3 +1248,160 @@ c
 c
 
 c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c  Compute the Jacobi correction (z0,z1) = D^{-1} ((f0,f1) - A (u0,u1)) for
+c     A (u0,u1) = alpha div mu (grad (u0,u1) + grad (u0, u1)^T) + beta c (u0,u1),
+c  in which D is the diagonal part of A, with masking of certain degrees of
+c  freedom.
+c
+c     NOTE: The correction (z0,z1) is zero at masked degrees of freedom.
+c
+c  The correction is written for side-centered vector fields (u0, u1) and (f0, f1)
+c  with node-centered coefficient mu and side-centered coefficient (c0,c1)
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine vcjacobicorrectionmask2d(
+     &     z0,z1,z_gcw,
+     &     u0,u1,u_gcw,
+     &     f0,f1,f_gcw,
+     &     mask0,mask1,mask_gcw,
+     &     c0,c1,c_gcw,
+     &     mu,mu_gcw,
+     &     alpha, beta,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     var_c,
+     &     use_harmonic_interp)
+c
+      implicit none
+c
+c     Functions.
+c
+      REAL a_avg, h_avg
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER z_gcw,u_gcw,f_gcw,c_gcw,mu_gcw,mask_gcw
+      INTEGER var_c,use_harmonic_interp
+
+      REAL alpha,beta
+
+      REAL mu(NODE2d(ilower,iupper,mu_gcw))
+      
+      REAL f0(SIDE2d0(ilower,iupper,f_gcw))
+      REAL f1(SIDE2d1(ilower,iupper,f_gcw))
+
+      INTEGER mask0(SIDE2d0(ilower,iupper,mask_gcw))
+      INTEGER mask1(SIDE2d1(ilower,iupper,mask_gcw))
+      
+      REAL c0(SIDE2d0(ilower,iupper,c_gcw))
+      REAL c1(SIDE2d1(ilower,iupper,c_gcw))
+
+      REAL dx(0:NDIM-1)
+
+      REAL u0(SIDE2d0(ilower,iupper,u_gcw))
+      REAL u1(SIDE2d1(ilower,iupper,u_gcw))
+c
+c     Output.
+c
+      REAL z0(SIDE2d0(ilower,iupper,z_gcw))
+      REAL z1(SIDE2d1(ilower,iupper,z_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL fac0,fac1,fac,nmr,dnr,mu_lower,mu_upper,c
+c
+c     Compute the Jacobi correction.
+c
+      fac0 = 1.d0/(dx(0))
+      fac1 = 1.d0/(dx(1))
+
+      fac = 2.d0*fac0**2.d0
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0+1
+            if (mask0(i0,i1) .eq. 0) then
+         
+            c = beta
+            if (var_c .eq. 1) then
+               c = c0(i0,i1)*beta
+            endif       
+         
+            if (use_harmonic_interp .eq. 1) then
+                mu_upper = h_avg(mu(i0,i1),mu(i0+1,i1),
+     &                           mu(i0,i1+1),mu(i0+1,i1+1))
+                mu_lower = h_avg(mu(i0,i1),mu(i0-1,i1),
+     &                           mu(i0,i1+1),mu(i0-1,i1+1))
+            else
+                mu_upper = a_avg(mu(i0,i1),mu(i0+1,i1),
+     &                           mu(i0,i1+1),mu(i0+1,i1+1))
+                mu_lower = a_avg(mu(i0,i1),mu(i0-1,i1),
+     &                           mu(i0,i1+1),mu(i0-1,i1+1))
+            endif
+            
+            dnr =  alpha*(fac*(mu_upper + mu_lower) + 
+     &         fac1**2.d0*(mu(i0,i1+1) + mu(i0,i1))) - c
+
+            nmr = -f0(i0,i1) + alpha*(fac*(
+     &         mu_upper*u0(i0+1,i1) + mu_lower*u0(i0-1,i1))+  
+     &         fac1**2.d0*(mu(i0,i1+1)*u0(i0,i1+1)+ 
+     &            mu(i0,i1)*u0(i0,i1-1))+   
+     &         fac0*fac1*(mu(i0,i1+1)*(u1(i0,i1+1)-
+     &            u1(i0-1,i1+1))-
+     &            mu(i0,i1)*(u1(i0,i1)-u1(i0-1,i1))))               
+
+            z0(i0,i1) = nmr/dnr - u0(i0,i1)
+            else
+            z0(i0,i1) = 0.d0
+            endif
+         enddo
+      enddo
+
+      fac = 2.d0*fac1**2.d0
+      do i1 = ilower1,iupper1+1
+         do i0 = ilower0,iupper0
+            if (mask1(i0,i1) .eq. 0) then
+         
+            c = beta
+            if (var_c .eq. 1) then
+               c = c1(i0,i1)*beta
+            endif
+
+            if (use_harmonic_interp .eq. 1) then
+                mu_upper = h_avg(mu(i0,i1),mu(i0+1,i1),
+     &                           mu(i0,i1+1),mu(i0+1,i1+1))
+                mu_lower = h_avg(mu(i0,i1),mu(i0+1,i1),
+     &                           mu(i0,i1-1),mu(i0+1,i1-1))
+            else
+                mu_upper = a_avg(mu(i0,i1),mu(i0+1,i1),
+     &                           mu(i0,i1+1),mu(i0+1,i1+1))
+                mu_lower = a_avg(mu(i0,i1),mu(i0+1,i1),
+     &                           mu(i0,i1-1),mu(i0+1,i1-1))
+            endif
+        
+            dnr = alpha*(fac*(mu_upper+ mu_lower)+
+     &         fac0**2.d0*(mu(i0+1,i1) + mu(i0,i1))) - c
+
+            nmr = -f1(i0,i1) + alpha*(fac*(
+     &         mu_upper*u1(i0,i1+1) + mu_lower*u1(i0,i1-1))+
+     &         fac0**2.d0*(mu(i0+1,i1)*u1(i0+1,i1)+ 
+     &            mu(i0,i1)*u1(i0-1,i1))+
+     &         fac0*fac1*(mu(i0+1,i1)*(u0(i0+1,i1)-
+     &            u0(i0+1,i1-1))-
+     &         mu(i0,i1)*(u0(i0,i1)-u0(i0,i1-1))))  
+
+            z1(i0,i1) = nmr/dnr - u1(i0,i1)
+            else
+            z1(i0,i1) = 0.d0
+            endif
+         enddo
+      enddo
+
+c
+      return
+      end
+c
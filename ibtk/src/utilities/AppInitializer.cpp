@@ -16,6 +16,7 @@
 #include "ibtk/AppInitializer.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/RegionOfInterestDataWriter.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 #include "VisItDataWriter.h"
@@ -244,7 +245,19 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
 
         if (viz_writer == "Silo")
         {
-            d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            Pointer<Database> silo_db;
+            if (d_input_db->isDatabase("LSiloDataWriter")) silo_db = d_input_db->getDatabase("LSiloDataWriter");
+            d_silo_data_writer =
+                new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname, /*register_for_restart*/ true, silo_db);
+        }
+
+        if (viz_writer == "ROI")
+        {
+            Pointer<Database> roi_db;
+            if (d_input_db->isDatabase("RegionOfInterestDataWriter"))
+                roi_db = d_input_db->getDatabase("RegionOfInterestDataWriter");
+            d_roi_data_writer =
+                new RegionOfInterestDataWriter("RegionOfInterestDataWriter", d_viz_dump_dirname, roi_db);
         }
 
         if (viz_writer == "ExodusII")
@@ -450,6 +463,12 @@ AppInitializer::getLSiloDataWriter() const
     return d_silo_data_writer;
 } // getLSiloDataWriter
 
+Pointer<RegionOfInterestDataWriter>
+AppInitializer::getRegionOfInterestDataWriter() const
+{
+    return d_roi_data_writer;
+} // getRegionOfInterestDataWriter
+
 std::string
 AppInitializer::getExodusIIFilename(const std::string& prefix) const
 {
@@ -18,6 +18,7 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/RegionOfInterestDataWriter.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -48,6 +49,7 @@
 #include "RefinePatchStrategy.h"
 #include "RefineSchedule.h"
 #include "SideData.h"
+#include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -572,6 +574,23 @@ HierarchyIntegrator::getVisItDataWriter() const
     return d_visit_writer;
 }
 
+void
+HierarchyIntegrator::registerRegionOfInterestDataWriter(Pointer<RegionOfInterestDataWriter> roi_writer)
+{
+    d_roi_writer = roi_writer;
+    for (const auto& child_integrator : d_child_integrators)
+    {
+        child_integrator->registerRegionOfInterestDataWriter(roi_writer);
+    }
+    return;
+} // registerRegionOfInterestDataWriter
+
+Pointer<RegionOfInterestDataWriter>
+HierarchyIntegrator::getRegionOfInterestDataWriter() const
+{
+    return d_roi_writer;
+} // getRegionOfInterestDataWriter
+
 void
 HierarchyIntegrator::setupPlotData()
 {
@@ -580,6 +599,40 @@ HierarchyIntegrator::setupPlotData()
     {
         child_integrator->setupPlotData();
     }
+    if (!d_roi_writer) return;
+
+    // Plot the data that the region of interest data writer supports.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (int idx = 0; idx < d_current_data.getSize(); ++idx)
+    {
+        if (!d_current_data.isSet(idx)) continue;
+        Pointer<Variable<NDIM> > var;
+        var_db->mapIndexToVariable(idx, var);
+        Pointer<CellVariable<NDIM, double> > cc_var = var;
+        Pointer<SideVariable<NDIM, double> > sc_var = var;
+        if (!cc_var && !(sc_var && sc_var->getDepth() == 1)) continue;
+        if (!d_roi_writer->isPlotQuantityRegistered(var->getName()))
+        {
+            d_roi_writer->registerPlotQuantity(var->getName(), idx);
+        }
+    }
+
+    // Compute the refinement tags. Child integrators tag cells as part of the
+    // parent integrator's gradient detector.
+    const int tag_idx = d_roi_writer->getRefinementTagsIndex();
+    if (!d_parent_integrator && tag_idx != IBTK::invalid_index)
+    {
+        allocatePatchData(tag_idx, d_integrator_time);
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            applyGradientDetector(d_hierarchy,
+                                  ln,
+                                  d_integrator_time,
+                                  tag_idx,
+                                  /*initial_time*/ false,
+                                  /*uses_richardson_extrapolation_too*/ false);
+        }
+    }
     return;
 } // setupPlotData
 
@@ -1515,6 +1568,25 @@ HierarchyIntegrator::getGhostfillRefineSchedules(const std::string& name) const
     return sched_it->second;
 } // getGhostfillRefineSchedules
 
+void
+HierarchyIntegrator::rebuildGhostfillRefineSchedules(const std::string& name)
+{
+    auto alg_it = d_ghostfill_algs.find(name);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(alg_it != d_ghostfill_algs.end());
+#endif
+    const int finest_hier_level = d_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<RefineSchedule<NDIM> > >& ghostfill_scheds = d_ghostfill_scheds[name];
+    ghostfill_scheds.resize(finest_hier_level + 1);
+    for (int ln = 0; ln <= finest_hier_level; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        ghostfill_scheds[ln] =
+            alg_it->second->createSchedule(level, ln - 1, d_hierarchy, d_ghostfill_strategies[name].get());
+    }
+    return;
+} // rebuildGhostfillRefineSchedules
+
 const std::vector<Pointer<RefineSchedule<NDIM> > >&
 HierarchyIntegrator::getProlongRefineSchedules(const std::string& name) const
 {
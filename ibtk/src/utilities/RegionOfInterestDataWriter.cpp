@@ -0,0 +1,574 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/LSiloDataWriter.h"
+#include "ibtk/RegionOfInterestDataWriter.h"
+#include "ibtk/hdf5_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "BoxList.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "CellVariable.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "SideData.h"
+#include "SideIndex.h"
+#include "SideVariable.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include "hdf5.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The names of the HDF5 and XDMF files.
+static const int HDF5_NAME_BUFSIZE = 128;
+static const std::string HDF5_FILE_PREFIX = "roi_data.cycle_";
+static const std::string HDF5_FILE_POSTFIX = ".h5";
+static const std::string XDMF_FILE_POSTFIX = ".xmf";
+
+/*!
+ * \brief A box of the coarsened output grid of a patch, along with the
+ * physical coordinates of its lower corner and its grid spacing.
+ */
+struct OutputBox
+{
+    Box<NDIM> box;
+    std::array<double, NDIM> x_lower;
+    std::array<double, NDIM> dx;
+};
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+RegionOfInterestDataWriter::RegionOfInterestDataWriter(std::string object_name,
+                                                       std::string dump_directory_name,
+                                                       Pointer<Database> input_db)
+    : d_object_name(std::move(object_name)), d_dump_directory_name(std::move(dump_directory_name))
+{
+    if (input_db) getFromInput(input_db);
+    return;
+} // RegionOfInterestDataWriter
+
+void
+RegionOfInterestDataWriter::addRegionOfInterest(const VectorNd& x_lo, const VectorNd& x_up)
+{
+    for (int d = 0; d < NDIM; ++d)
+    {
+        if (x_lo[d] > x_up[d])
+        {
+            TBOX_ERROR(d_object_name << "::addRegionOfInterest()\n"
+                                     << "  invalid region of interest: x_lo(" << d << ") = " << x_lo[d]
+                                     << " > x_up(" << d << ") = " << x_up[d] << std::endl);
+        }
+    }
+    d_regions.push_back(std::make_pair(x_lo, x_up));
+    return;
+} // addRegionOfInterest
+
+void
+RegionOfInterestDataWriter::setRegionOfInterestIndicator(const int indicator_idx)
+{
+    d_indicator_idx = indicator_idx;
+    return;
+} // setRegionOfInterestIndicator
+
+void
+RegionOfInterestDataWriter::setUseRefinementTags(const bool use_refinement_tags)
+{
+    if (!use_refinement_tags)
+    {
+        d_tag_idx = IBTK::invalid_index;
+        return;
+    }
+    if (d_tag_idx != IBTK::invalid_index) return;
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::string tag_var_name = d_object_name + "::tags";
+    Pointer<CellVariable<NDIM, int> > tag_var;
+    if (var_db->checkVariableExists(tag_var_name))
+        tag_var = var_db->getVariable(tag_var_name);
+    else
+        tag_var = new CellVariable<NDIM, int>(tag_var_name);
+    d_tag_idx = var_db->registerVariableAndContext(tag_var, var_db->getContext(d_object_name + "::TAGS"));
+    return;
+} // setUseRefinementTags
+
+int
+RegionOfInterestDataWriter::getRefinementTagsIndex() const
+{
+    return d_tag_idx;
+} // getRefinementTagsIndex
+
+void
+RegionOfInterestDataWriter::setCoarseningFactor(const int coarsening_factor)
+{
+    if (coarsening_factor < 1)
+    {
+        TBOX_ERROR(d_object_name << "::setCoarseningFactor()\n"
+                                 << "  coarsening factor must be positive" << std::endl);
+    }
+    d_coarsening_factor = coarsening_factor;
+    return;
+} // setCoarseningFactor
+
+void
+RegionOfInterestDataWriter::setUseSinglePrecision(const bool use_single_precision)
+{
+    d_use_single_precision = use_single_precision;
+    return;
+} // setUseSinglePrecision
+
+void
+RegionOfInterestDataWriter::setFinestLevelOnly(const bool finest_level_only)
+{
+    d_finest_level_only = finest_level_only;
+    return;
+} // setFinestLevelOnly
+
+void
+RegionOfInterestDataWriter::registerPlotQuantity(const std::string& var_name, const int patch_data_idx)
+{
+    if (isPlotQuantityRegistered(var_name))
+    {
+        TBOX_ERROR(d_object_name << "::registerPlotQuantity()\n"
+                                 << "  variable with name " << var_name << " already registered for plotting"
+                                 << std::endl);
+    }
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    var_db->mapIndexToVariable(patch_data_idx, var);
+    Pointer<CellVariable<NDIM, double> > cc_var = var;
+    Pointer<SideVariable<NDIM, double> > sc_var = var;
+    if (cc_var)
+    {
+        d_var_is_side_centered.push_back(false);
+        d_var_plot_depths.push_back(cc_var->getDepth());
+    }
+    else if (sc_var && sc_var->getDepth() == 1)
+    {
+        d_var_is_side_centered.push_back(true);
+        d_var_plot_depths.push_back(NDIM);
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name << "::registerPlotQuantity()\n"
+                                 << "  variable with name " << var_name
+                                 << " is not a cell-centered or a scalar side-centered double-precision variable"
+                                 << std::endl);
+    }
+    d_var_names.push_back(var_name);
+    d_var_idxs.push_back(patch_data_idx);
+    return;
+} // registerPlotQuantity
+
+bool
+RegionOfInterestDataWriter::isPlotQuantityRegistered(const std::string& var_name) const
+{
+    return std::find(d_var_names.begin(), d_var_names.end(), var_name) != d_var_names.end();
+} // isPlotQuantityRegistered
+
+void
+RegionOfInterestDataWriter::writePlotData(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                          const int time_step_number,
+                                          const double simulation_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(time_step_number >= 0);
+#endif
+
+    if (time_step_number <= d_time_step_number)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  time step number: " << time_step_number
+                                 << " is <= last time step number: " << d_time_step_number << std::endl);
+    }
+    d_time_step_number = time_step_number;
+
+    if (d_dump_directory_name.empty())
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  dump directory name is empty" << std::endl);
+    }
+
+    // The directory may be shared with a Lagrangian data writer that is still
+    // writing asynchronously.
+    LSiloDataWriter::waitForPendingWrites(d_dump_directory_name);
+
+    Utilities::recursiveMkdir(d_dump_directory_name);
+    char temp_buf[HDF5_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+    const std::string file_name = HDF5_FILE_PREFIX + temp_buf + HDF5_FILE_POSTFIX;
+    const std::string xdmf_file_name = HDF5_FILE_PREFIX + temp_buf + XDMF_FILE_POSTFIX;
+
+    const hid_t mem_type = d_use_single_precision ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE;
+    const hid_t file_type = d_use_single_precision ? H5T_IEEE_F32LE : H5T_IEEE_F64LE;
+    const int precision = d_use_single_precision ? 4 : 8;
+    const int num_vars = static_cast<int>(d_var_names.size());
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    const int coarsest_ln = d_finest_level_only ? finest_ln : 0;
+    const int indicator_idx = getIndicatorIndex();
+    for (int ln = coarsest_ln; ln <= finest_ln && indicator_idx >= 0; ++ln)
+    {
+        if (!hierarchy->getPatchLevel(ln)->checkAllocated(indicator_idx))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  region of interest indicator data are not allocated on level " << ln
+                                     << std::endl);
+        }
+    }
+
+    // Collect the (coarsened) data in the regions of interest on each level.
+    // The cells of the output boxes of each level are stored as consecutive
+    // rows of one dataset per variable, ordered first by MPI process and then
+    // by box.
+    std::vector<std::string> group_names;
+    std::vector<HDF5DatasetRows> datasets;
+    std::vector<std::vector<std::vector<double> > > var_vals(finest_ln + 1);
+    std::vector<std::vector<std::vector<float> > > var_float_vals(finest_ln + 1);
+    std::vector<std::string> xdmf_levels;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        var_vals[ln].resize(num_vars);
+        std::vector<OutputBox> output_boxes;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            for (int d = 0; d < NDIM; ++d)
+            {
+                if (patch_box.lower(d) % d_coarsening_factor != 0 ||
+                    (patch_box.upper(d) + 1) % d_coarsening_factor != 0)
+                {
+                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                             << "  coarsening factor " << d_coarsening_factor
+                                             << " does not evenly divide patch box " << patch_box << " on level "
+                                             << ln << std::endl);
+                }
+            }
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const patch_x_lower = pgeom->getXLower();
+            const double* const patch_dx = pgeom->getDx();
+            for (const Box<NDIM>& box : getOutputBoxes(patch))
+            {
+                packBoxData(patch, box, var_vals[ln]);
+                OutputBox output_box;
+                output_box.box = box;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    output_box.x_lower[d] =
+                        patch_x_lower[d] + patch_dx[d] * (d_coarsening_factor * box.lower(d) - patch_box.lower(d));
+                    output_box.dx[d] = d_coarsening_factor * patch_dx[d];
+                }
+                output_boxes.push_back(output_box);
+            }
+        }
+        int num_local_cells = 0;
+        for (const OutputBox& output_box : output_boxes) num_local_cells += output_box.box.size();
+
+        const std::pair<hsize_t, hsize_t> cell_range = compute_hdf5_row_range(num_local_cells);
+        if (cell_range.second == 0) continue;
+
+        const std::string level_path = "/level_" + std::to_string(ln);
+        group_names.push_back(level_path);
+        if (d_use_single_precision)
+        {
+            var_float_vals[ln].resize(num_vars);
+            for (int v = 0; v < num_vars; ++v)
+            {
+                var_float_vals[ln][v].assign(var_vals[ln][v].begin(), var_vals[ln][v].end());
+                std::vector<double>().swap(var_vals[ln][v]);
+            }
+        }
+        for (int v = 0; v < num_vars; ++v)
+        {
+            const void* local_vals = var_vals[ln][v].data();
+            if (d_use_single_precision) local_vals = var_float_vals[ln][v].data();
+            datasets.push_back({ level_path + "/" + d_var_names[v],
+                                 mem_type,
+                                 file_type,
+                                 cell_range.second,
+                                 static_cast<hsize_t>(d_var_plot_depths[v]),
+                                 cell_range.first,
+                                 static_cast<hsize_t>(num_local_cells),
+                                 local_vals });
+        }
+
+        // Describe each local box as a uniform grid.
+        std::ostringstream os;
+        hsize_t cell_offset = cell_range.first;
+        for (unsigned int k = 0; k < output_boxes.size(); ++k)
+        {
+            const OutputBox& output_box = output_boxes[k];
+            const hsize_t num_cells = output_box.box.size();
+            os << "<Grid Name=\"level_" << ln << "_proc_" << IBTK_MPI::getRank() << "_box_" << k
+               << "\" GridType=\"Uniform\">\n";
+            os << "<Topology TopologyType=\"" << NDIM << "DCoRectMesh\" Dimensions=\"";
+            for (int d = NDIM - 1; d >= 0; --d) os << output_box.box.numberCells(d) + 1 << (d > 0 ? " " : "");
+            os << "\"/>\n";
+            os << "<Geometry GeometryType=\"" << (NDIM == 2 ? "ORIGIN_DXDY" : "ORIGIN_DXDYDZ") << "\">\n";
+            os << "<DataItem Dimensions=\"" << NDIM << "\" NumberType=\"Float\" Precision=\"8\" Format=\"XML\">";
+            for (int d = NDIM - 1; d >= 0; --d) os << output_box.x_lower[d] << (d > 0 ? " " : "");
+            os << "</DataItem>\n";
+            os << "<DataItem Dimensions=\"" << NDIM << "\" NumberType=\"Float\" Precision=\"8\" Format=\"XML\">";
+            for (int d = NDIM - 1; d >= 0; --d) os << output_box.dx[d] << (d > 0 ? " " : "");
+            os << "</DataItem>\n";
+            os << "</Geometry>\n";
+            for (int v = 0; v < num_vars; ++v)
+            {
+                const int depth = d_var_plot_depths[v];
+                const char* const attribute_type = depth == 1 ? "Scalar" : (depth == NDIM ? "Vector" : "Matrix");
+                os << "<Attribute Name=\"" << d_var_names[v] << "\" AttributeType=\"" << attribute_type
+                   << "\" Center=\"Cell\">\n"
+                   << xdmf_hyperslab(file_name + ":" + level_path + "/" + d_var_names[v],
+                                     cell_range.second,
+                                     depth,
+                                     cell_offset,
+                                     num_cells,
+                                     "Float",
+                                     precision)
+                   << "</Attribute>\n";
+            }
+            os << "</Grid>\n";
+            cell_offset += num_cells;
+        }
+        xdmf_levels.push_back("<Grid Name=\"level_" + std::to_string(ln) +
+                              "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n" +
+                              gather_strings_on_root(os.str()) + "</Grid>\n");
+    }
+
+    // Write the HDF5 file.
+    write_hdf5_datasets(
+        d_dump_directory_name + "/" + file_name, group_names, datasets, d_chunk_size, d_compression_level);
+
+    // Write the XDMF file on the root MPI process.
+    if (IBTK_MPI::getRank() == 0)
+    {
+        std::ofstream xdmf_file((d_dump_directory_name + "/" + xdmf_file_name).c_str(), std::ios::out);
+        xdmf_file << "<?xml version=\"1.0\" ?>\n"
+                  << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+                  << "<Xdmf Version=\"2.0\">\n"
+                  << "<Domain>\n"
+                  << "<Grid Name=\"roi_data\" GridType=\"Collection\" CollectionType=\"Spatial\">\n"
+                  << "<Time Value=\"" << simulation_time << "\"/>\n";
+        for (const std::string& xdmf_level : xdmf_levels) xdmf_file << xdmf_level;
+        xdmf_file << "</Grid>\n"
+                  << "</Domain>\n"
+                  << "</Xdmf>\n";
+    }
+
+    // The refinement tags are only needed until the data are written.
+    if (d_tag_idx != IBTK::invalid_index)
+    {
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_tag_idx)) level->deallocatePatchData(d_tag_idx);
+        }
+    }
+    IBTK_MPI::barrier();
+    return;
+} // writePlotData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+int
+RegionOfInterestDataWriter::getIndicatorIndex() const
+{
+    return d_tag_idx != IBTK::invalid_index ? d_tag_idx : d_indicator_idx;
+} // getIndicatorIndex
+
+std::vector<Box<NDIM> >
+RegionOfInterestDataWriter::getOutputBoxes(Pointer<Patch<NDIM> > patch) const
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const IntVector<NDIM> ratio(d_coarsening_factor);
+
+    // Restrict the output to the bounding box of the indicated cells.
+    Box<NDIM> base_box = patch_box;
+    const int indicator_idx = getIndicatorIndex();
+    if (indicator_idx >= 0)
+    {
+        Pointer<CellData<NDIM, int> > indicator_data = patch->getPatchData(indicator_idx);
+        base_box = Box<NDIM>();
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+        {
+            const CellIndex<NDIM>& i = ic();
+            if ((*indicator_data)(i) != 0) base_box = base_box + Box<NDIM>(i, i);
+        }
+        if (base_box.empty()) return std::vector<Box<NDIM> >();
+    }
+    const Box<NDIM> coarse_base_box = Box<NDIM>::coarsen(base_box, ratio);
+    if (d_regions.empty()) return std::vector<Box<NDIM> >(1, coarse_base_box);
+
+    // Intersect the regions of interest with the patch, and remove overlaps
+    // between regions so that no cell is written twice.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const patch_x_lower = pgeom->getXLower();
+    const double* const patch_dx = pgeom->getDx();
+    BoxList<NDIM> output_boxes;
+    for (const auto& region : d_regions)
+    {
+        Index<NDIM> region_lower, region_upper;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            region_lower(d) =
+                patch_box.lower(d) + static_cast<int>(std::floor((region.first[d] - patch_x_lower[d]) / patch_dx[d]));
+            region_upper(d) = patch_box.lower(d) +
+                              static_cast<int>(std::ceil((region.second[d] - patch_x_lower[d]) / patch_dx[d])) - 1;
+        }
+        const Box<NDIM> region_box =
+            Box<NDIM>::coarsen(Box<NDIM>(region_lower, region_upper), ratio) * coarse_base_box;
+        if (region_box.empty()) continue;
+        BoxList<NDIM> region_boxes(region_box);
+        region_boxes.removeIntersections(output_boxes);
+        for (BoxList<NDIM>::Iterator it(region_boxes); it; it++)
+        {
+            output_boxes.appendItem(it());
+        }
+    }
+    std::vector<Box<NDIM> > boxes;
+    for (BoxList<NDIM>::Iterator it(output_boxes); it; it++)
+    {
+        boxes.push_back(it());
+    }
+    return boxes;
+} // getOutputBoxes
+
+void
+RegionOfInterestDataWriter::packBoxData(Pointer<Patch<NDIM> > patch,
+                                        const Box<NDIM>& output_box,
+                                        std::vector<std::vector<double> >& var_vals) const
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const IntVector<NDIM> ratio(d_coarsening_factor);
+    for (unsigned int v = 0; v < d_var_names.size(); ++v)
+    {
+        const int depth = d_var_plot_depths[v];
+        Pointer<CellData<NDIM, double> > cc_data;
+        Pointer<SideData<NDIM, double> > sc_data;
+        if (d_var_is_side_centered[v])
+        {
+            sc_data = patch->getPatchData(d_var_idxs[v]);
+        }
+        else
+        {
+            cc_data = patch->getPatchData(d_var_idxs[v]);
+        }
+        std::vector<double>& vals = var_vals[v];
+        for (CellIterator<NDIM> ic(output_box); ic; ic++)
+        {
+            // Average over the fine cells of the patch covered by the coarse
+            // output cell.
+            const Box<NDIM> fine_box = Box<NDIM>::refine(Box<NDIM>(ic(), ic()), ratio) * patch_box;
+            const std::size_t offset = vals.size();
+            vals.resize(offset + depth, 0.0);
+            for (CellIterator<NDIM> fc(fine_box); fc; fc++)
+            {
+                const CellIndex<NDIM>& i = fc();
+                for (int d = 0; d < depth; ++d)
+                {
+                    if (sc_data)
+                    {
+                        vals[offset + d] += 0.5 * ((*sc_data)(SideIndex<NDIM>(i, d, SideIndex<NDIM>::Lower)) +
+                                                   (*sc_data)(SideIndex<NDIM>(i, d, SideIndex<NDIM>::Upper)));
+                    }
+                    else
+                    {
+                        vals[offset + d] += (*cc_data)(i, d);
+                    }
+                }
+            }
+            const double num_fine_cells = static_cast<double>(fine_box.size());
+            for (int d = 0; d < depth; ++d) vals[offset + d] /= num_fine_cells;
+        }
+    }
+    return;
+} // packBoxData
+
+void
+RegionOfInterestDataWriter::getFromInput(Pointer<Database> db)
+{
+    if (db->keyExists("coarsening_factor")) setCoarseningFactor(db->getInteger("coarsening_factor"));
+    if (db->keyExists("use_single_precision")) setUseSinglePrecision(db->getBool("use_single_precision"));
+    if (db->keyExists("finest_level_only")) setFinestLevelOnly(db->getBool("finest_level_only"));
+    if (db->keyExists("use_refinement_tags")) setUseRefinementTags(db->getBool("use_refinement_tags"));
+    if (db->keyExists("chunk_size")) d_chunk_size = db->getInteger("chunk_size");
+    if (db->keyExists("compression_level")) d_compression_level = db->getInteger("compression_level");
+    if (d_chunk_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput()\n"
+                                 << "  chunk_size must be positive" << std::endl);
+    }
+    if (d_compression_level < 0 || d_compression_level > 9)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput()\n"
+                                 << "  compression_level must be between 0 and 9" << std::endl);
+    }
+
+    // Every sub-database specifies a region of interest.
+    const Array<std::string> keys = db->getAllKeys();
+    for (int k = 0; k < keys.size(); ++k)
+    {
+        if (!db->isDatabase(keys[k])) continue;
+        Pointer<Database> region_db = db->getDatabase(keys[k]);
+        VectorNd x_lo, x_up;
+        region_db->getDoubleArray("x_lo", x_lo.data(), NDIM);
+        region_db->getDoubleArray("x_up", x_up.data(), NDIM);
+        addRegionOfInterest(x_lo, x_up);
+    }
+    return;
+} // getFromInput
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
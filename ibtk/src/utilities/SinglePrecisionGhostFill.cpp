@@ -0,0 +1,460 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/SinglePrecisionGhostFill.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "BoxTree.h"
+#include "CellData.h"
+#include "CellDataFactory.h"
+#include "CellOverlap.h"
+#include "CellVariable.h"
+#include "GridGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchLevel.h"
+#include "RefineOperator.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideOverlap.h"
+#include "SideVariable.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "tbox/Array.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Convert the values of src_data within the specified box to the value type of
+// dst_data.  The two arrays may have different ghost cell widths, but both must
+// contain the box.
+template <typename SrcType, typename DstType>
+void
+convert_array_data(const ArrayData<NDIM, SrcType>& src_data,
+                   ArrayData<NDIM, DstType>& dst_data,
+                   const Box<NDIM>& box)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src_data.getBox() * box == box);
+    TBOX_ASSERT(dst_data.getBox() * box == box);
+    TBOX_ASSERT(src_data.getDepth() == dst_data.getDepth());
+#endif
+    if (box.empty()) return;
+    const Box<NDIM>& src_box = src_data.getBox();
+    const Box<NDIM>& dst_box = dst_data.getBox();
+    const SrcType* const src_vals = src_data.getPointer();
+    DstType* const dst_vals = dst_data.getPointer();
+    const int row_length = box.numberCells(0);
+    const int num_rows = box.size() / row_length;
+    hier::Index<NDIM> i = box.lower();
+    for (int row = 0; row < num_rows; ++row)
+    {
+        // Determine the offsets of the first value in the row.
+        int src_offset = 0, dst_offset = 0, src_stride = 1, dst_stride = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            src_offset += (i(d) - src_box.lower()(d)) * src_stride;
+            dst_offset += (i(d) - dst_box.lower()(d)) * dst_stride;
+            src_stride *= src_box.numberCells(d);
+            dst_stride *= dst_box.numberCells(d);
+        }
+        for (int depth = 0; depth < src_data.getDepth(); ++depth)
+        {
+            const SrcType* const src_row = src_vals + depth * src_data.getOffset() + src_offset;
+            DstType* const dst_row = dst_vals + depth * dst_data.getOffset() + dst_offset;
+            for (int k = 0; k < row_length; ++k)
+            {
+                dst_row[k] = static_cast<DstType>(src_row[k]);
+            }
+        }
+
+        // Advance to the next row.
+        for (unsigned int d = 1; d < NDIM; ++d)
+        {
+            if (i(d) < box.upper()(d))
+            {
+                ++i(d);
+                break;
+            }
+            i(d) = box.lower()(d);
+        }
+    }
+    return;
+} // convert_array_data
+
+// Convert the values of cell- or side-centered src_data within the specified
+// boxes to the value type of dst_data.  One box list is provided for each array
+// data component.
+template <typename SrcType, typename DstType>
+void
+convert_patch_data(Pointer<PatchData<NDIM> > src_data,
+                   Pointer<PatchData<NDIM> > dst_data,
+                   const std::vector<BoxList<NDIM> >& boxes)
+{
+    Pointer<CellData<NDIM, SrcType> > src_cc_data = src_data;
+    Pointer<CellData<NDIM, DstType> > dst_cc_data = dst_data;
+    if (src_cc_data && dst_cc_data)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(boxes.size() == 1);
+#endif
+        for (BoxList<NDIM>::Iterator bl(boxes[0]); bl; bl++)
+        {
+            convert_array_data(src_cc_data->getArrayData(), dst_cc_data->getArrayData(), bl());
+        }
+        return;
+    }
+    Pointer<SideData<NDIM, SrcType> > src_sc_data = src_data;
+    Pointer<SideData<NDIM, DstType> > dst_sc_data = dst_data;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src_sc_data && dst_sc_data);
+    TBOX_ASSERT(boxes.size() == NDIM);
+#endif
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (BoxList<NDIM>::Iterator bl(boxes[axis]); bl; bl++)
+        {
+            convert_array_data(src_sc_data->getArrayData(axis), dst_sc_data->getArrayData(axis), bl());
+        }
+    }
+    return;
+} // convert_patch_data
+
+// Append the boxes of the destination ghost cell region that a same-level
+// schedule using fill_pattern fills from data on src_box.  One box list is
+// provided for each array data component.
+void
+append_overlap_boxes(std::vector<BoxList<NDIM> >& boxes,
+                     const PatchDataFactory<NDIM>& pdat_factory,
+                     const Pointer<VariableFillPattern<NDIM> > fill_pattern,
+                     const Box<NDIM>& dst_box,
+                     const Box<NDIM>& src_box)
+{
+    Pointer<BoxGeometry<NDIM> > dst_geometry = pdat_factory.getBoxGeometry(dst_box);
+    Pointer<BoxGeometry<NDIM> > src_geometry = pdat_factory.getBoxGeometry(src_box);
+    const bool overwrite_interior = false;
+    const IntVector<NDIM> src_offset(0);
+    Pointer<BoxOverlap<NDIM> > overlap =
+        fill_pattern ?
+            fill_pattern->calculateOverlap(
+                *dst_geometry, *src_geometry, dst_box, src_box, overwrite_interior, src_offset) :
+            dst_geometry->calculateOverlap(*src_geometry, src_box, overwrite_interior, src_offset);
+    Pointer<CellOverlap<NDIM> > cc_overlap = overlap;
+    Pointer<SideOverlap<NDIM> > sc_overlap = overlap;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(cc_overlap || sc_overlap);
+#endif
+    boxes.resize(cc_overlap ? 1 : NDIM);
+    for (unsigned int k = 0; k < boxes.size(); ++k)
+    {
+        const BoxList<NDIM>& overlap_boxes =
+            cc_overlap ? cc_overlap->getDestinationBoxList() : sc_overlap->getDestinationBoxList(k);
+        for (BoxList<NDIM>::Iterator bl(overlap_boxes); bl; bl++)
+        {
+            if (!bl().empty()) boxes[k].appendItem(bl());
+        }
+    }
+    return;
+} // append_overlap_boxes
+
+// Determine, for each local patch, the parts of its interior that are read by
+// a same-level ghost cell fill that uses fill_pattern (send_boxes) and the
+// parts of its ghost cell region that are filled by it (recv_boxes).  The
+// neighbors of each patch, including periodic images, are found with the box
+// tree of the level.
+void
+compute_ghost_fill_boxes(std::vector<std::vector<BoxList<NDIM> > >& send_boxes,
+                         std::vector<std::vector<BoxList<NDIM> > >& recv_boxes,
+                         const Pointer<PatchLevel<NDIM> > level,
+                         const PatchDataFactory<NDIM>& pdat_factory,
+                         const Pointer<VariableFillPattern<NDIM> > fill_pattern)
+{
+    // Enumerate the periodic shifts of the level, including the zero shift.
+    const IntVector<NDIM>& periodic_shift = level->getGridGeometry()->getPeriodicShift(level->getRatio());
+    std::vector<IntVector<NDIM> > shifts(1, IntVector<NDIM>(0));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        if (periodic_shift(axis) == 0) continue;
+        const std::size_t num_shifts = shifts.size();
+        for (std::size_t k = 0; k < num_shifts; ++k)
+        {
+            for (int sgn = -1; sgn <= 1; sgn += 2)
+            {
+                IntVector<NDIM> shift = shifts[k];
+                shift(axis) = sgn * periodic_shift(axis);
+                shifts.push_back(shift);
+            }
+        }
+    }
+
+    // Only neighbors whose interiors are within one cell of the ghost cell
+    // region can exchange data with a patch.
+    const IntVector<NDIM> search_width = pdat_factory.getGhostCellWidth() + 1;
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+    send_boxes.assign(level->getNumberOfPatches(), std::vector<BoxList<NDIM> >());
+    recv_boxes.assign(level->getNumberOfPatches(), std::vector<BoxList<NDIM> >());
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const int patch_num = p();
+        const Box<NDIM>& patch_box = level->getPatch(patch_num)->getBox();
+        const Box<NDIM> search_box = Box<NDIM>::grow(patch_box, search_width);
+        for (const auto& shift : shifts)
+        {
+            // Find the patches whose images under the shift intersect the
+            // search box.
+            Array<int> indices;
+            box_tree->findOverlapIndices(indices, Box<NDIM>::shift(search_box, -shift));
+            for (int k = 0; k < indices.getSize(); ++k)
+            {
+                const int nbr_num = indices[k];
+                if (nbr_num == patch_num && shift == IntVector<NDIM>(0)) continue;
+                const Box<NDIM> nbr_box = Box<NDIM>::shift(level_boxes[nbr_num], shift);
+                append_overlap_boxes(recv_boxes[patch_num], pdat_factory, fill_pattern, patch_box, nbr_box);
+                append_overlap_boxes(send_boxes[patch_num], pdat_factory, fill_pattern, nbr_box, patch_box);
+            }
+        }
+    }
+    return;
+} // compute_ghost_fill_boxes
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SinglePrecisionGhostFill::SinglePrecisionGhostFill(std::string object_name) : d_object_name(std::move(object_name))
+{
+    d_context = VariableDatabase<NDIM>::getDatabase()->getContext(d_object_name + "::CONTEXT");
+    return;
+} // SinglePrecisionGhostFill
+
+SinglePrecisionGhostFill::~SinglePrecisionGhostFill()
+{
+    deallocateOperatorState();
+    return;
+} // ~SinglePrecisionGhostFill
+
+void
+SinglePrecisionGhostFill::initializeOperatorState(
+    const std::vector<int>& data_idxs,
+    const std::vector<Pointer<VariableFillPattern<NDIM> > >& fill_patterns,
+    Pointer<PatchHierarchy<NDIM> > hierarchy,
+    int coarsest_ln,
+    int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(data_idxs.size() == fill_patterns.size());
+#endif
+    d_hierarchy = hierarchy;
+    if (coarsest_ln == IBTK::invalid_level_number) coarsest_ln = 0;
+    if (finest_ln == IBTK::invalid_level_number) finest_ln = d_hierarchy->getFinestLevelNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= coarsest_ln && coarsest_ln <= finest_ln && finest_ln <= d_hierarchy->getFinestLevelNumber());
+#endif
+    setupScratchData(data_idxs);
+
+    // The schedules of levels that are not reset remain valid when the
+    // algorithm is replaced.
+    d_refine_alg = new RefineAlgorithm<NDIM>();
+    for (unsigned int k = 0; k < d_scratch_idxs.size(); ++k)
+    {
+        d_refine_alg->registerRefine(d_scratch_idxs[k],
+                                     d_scratch_idxs[k],
+                                     d_scratch_idxs[k],
+                                     Pointer<RefineOperator<NDIM> >(),
+                                     fill_patterns[k]);
+    }
+
+    // NOTE: Physical boundary conditions are imposed on the double-precision
+    // data, so no patch strategy is used here.
+    const std::size_t num_levels = std::max(d_refine_scheds.size(), static_cast<std::size_t>(finest_ln + 1));
+    d_refine_scheds.resize(num_levels);
+    d_send_boxes.resize(num_levels);
+    d_recv_boxes.resize(num_levels);
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (const auto scratch_idx : d_scratch_idxs)
+        {
+            if (!level->checkAllocated(scratch_idx)) level->allocatePatchData(scratch_idx);
+        }
+        d_refine_scheds[ln] = d_refine_alg->createSchedule(level);
+        d_send_boxes[ln].resize(d_scratch_idxs.size());
+        d_recv_boxes[ln].resize(d_scratch_idxs.size());
+        for (unsigned int k = 0; k < d_scratch_idxs.size(); ++k)
+        {
+            compute_ghost_fill_boxes(d_send_boxes[ln][k],
+                                     d_recv_boxes[ln][k],
+                                     level,
+                                     *patch_descriptor->getPatchDataFactory(d_scratch_idxs[k]),
+                                     fill_patterns[k]);
+        }
+    }
+    return;
+} // initializeOperatorState
+
+void
+SinglePrecisionGhostFill::deallocateOperatorState(int coarsest_ln, int finest_ln)
+{
+    if (!d_hierarchy) return;
+    const bool deallocate_all_levels =
+        coarsest_ln == IBTK::invalid_level_number && finest_ln == IBTK::invalid_level_number;
+    if (coarsest_ln == IBTK::invalid_level_number) coarsest_ln = 0;
+    if (finest_ln == IBTK::invalid_level_number) finest_ln = static_cast<int>(d_refine_scheds.size()) - 1;
+    finest_ln = std::min(finest_ln, static_cast<int>(d_refine_scheds.size()) - 1);
+
+    for (int ln = coarsest_ln; ln <= std::min(finest_ln, d_hierarchy->getFinestLevelNumber()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (const auto scratch_idx : d_scratch_idxs)
+        {
+            if (level->checkAllocated(scratch_idx)) level->deallocatePatchData(scratch_idx);
+        }
+    }
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        d_refine_scheds[ln].setNull();
+        d_send_boxes[ln].clear();
+        d_recv_boxes[ln].clear();
+    }
+
+    if (deallocate_all_levels)
+    {
+        d_hierarchy.setNull();
+        d_refine_alg.setNull();
+        d_refine_scheds.clear();
+        d_send_boxes.clear();
+        d_recv_boxes.clear();
+    }
+    return;
+} // deallocateOperatorState
+
+void
+SinglePrecisionGhostFill::fillData(const std::vector<int>& dst_idxs, const int ln, const double fill_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_idxs.size() == d_scratch_idxs.size());
+    TBOX_ASSERT(ln < static_cast<int>(d_refine_scheds.size()) && d_refine_scheds[ln]);
+#endif
+    // Round the values that are sent to neighboring patches to single
+    // precision, fill the ghost cells of the single-precision data, and copy
+    // only the filled ghost cell values back into the double-precision data.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        for (unsigned int k = 0; k < dst_idxs.size(); ++k)
+        {
+            convert_patch_data<double, float>(patch->getPatchData(dst_idxs[k]),
+                                              patch->getPatchData(d_scratch_idxs[k]),
+                                              d_send_boxes[ln][k][p()]);
+        }
+    }
+    d_refine_scheds[ln]->fillData(fill_time);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        for (unsigned int k = 0; k < dst_idxs.size(); ++k)
+        {
+            convert_patch_data<float, double>(patch->getPatchData(d_scratch_idxs[k]),
+                                              patch->getPatchData(dst_idxs[k]),
+                                              d_recv_boxes[ln][k][p()]);
+        }
+    }
+    return;
+} // fillData
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+SinglePrecisionGhostFill::setupScratchData(const std::vector<int>& data_idxs)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = var_db->getPatchDescriptor();
+    if (d_scratch_idxs.empty()) d_scratch_idxs.resize(data_idxs.size(), IBTK::invalid_index);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_scratch_idxs.size() == data_idxs.size());
+#endif
+    for (unsigned int k = 0; k < data_idxs.size(); ++k)
+    {
+        Pointer<PatchDataFactory<NDIM> > pdat_factory = patch_descriptor->getPatchDataFactory(data_idxs[k]);
+        Pointer<CellDataFactory<NDIM, double> > cc_pdat_fac = pdat_factory;
+        Pointer<SideDataFactory<NDIM, double> > sc_pdat_fac = pdat_factory;
+        if (!cc_pdat_fac && !sc_pdat_fac)
+        {
+            TBOX_ERROR(d_object_name << "::initializeOperatorState()\n"
+                                     << "  single-precision ghost cell filling requires double-precision cell- or "
+                                        "side-centered data"
+                                     << std::endl);
+        }
+        if (d_scratch_idxs[k] == IBTK::invalid_index)
+        {
+            const std::string var_name = d_object_name + "::data_" + std::to_string(k);
+            Pointer<Variable<NDIM> > var;
+            if (var_db->checkVariableExists(var_name))
+            {
+                var = var_db->getVariable(var_name);
+            }
+            else if (cc_pdat_fac)
+            {
+                var = new CellVariable<NDIM, float>(var_name, cc_pdat_fac->getDefaultDepth());
+            }
+            else
+            {
+                var = new SideVariable<NDIM, float>(var_name, sc_pdat_fac->getDefaultDepth());
+            }
+            d_scratch_idxs[k] = var_db->registerVariableAndContext(var, d_context, pdat_factory->getGhostCellWidth());
+        }
+#if !defined(NDEBUG)
+        TBOX_ASSERT(patch_descriptor->getPatchDataFactory(d_scratch_idxs[k])->getGhostCellWidth() ==
+                    pdat_factory->getGhostCellWidth());
+#endif
+        Pointer<CellDataFactory<NDIM, float> > sp_cc_pdat_fac =
+            patch_descriptor->getPatchDataFactory(d_scratch_idxs[k]);
+        Pointer<SideDataFactory<NDIM, float> > sp_sc_pdat_fac =
+            patch_descriptor->getPatchDataFactory(d_scratch_idxs[k]);
+        if (cc_pdat_fac && sp_cc_pdat_fac) sp_cc_pdat_fac->setDefaultDepth(cc_pdat_fac->getDefaultDepth());
+        if (sc_pdat_fac && sp_sc_pdat_fac) sp_sc_pdat_fac->setDefaultDepth(sc_pdat_fac->getDefaultDepth());
+    }
+    return;
+} // setupScratchData
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
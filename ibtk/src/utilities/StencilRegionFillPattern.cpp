@@ -0,0 +1,275 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/StencilRegionFillPattern.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "BoxTree.h"
+#include "GridGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "tbox/Array.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <array>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const std::string PATTERN_NAME = "STENCIL_REGION_FILL_PATTERN";
+
+// The region of a patch is communicated as the global number of the patch
+// followed by the NDIM lower indices and the NDIM upper indices of the region.
+static const int REGION_DATA_SIZE = 1 + 2 * NDIM;
+
+// Overlaps are only provided with the box of the destination patch, so the
+// regions are stored by patch box.
+std::array<int, 2 * NDIM>
+get_patch_key(const Box<NDIM>& patch_box)
+{
+    std::array<int, 2 * NDIM> key;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        key[d] = patch_box.lower(d);
+        key[NDIM + d] = patch_box.upper(d);
+    }
+    return key;
+} // get_patch_key
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+StencilRegionFillPattern::StencilRegionFillPattern(const int stencil_width, const int region_margin)
+    : d_stencil_width(stencil_width), d_region_margin(region_margin)
+{
+    // intentionally blank
+    return;
+} // StencilRegionFillPattern
+
+void
+StencilRegionFillPattern::setRegionBoxes(Pointer<PatchLevel<NDIM> > level, const BoxList<NDIM>& local_region_boxes)
+{
+    const BoxArray<NDIM>& patch_boxes = level->getBoxes();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+    Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+
+    // Determine the region of each local patch: the bounding box of the parts
+    // of the region boxes that lie in the interior of the patch.
+    std::map<int, Box<NDIM> > local_regions;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++) local_regions[p()] = Box<NDIM>();
+    for (BoxList<NDIM>::Iterator it(local_region_boxes); it; it++)
+    {
+        Array<int> indices;
+        box_tree->findOverlapIndices(indices, it());
+        for (int k = 0; k < indices.getSize(); ++k)
+        {
+            const int patch_num = indices[k];
+            if (processor_mapping.isMappingLocal(patch_num)) local_regions[patch_num] += it() * patch_boxes[patch_num];
+        }
+    }
+    std::map<std::array<int, 2 * NDIM>, Box<NDIM> >& patch_regions = d_patch_regions[level->getLevelNumber()];
+    patch_regions.clear();
+    for (const auto& local_region : local_regions)
+    {
+        patch_regions[get_patch_key(patch_boxes[local_region.first])] = local_region.second;
+    }
+
+    // Communication schedules compute the overlaps of each transaction on both
+    // the source and the destination processes.  The region of each local
+    // patch is therefore sent to the processes that own the patches that
+    // intersect the grown region, or one of its periodic images, since only
+    // those patches can provide data to the patch.  A process that does not
+    // receive the region of a remote patch treats it as empty.
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+    const IntVector<NDIM> periodic_shift = level->getGridGeometry()->getPeriodicShift(level->getRatio());
+    int num_shifts = 1;
+    for (int d = 0; d < NDIM; ++d) num_shifts *= 3;
+    std::vector<std::vector<int> > send_data(nodes);
+    for (const auto& local_region : local_regions)
+    {
+        const Box<NDIM>& region = local_region.second;
+        if (region.empty()) continue;
+        std::set<int> src_procs;
+        for (int shift_num = 0; shift_num < num_shifts; ++shift_num)
+        {
+            Box<NDIM> stencil_box = region;
+            stencil_box.grow(d_stencil_width + IntVector<NDIM>(d_region_margin));
+            bool valid_shift = true;
+            IntVector<NDIM> shift;
+            for (int d = 0, n = shift_num; d < NDIM; ++d, n /= 3)
+            {
+                shift(d) = (n % 3 - 1) * periodic_shift(d);
+                valid_shift = valid_shift && (n % 3 == 1 || periodic_shift(d) != 0);
+            }
+            if (!valid_shift) continue;
+            stencil_box.shift(shift);
+            Array<int> indices;
+            box_tree->findOverlapIndices(indices, stencil_box);
+            for (int k = 0; k < indices.getSize(); ++k)
+            {
+                const int proc = processor_mapping.getProcessorAssignment(indices[k]);
+                if (proc != rank) src_procs.insert(proc);
+            }
+        }
+        for (const int proc : src_procs)
+        {
+            send_data[proc].push_back(local_region.first);
+            for (int d = 0; d < NDIM; ++d) send_data[proc].push_back(region.lower(d));
+            for (int d = 0; d < NDIM; ++d) send_data[proc].push_back(region.upper(d));
+        }
+    }
+
+    // Only the message sizes are exchanged with all processes.
+    std::vector<int> send_sizes(nodes), recv_sizes(nodes);
+    for (int proc = 0; proc < nodes; ++proc) send_sizes[proc] = static_cast<int>(send_data[proc].size());
+    int ierr = MPI_Alltoall(send_sizes.data(), 1, MPI_INT, recv_sizes.data(), 1, MPI_INT, IBTK_MPI::getCommunicator());
+    TBOX_ASSERT(ierr == 0);
+    std::vector<std::vector<int> > recv_data(nodes);
+    std::vector<MPI_Request> requests;
+    for (int proc = 0; proc < nodes; ++proc)
+    {
+        if (recv_sizes[proc] == 0) continue;
+        recv_data[proc].resize(recv_sizes[proc]);
+        MPI_Request request;
+        ierr = MPI_Irecv(
+            recv_data[proc].data(), recv_sizes[proc], MPI_INT, proc, 0, IBTK_MPI::getCommunicator(), &request);
+        TBOX_ASSERT(ierr == 0);
+        requests.push_back(request);
+    }
+    for (int proc = 0; proc < nodes; ++proc)
+    {
+        if (send_sizes[proc] == 0) continue;
+        MPI_Request request;
+        ierr = MPI_Isend(
+            send_data[proc].data(), send_sizes[proc], MPI_INT, proc, 0, IBTK_MPI::getCommunicator(), &request);
+        TBOX_ASSERT(ierr == 0);
+        requests.push_back(request);
+    }
+    ierr = MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    TBOX_ASSERT(ierr == 0);
+
+    for (const std::vector<int>& region_data : recv_data)
+    {
+        for (std::size_t k = 0; k < region_data.size(); k += REGION_DATA_SIZE)
+        {
+            hier::Index<NDIM> lower, upper;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                lower(d) = region_data[k + 1 + d];
+                upper(d) = region_data[k + 1 + NDIM + d];
+            }
+            patch_regions[get_patch_key(patch_boxes[region_data[k]])] = Box<NDIM>(lower, upper);
+        }
+    }
+    return;
+} // setRegionBoxes
+
+void
+StencilRegionFillPattern::clearRegionBoxes()
+{
+    d_patch_regions.clear();
+    return;
+} // clearRegionBoxes
+
+Pointer<BoxOverlap<NDIM> >
+StencilRegionFillPattern::calculateOverlap(const BoxGeometry<NDIM>& dst_geometry,
+                                           const BoxGeometry<NDIM>& src_geometry,
+                                           const Box<NDIM>& /*dst_patch_box*/,
+                                           const Box<NDIM>& src_mask,
+                                           const bool overwrite_interior,
+                                           const IntVector<NDIM>& src_offset) const
+{
+    return dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+} // calculateOverlap
+
+Pointer<BoxOverlap<NDIM> >
+StencilRegionFillPattern::calculateOverlapOnLevel(const BoxGeometry<NDIM>& dst_geometry,
+                                                  const BoxGeometry<NDIM>& src_geometry,
+                                                  const Box<NDIM>& dst_patch_box,
+                                                  const Box<NDIM>& src_mask,
+                                                  const bool overwrite_interior,
+                                                  const IntVector<NDIM>& src_offset,
+                                                  const int dst_level_num,
+                                                  const int /*src_level_num*/) const
+{
+    const auto level_it = d_patch_regions.find(dst_level_num);
+    if (dst_level_num != d_target_level_num || level_it == d_patch_regions.end())
+    {
+        return dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+    }
+
+    // Grow the region of the destination patch by the margin and the stencil
+    // width, and map it to the source index space.  An empty box yields an
+    // empty overlap.
+    Box<NDIM> stencil_box;
+    const auto region_it = level_it->second.find(get_patch_key(dst_patch_box));
+    if (region_it != level_it->second.end() && !region_it->second.empty())
+    {
+        stencil_box = region_it->second;
+        stencil_box.grow(d_stencil_width + IntVector<NDIM>(d_region_margin));
+        stencil_box.shift(-src_offset);
+    }
+    return dst_geometry.calculateOverlap(src_geometry, src_mask * stencil_box, overwrite_interior, src_offset);
+} // calculateOverlapOnLevel
+
+void
+StencilRegionFillPattern::setTargetPatchLevelNumber(const int level_num)
+{
+    d_target_level_num = level_num;
+    return;
+} // setTargetPatchLevelNumber
+
+IntVector<NDIM>&
+StencilRegionFillPattern::getStencilWidth()
+{
+    return d_stencil_width;
+} // getStencilWidth
+
+const std::string&
+StencilRegionFillPattern::getPatternName() const
+{
+    return PATTERN_NAME;
+} // getPatternName
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
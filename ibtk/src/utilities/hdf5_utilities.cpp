@@ -0,0 +1,245 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/hdf5_utilities.h"
+
+#include "tbox/Utilities.h"
+
+#include "hdf5.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The rank of the root MPI process.
+static const int HDF5_MPI_ROOT = 0;
+
+void
+create_dataset(const hid_t file_id, const HDF5DatasetRows& dataset, const int chunk_size, const int compression_level)
+{
+    const hsize_t dims[2] = { dataset.num_rows, dataset.num_cols };
+    const hsize_t chunk_dims[2] = { std::min<hsize_t>(chunk_size, dataset.num_rows), dataset.num_cols };
+    const hid_t space_id = H5Screate_simple(2, dims, nullptr);
+    const hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcpl_id, 2, chunk_dims);
+    if (compression_level > 0) H5Pset_deflate(dcpl_id, compression_level);
+    const hid_t dataset_id =
+        H5Dcreate2(file_id, dataset.path.c_str(), dataset.file_type, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    if (dataset_id < 0)
+    {
+        TBOX_ERROR("IBTK::write_hdf5_datasets()\n"
+                   << "  Could not create HDF5 dataset " << dataset.path << std::endl);
+    }
+    H5Dclose(dataset_id);
+    H5Pclose(dcpl_id);
+    H5Sclose(space_id);
+    return;
+} // create_dataset
+
+// When collective I/O is used, this function must be called on all MPI
+// processes, including those that do not have any rows to write.
+void
+write_dataset(const hid_t file_id, const hid_t dxpl_id, const HDF5DatasetRows& dataset)
+{
+    const hid_t dataset_id = H5Dopen2(file_id, dataset.path.c_str(), H5P_DEFAULT);
+    const hid_t file_space_id = H5Dget_space(dataset_id);
+    const hsize_t mem_dims[2] = { dataset.num_local_rows, dataset.num_cols };
+    const hid_t mem_space_id = H5Screate_simple(2, mem_dims, nullptr);
+    if (dataset.num_local_rows > 0)
+    {
+        const hsize_t start[2] = { dataset.row_offset, 0 };
+        H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start, nullptr, mem_dims, nullptr);
+    }
+    else
+    {
+        H5Sselect_none(file_space_id);
+        H5Sselect_none(mem_space_id);
+    }
+    if (H5Dwrite(dataset_id, dataset.mem_type, mem_space_id, file_space_id, dxpl_id, dataset.local_vals) < 0)
+    {
+        TBOX_ERROR("IBTK::write_hdf5_datasets()\n"
+                   << "  Could not write HDF5 dataset " << dataset.path << std::endl);
+    }
+    H5Sclose(mem_space_id);
+    H5Sclose(file_space_id);
+    H5Dclose(dataset_id);
+    return;
+} // write_dataset
+
+void
+create_file_layout(const hid_t file_id,
+                   const std::vector<std::string>& group_names,
+                   const std::vector<HDF5DatasetRows>& datasets,
+                   const int chunk_size,
+                   const int compression_level)
+{
+    for (const std::string& group_name : group_names)
+    {
+        const hid_t group_id = H5Gcreate2(file_id, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Gclose(group_id);
+    }
+    for (const HDF5DatasetRows& dataset : datasets)
+    {
+        create_dataset(file_id, dataset, chunk_size, compression_level);
+    }
+    return;
+} // create_file_layout
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+std::pair<hsize_t, hsize_t>
+compute_hdf5_row_range(const int num_local_rows)
+{
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int mpi_nodes = IBTK_MPI::getNodes();
+    std::vector<int> num_rows_per_proc(mpi_nodes);
+    IBTK_MPI::allGather(num_local_rows, num_rows_per_proc.data());
+    hsize_t row_offset = 0, num_rows = 0;
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        if (proc < mpi_rank) row_offset += num_rows_per_proc[proc];
+        num_rows += num_rows_per_proc[proc];
+    }
+    return std::make_pair(row_offset, num_rows);
+} // compute_hdf5_row_range
+
+void
+write_hdf5_datasets(const std::string& file_path,
+                    const std::vector<std::string>& group_names,
+                    const std::vector<HDF5DatasetRows>& datasets,
+                    const int chunk_size,
+                    const int compression_level)
+{
+#if defined(H5_HAVE_PARALLEL)
+    const hid_t fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl_id, IBTK_MPI::getCommunicator(), MPI_INFO_NULL);
+    const hid_t file_id = H5Fcreate(file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    H5Pclose(fapl_id);
+    if (file_id < 0)
+    {
+        TBOX_ERROR("IBTK::write_hdf5_datasets()\n"
+                   << "  Could not create HDF5 file named " << file_path << std::endl);
+    }
+    create_file_layout(file_id, group_names, datasets, chunk_size, compression_level);
+    const hid_t dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE);
+    for (const HDF5DatasetRows& dataset : datasets)
+    {
+        write_dataset(file_id, dxpl_id, dataset);
+    }
+    H5Pclose(dxpl_id);
+    H5Fclose(file_id);
+#else
+    // Without MPI-IO, the processes take turns writing to the file.
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int mpi_nodes = IBTK_MPI::getNodes();
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        if (proc == mpi_rank)
+        {
+            const hid_t file_id = proc == 0 ? H5Fcreate(file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT) :
+                                              H5Fopen(file_path.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+            if (file_id < 0)
+            {
+                TBOX_ERROR("IBTK::write_hdf5_datasets()\n"
+                           << "  Could not open HDF5 file named " << file_path << std::endl);
+            }
+            if (proc == 0) create_file_layout(file_id, group_names, datasets, chunk_size, compression_level);
+            for (const HDF5DatasetRows& dataset : datasets)
+            {
+                if (dataset.num_local_rows > 0) write_dataset(file_id, H5P_DEFAULT, dataset);
+            }
+            H5Fclose(file_id);
+        }
+        IBTK_MPI::barrier();
+    }
+#endif
+    return;
+} // write_hdf5_datasets
+
+std::string
+xdmf_hyperslab(const std::string& h5_path,
+               const hsize_t num_rows,
+               const hsize_t num_cols,
+               const hsize_t row_offset,
+               const hsize_t count,
+               const std::string& number_type,
+               const int precision)
+{
+    std::ostringstream os;
+    os << "<DataItem ItemType=\"HyperSlab\" Dimensions=\"" << count << " " << num_cols << "\" Type=\"HyperSlab\">\n"
+       << "<DataItem Dimensions=\"3 2\" Format=\"XML\">" << row_offset << " 0 1 1 " << count << " " << num_cols
+       << "</DataItem>\n"
+       << "<DataItem Dimensions=\"" << num_rows << " " << num_cols << "\" NumberType=\"" << number_type
+       << "\" Precision=\"" << precision << "\" Format=\"HDF\">" << h5_path << "</DataItem>\n"
+       << "</DataItem>\n";
+    return os.str();
+} // xdmf_hyperslab
+
+std::string
+gather_strings_on_root(const std::string& local_str)
+{
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int mpi_nodes = IBTK_MPI::getNodes();
+    const bool is_root = mpi_rank == HDF5_MPI_ROOT;
+    int send_size = static_cast<int>(local_str.size());
+    std::vector<int> recv_sizes(is_root ? mpi_nodes : 0), recv_offsets(is_root ? mpi_nodes : 0);
+    MPI_Gather(&send_size, 1, MPI_INT, recv_sizes.data(), 1, MPI_INT, HDF5_MPI_ROOT, IBTK_MPI::getCommunicator());
+    std::vector<char> recv_buf;
+    if (is_root)
+    {
+        int recv_size = 0;
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            recv_offsets[proc] = recv_size;
+            recv_size += recv_sizes[proc];
+        }
+        recv_buf.resize(recv_size);
+    }
+    MPI_Gatherv(const_cast<char*>(local_str.data()),
+                send_size,
+                MPI_CHAR,
+                recv_buf.data(),
+                recv_sizes.data(),
+                recv_offsets.data(),
+                MPI_CHAR,
+                HDF5_MPI_ROOT,
+                IBTK_MPI::getCommunicator());
+    return std::string(recv_buf.begin(), recv_buf.end());
+} // gather_strings_on_root
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
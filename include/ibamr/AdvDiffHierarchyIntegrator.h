@@ -625,6 +625,10 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_helmholtz_solvers;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_helmholtz_rhs_ops;
     std::vector<bool> d_helmholtz_solvers_need_init, d_helmholtz_rhs_ops_need_init;
+
+    // Whether the Helmholtz solvers and right-hand side operators were provided
+    // with setHelmholtzSolver() and setHelmholtzRHSOperator().
+    std::vector<bool> d_helmholtz_solvers_user_provided, d_helmholtz_rhs_ops_user_provided;
     int d_coarsest_reset_ln = IBTK::invalid_level_number, d_finest_reset_ln = IBTK::invalid_level_number;
 
 private:
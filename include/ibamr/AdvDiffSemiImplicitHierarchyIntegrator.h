@@ -33,6 +33,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace IBAMR
 {
@@ -57,6 +58,10 @@ namespace pdat
 template <int DIM, class TYPE>
 class CellVariable;
 } // namespace pdat
+namespace solv
+{
+class PoissonSpecifications;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -80,6 +85,26 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When the input database entry \p batch_helmholtz_solves is \p TRUE (the
+ * default is \p FALSE), quantities that have identical Helmholtz operators
+ * (i.e., the same diffusion time stepping type, damping coefficient, and
+ * constant diffusion coefficient or diffusion coefficient variable) are
+ * advanced using a single linear solve for a multi-component quantity, which
+ * amortizes the communication and operator setup costs over the quantities.
+ * The quantities may have different boundary conditions.  The groups are
+ * determined when the integrator is initialized and are checked at the
+ * beginning of each time step.  If the Helmholtz operators of the quantities
+ * in a group no longer agree (e.g., because a diffusion coefficient was
+ * changed), those quantities are advanced individually until they agree again.
+ * The batched solves use solvers allocated from the Helmholtz solver and
+ * preconditioner settings of the integrator.  Quantities whose Helmholtz
+ * solvers or right-hand side operators are provided with setHelmholtzSolver()
+ * or setHelmholtzRHSOperator() are always advanced individually.  The relative
+ * tolerance of each batched solve is scaled by the ratio of the smallest
+ * nonzero norm of the right-hand side of any data depth to the norm of the
+ * combined right-hand side, so that the residual of each quantity is reduced
+ * at least as much as it would be by an individual solve.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -384,6 +409,55 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Set the problem coefficients of the Helmholtz solver and the RHS operator
+     * for the specified quantity and time step size.
+     */
+    void setHelmholtzSpecifications(SAMRAI::solv::PoissonSpecifications& solver_spec,
+                                    SAMRAI::solv::PoissonSpecifications& rhs_op_spec,
+                                    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var,
+                                    double dt);
+
+    /*!
+     * Group together the quantities whose Helmholtz systems are solved
+     * simultaneously, and setup the corresponding variables, operators, and
+     * solvers.
+     */
+    void setupHelmholtzBatches();
+
+    /*!
+     * Determine whether the Helmholtz systems of the specified quantities
+     * require linear solves with identical operators.
+     */
+    bool haveSameHelmholtzOperator(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q1_var,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q2_var);
+
+    /*!
+     * Determine which batches can be used for the current time step.  The
+     * quantities in a batch whose Helmholtz operators no longer agree are
+     * advanced individually.
+     */
+    void updateActiveHelmholtzBatches();
+
+    /*!
+     * Data for solving the Helmholtz systems of several quantities
+     * simultaneously.  For each quantity, we store the number of the batch that
+     * contains it (or -1) and the depth of its components in the batch data.
+     * For each batch, we store whether it is used for the current time step
+     * and whether its operator and solver must be reinitialized before it is
+     * used again.
+     */
+    bool d_batch_helmholtz_solves = false;
+    std::vector<int> d_Q_helmholtz_batch, d_Q_helmholtz_batch_depth_offset;
+    std::vector<std::vector<unsigned int> > d_helmholtz_batch_Q_idxs;
+    std::vector<bool> d_helmholtz_batch_active, d_helmholtz_batch_needs_init;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > > d_helmholtz_batch_sol_var,
+        d_helmholtz_batch_rhs_var;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_helmholtz_batch_sol_vecs,
+        d_helmholtz_batch_rhs_vecs;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_helmholtz_batch_solvers;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_helmholtz_batch_rhs_ops;
 };
 } // namespace IBAMR
 
@@ -37,7 +37,9 @@
 #include "petscvec.h"
 
 #include <iosfwd>
+#include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -268,6 +270,16 @@ public:
         double init_data_time,
         bool initial_time) override;
 
+    /*!
+     * \brief Complete redistributing Lagrangian data following regridding the
+     * patch hierarchy.
+     *
+     * \note This also invalidates the cached scatters used by
+     * copyVecToArray() and copyArrayToVec().
+     */
+    void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg) override;
+
     /*!
      * \brief Interpolate the Eulerian velocity to the curvilinear mesh at the
      * specified time within the current time interval.
@@ -439,6 +451,27 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::applyMobilityOperator() method.
+    /*!
+     * \brief Apply the RPY mobility matrix of the structures identified by
+     * their indices without forming it.
+     *
+     * The positions and forces of the structures are broadcast to all
+     * processes, each of which builds the tree and evaluates the velocities of
+     * a contiguous range of markers.  The velocities are summed and the
+     * regulator term is added on \p managing_rank.
+     */
+    void applyMobilityOperator(Vec L,
+                               Vec V,
+                               MobilityMatrixType mat_type,
+                               const std::vector<unsigned>& struct_ids,
+                               const double* grid_dx,
+                               double mu,
+                               const std::pair<double, double>& scale,
+                               double f_periodic_corr,
+                               double opening_angle,
+                               const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
@@ -542,6 +575,38 @@ protected:
     bool d_use_steady_stokes = false;
 
 private:
+    /*!
+     * \brief Scatter between a Lagrangian vector and the array of the
+     * specified structures, together with a vector that wraps the array.
+     */
+    struct ArrayScatter
+    {
+        VecScatter scatter = nullptr;
+        Vec array_vec = nullptr;
+        PetscInt vec_local_size = 0, vec_global_size = 0;
+    };
+
+    /*!
+     * \brief Return the cached scatter from Lagrangian vectors with the layout
+     * of \a b to the array of the specified structures, creating it if needed.
+     */
+    const ArrayScatter& getArrayScatter(Vec b,
+                                        const std::vector<unsigned>& struct_ids,
+                                        int data_depth,
+                                        int array_rank);
+
+    /*!
+     * \brief Destroy all cached array scatters.
+     */
+    void clearArrayScatters();
+
+    /*!
+     * Scatters used by copyVecToArray() and copyArrayToVec(), keyed by the
+     * structure ids, data depth, and rank of the array.  They remain valid
+     * until the Lagrangian data are redistributed.
+     */
+    std::map<std::tuple<std::vector<unsigned>, int, int>, ArrayScatter> d_array_scatters;
+
     /*!
      * \brief Set additional values from input database.
      */
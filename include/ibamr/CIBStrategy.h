@@ -509,6 +509,48 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Apply the mobility matrix of the structures identified by their
+     * indices to a Lagrangian force vector without forming the matrix. The
+     * operator is scaled in the same way as in constructMobilityMatrix().
+     * \note A default implementation that raises an error is provided in this
+     * class. The derived class provides the actual implementation.
+     *
+     * \param L Lagrangian force vector (input).
+     *
+     * \param V Lagrangian velocity vector (output).
+     *
+     * \param mat_type Mobility matrix type. Only RPY is supported by the
+     * default derived class implementation.
+     *
+     * \param struct_ids Indices of the structures as registered with \see
+     * IBAMR::IBStrategy class.
+     *
+     * \param grid_dx NDIM vector of grid spacing of structure level.
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param scale Scale for the operator, which is applied as
+     * \f$ \alpha * mobility + \beta * regulator. \f$
+     *
+     * \param f_periodic_corr Periodic domain correction of the mobility.
+     *
+     * \param opening_angle Accuracy parameter of the tree approximation, see
+     * MobilityFunctions::applyRPYMobilityOperator().
+     *
+     * \param managing_rank Rank of the processor that evaluates the operator.
+     */
+    virtual void applyMobilityOperator(Vec L,
+                                       Vec V,
+                                       MobilityMatrixType mat_type,
+                                       const std::vector<unsigned>& struct_ids,
+                                       const double* grid_dx,
+                                       double mu,
+                                       const std::pair<double, double>& scale,
+                                       double f_periodic_corr,
+                                       double opening_angle,
+                                       const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
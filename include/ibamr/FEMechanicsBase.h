@@ -45,6 +45,15 @@ namespace IBAMR
 /*!
  * @brief      Class FEMechanicsBase provides core finite element mechanics
  *             functionality and data management.
+ *
+ * If the input database entry <code>use_threaded_force_assembly</code> is
+ * <code>TRUE</code> and IBAMR is compiled with OpenMP, the elemental
+ * contributions of the PK1 stress functions to the interior force density are
+ * computed by multiple threads.  The elemental vectors are added to the global
+ * vector in the same order as in the serial algorithm, so the results do not
+ * depend on the number of threads.  All registered PK1 stress functions must
+ * then be thread-safe (see registerPK1StressFunction()).  Defaults to
+ * <code>FALSE</code>.
  */
 class FEMechanicsBase : public SAMRAI::tbox::Serializable
 {
@@ -175,7 +184,15 @@ public:
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
     /*!
-     * Struct encapsulating PK1 stress tensor function data.
+     * Typedef specifying interface for a PK1 stress tensor function that is
+     * evaluated at all quadrature points of an element at once.  See
+     * IBTK::TensorMeshBatchFcnPtr for the layout of the data.
+     */
+    using PK1StressBatchFcnPtr = IBTK::TensorMeshBatchFcnPtr;
+
+    /*!
+     * Struct encapsulating PK1 stress tensor function data.  Exactly one of
+     * fcn and batch_fcn should be provided.
      */
     struct PK1StressFcnData
     {
@@ -184,11 +201,53 @@ public:
                          void* const ctx = nullptr,
                          const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
                          const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), system_data(std::move(system_data)), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+            : fcn(fcn),
+              batch_fcn(nullptr),
+              system_data(std::move(system_data)),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
+        {
+        }
+
+        PK1StressFcnData(PK1StressBatchFcnPtr batch_fcn,
+                         std::vector<IBTK::SystemData> system_data = {},
+                         void* const ctx = nullptr,
+                         const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : fcn(nullptr),
+              batch_fcn(batch_fcn),
+              system_data(std::move(system_data)),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
+        {
+        }
+
+        /*!
+         * Whether or not a stress function has been provided.
+         */
+        bool isSet() const
         {
+            return fcn || batch_fcn;
         }
 
+        /*!
+         * Evaluate the stress function at a single point.  The arguments are
+         * the same as those of PK1StressFcnPtr; if only a batched function is
+         * provided, it is called with a single quadrature point.
+         */
+        void evaluate(libMesh::TensorValue<double>& PP,
+                      const libMesh::TensorValue<double>& FF,
+                      const libMesh::Point& x,
+                      const libMesh::Point& X,
+                      libMesh::Elem* elem,
+                      const std::vector<const std::vector<double>*>& system_var_data,
+                      const std::vector<const std::vector<libMesh::VectorValue<double> >*>& system_grad_var_data,
+                      double data_time) const;
+
         PK1StressFcnPtr fcn;
+        PK1StressBatchFcnPtr batch_fcn;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -203,6 +262,17 @@ public:
      * @note       It is possible to register multiple PK1 stress functions with
      *             this class.  This is intended to be used to implement
      *             selective reduced integration.
+     *
+     * @note       Stress functions registered with a batched implementation
+     *             (PK1StressFcnData::batch_fcn) are called once per element
+     *             with the data at all quadrature points when assembling the
+     *             interior force density.
+     *
+     * @note       When threaded force assembly is enabled, the function may be
+     *             called concurrently for different elements.  It must then
+     *             only write to its output tensor and must treat the context
+     *             pointer and all other shared data as read-only (or protect
+     *             any modifications to them).
      */
     void registerPK1StressFunction(const PK1StressFcnData& data, unsigned int part = 0);
 
@@ -540,6 +610,7 @@ protected:
     std::vector<libMesh::QuadratureType> d_default_quad_type_stress, d_default_quad_type_force;
     std::vector<libMesh::Order> d_default_quad_order_stress, d_default_quad_order_force;
     bool d_use_consistent_mass_matrix = true;
+    bool d_use_threaded_force_assembly = false;
     bool d_include_normal_stress_in_weak_form = false;
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
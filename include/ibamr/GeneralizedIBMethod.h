@@ -128,6 +128,13 @@ public:
         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
         double data_time) override;
 
+    /*!
+     * The angular velocity is interpolated from the curl of the Eulerian
+     * velocity, which is computed on every patch of the level from the
+     * velocity ghost cell data, so this method always returns false.
+     */
+    bool computeInterpolationRegionBoxes(SAMRAI::hier::BoxList<NDIM>& region_boxes, int level_number) override;
+
     /*!
      * Advance the positions of the Lagrangian structure using the forward Euler
      * method.
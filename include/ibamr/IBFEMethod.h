@@ -163,6 +163,13 @@ class IBFEDirectForcingKinematics;
  *   <li><code>spread_use_nodal_quadrature</code>: Same as above, but for spreading.
  *   <li><code>IB_use_nodal_quadrature</code>: overriding alias for the two previous
  *   entries - has the same default.</li>
+ *   <li><code>cache_quadrature_data</code>: Whether or not the quadrature
+ *   rules, quadrature point positions, and JxW values computed during
+ *   interpolation and spreading should be reused while the structure
+ *   configuration does not change (e.g., when velocity interpolation and
+ *   force spreading happen at the same position in a time step). See
+ *   IBTK::FEDataManager::setQuadratureDataCachingEnabled(). Defaults to
+ *   <code>FALSE</code>.</li>
  * </ul>
  *
  * <h2>Options Controlling libMesh Partitioning</h2>
@@ -562,6 +569,14 @@ public:
         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
         double data_time) override;
 
+    /*!
+     * Compute the boxes of the local patches of the specified level that
+     * contain active elements of any active part.  Returns false when the
+     * scratch hierarchy is used, since the ghost cell data are then filled
+     * independently of the patch hierarchy.
+     */
+    bool computeInterpolationRegionBoxes(SAMRAI::hier::BoxList<NDIM>& region_boxes, int level_number) override;
+
     /*!
      * Advance the positions of the Lagrangian structure using the forward Euler
      * method.
@@ -602,6 +617,23 @@ public:
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
                 double data_time) override;
 
+    /*!
+     * Interpolate the Eulerian velocity to the curvilinear mesh and spread the
+     * Lagrangian force to the Cartesian grid at the specified time within the
+     * current time interval. This is equivalent to calling
+     * interpolateVelocity() and then spreadForce(), except that the quadrature
+     * points of each part are computed once and each patch is visited once
+     * (see FEDataManager::interpWeightedAndSpread()).
+     */
+    void interpolateVelocityAndSpreadForce(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& u_synch_scheds,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        int f_data_idx,
+        IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
+        double data_time) override;
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      */
@@ -996,6 +1028,7 @@ protected:
     std::vector<IBTK::FEDataManager::WorkloadSpec> d_workload_spec;
     std::vector<IBTK::FEDataManager::InterpSpec> d_interp_spec;
     std::vector<IBTK::FEDataManager::SpreadSpec> d_spread_spec;
+    bool d_cache_quadrature_data = false;
     bool d_split_normal_force = false, d_split_tangential_force = false;
     bool d_use_jump_conditions = false;
 
@@ -1090,6 +1123,41 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Fill the ghost data (on the active hierarchy) of the velocity before
+     * interpolation.
+     */
+    void fillVelocityGhostData(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        double data_time);
+
+    /*!
+     * Communicate and constrain the assembled right-hand sides of the
+     * interpolated velocity and solve for the velocity on each part.
+     */
+    void solveVelocityProjection(const std::vector<libMesh::PetscVector<double>*>& U_rhs_vecs,
+                                 const std::vector<libMesh::PetscVector<double>*>& U_vecs);
+
+    /*!
+     * Zero the scratch force data on the active hierarchy and return its
+     * patch data index.
+     */
+    int zeroForceScratchData(int f_data_idx);
+
+    /*!
+     * Finish spreading the force after the interior force density has been
+     * spread to @p f_scratch_data_idx: handle transmission conditions and
+     * physical boundaries, accumulate ghost data, and add the result to @p
+     * f_data_idx.
+     */
+    void finishSpreadForce(int f_data_idx,
+                           int f_scratch_data_idx,
+                           IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                           const std::vector<libMesh::PetscVector<double>*>& X_IB_ghost_vecs,
+                           const std::vector<libMesh::PetscVector<double>*>& F_IB_ghost_vecs,
+                           double data_time);
+
     /*!
      * At the present time this class and FEDataManager assume that the finite
      * element mesh is always on the finest grid level. This function
@@ -27,6 +27,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/LMarkerSetVariable.h"
+#include "ibtk/StencilRegionFillPattern.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CellVariable.h"
@@ -334,6 +335,18 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_u_coarsen_alg, d_p_coarsen_alg;
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenOperator<NDIM> > d_u_coarsen_op, d_p_coarsen_op;
 
+    /*
+     * When enabled (via the input key use_stencil_region_ghost_fill), the
+     * velocity ghost cell-filling schedules only fill the ghost cells within
+     * the IB ghost cell width of the cells at which the IBStrategy object
+     * interpolates the velocity, grown by the distance the structure can move
+     * before the next regrid (which requires a positive regrid_cfl_interval).
+     * The fill pattern regions are reset, and the schedules are rebuilt,
+     * whenever the Lagrangian data are redistributed.
+     */
+    bool d_use_stencil_region_ghost_fill = false;
+    SAMRAI::tbox::Pointer<IBTK::StencilRegionFillPattern> d_u_ghostfill_pattern;
+
     /*
      * Body force functions.
      */
@@ -534,6 +547,13 @@ private:
      */
     IBHierarchyIntegrator& operator=(const IBHierarchyIntegrator& that) = delete;
 
+    /*!
+     * Reset the regions of the velocity ghost cell fill pattern following the
+     * redistribution of the Lagrangian data, and rebuild the velocity ghost
+     * cell-filling schedules.
+     */
+    void resetVelocityGhostfillRegions();
+
     /*!
      * Read input values from a given database.
      */
@@ -247,6 +247,12 @@ public:
         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
         double data_time) override;
 
+    /*!
+     * Compute the bounding boxes of the cells of each local patch of the
+     * specified level that contain Lagrangian nodes.
+     */
+    bool computeInterpolationRegionBoxes(SAMRAI::hier::BoxList<NDIM>& region_boxes, int level_number) override;
+
     /*!
      * Advance the positions of the Lagrangian structure using the forward Euler
      * method.
@@ -544,6 +550,8 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn = "IB_4", d_spread_kernel_fcn = "IB_4";
     bool d_error_if_points_leave_domain = false;
+    bool d_use_morton_ordering = false;
+    std::string d_ldata_restart_dirname;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
     /*
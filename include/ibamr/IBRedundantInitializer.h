@@ -68,6 +68,18 @@ namespace IBAMR
  *
  * \todo Document input database entries.
  *
+ * <B>Structure cache</B>
+ *
+ * If the input database provides <TT>structure_cache_filename</TT>, the fully
+ * processed vertex, spring, crosslink spring, beam, rod, target point, anchor
+ * point, boundary mass, and director data are written to that file the first
+ * time that they are generated, and are read back from it instead of being
+ * regenerated on subsequent runs.  The cache is tagged with a key, and a cache
+ * whose key does not match is ignored and overwritten.  For this class, the key
+ * consists of the structure names and the optional input string
+ * <TT>structure_cache_key</TT>, which should be changed whenever the functions
+ * that generate the structures change.  Instrumentation and source data are
+ * always regenerated.
  */
 class IBRedundantInitializer : public IBTK::LInitStrategy
 {
@@ -546,6 +558,26 @@ protected:
      */
     void initializeSourceData();
 
+    /*!
+     * \brief Write the vertex, spring, crosslink spring, beam, rod, target
+     * point, anchor point, boundary mass, and director data to a structure
+     * cache file tagged with the specified key.
+     *
+     * \note The file is written only by MPI process 0.
+     */
+    void writeStructureCache(const std::string& filename, const std::string& key) const;
+
+    /*!
+     * \brief Read the data written by writeStructureCache().
+     *
+     * \return true if the file exists and was written with the specified key
+     * on every MPI process.  Otherwise, false is returned and no data are
+     * modified.
+     *
+     * \note This is a collective operation.
+     */
+    bool readStructureCache(const std::string& filename, const std::string& key);
+
     /*!
      * \brief Determine the indices of any vertices initially owned by the
      * specified patch.
@@ -746,6 +778,12 @@ protected:
      */
     bool d_data_processed = false;
 
+    /*
+     * Optional structure cache file and the user-provided part of its key.
+     */
+    std::string d_structure_cache_filename;
+    std::string d_structure_cache_key;
+
 private:
     /*
      * Functions used to initialize structures programmatically.
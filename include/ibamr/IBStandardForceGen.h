@@ -67,6 +67,25 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note Springs are grouped by force function, and the forces of all springs,
+ * beams, and target points are evaluated in separate passes from the
+ * accumulation of those forces at the nodes.  The accumulation sums the
+ * contributions to each node in a fixed order, so that the computed forces do
+ * not depend on the number of OpenMP threads.
+ *
+ * \note The stiffnesses and rest lengths of springs that use
+ * default_linear_spring_force() are copied from the IBSpringForceSpec objects
+ * when the level data are initialized, i.e., at the start of the simulation
+ * and after each regrid.  Changes made to the spring parameters of those
+ * objects at other times take effect at the next regrid.
+ *
+ * \note If IBAMR is built with OpenMP, these passes are only distributed among
+ * OpenMP threads if the input database entry
+ * <TT>use_threaded_force_computation</TT> is TRUE (the default is FALSE).  In
+ * that case, registered spring force functions are called concurrently for
+ * different springs and must be thread safe: they may not modify any shared
+ * state without synchronization.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -87,6 +106,9 @@ public:
      *
      * \note By default, function default_linear_spring_force() is associated
      * with \a force_fcn_idx 0.
+     *
+     * \note The functions must be thread safe if threaded force computation
+     * is enabled.  See the class documentation.
      */
     void registerSpringForceFunction(int force_fcn_index,
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
@@ -106,6 +128,10 @@ public:
      * \brief Compute the force generated by the Lagrangian structure on the
      * specified level of the patch hierarchy.
      *
+     * The target point forces, which only involve locally owned nodes, are
+     * computed while the ghost values of the positions required by the spring
+     * and beam forces are communicated.
+     *
      * \note Nodal forces computed by this method are \em added to the force
      * vector.
      */
@@ -183,6 +209,24 @@ private:
      * \name Data maintained separately for each level of the patch hierarchy.
      */
     //\{
+    /*
+     * The force contributions accumulated at each node: contributions
+     * offsets[n] through offsets[n+1]-1 are added to the node with (local form)
+     * vector index node_idxs[n], and each contribution is weights[l] times the
+     * force stored at index force_idxs[l] of the force workspace.
+     */
+    struct ForceGatherData
+    {
+        std::vector<int> node_idxs, offsets, force_idxs;
+        std::vector<double> weights;
+    };
+
+    /*
+     * Springs are sorted by force function index, and batch_force_fcns[b] is
+     * used for springs batch_offsets[b] through batch_offsets[b+1]-1.  The
+     * stiffness and rest length of each spring are also stored in contiguous
+     * arrays that are used by the default linear spring force.
+     */
     struct SpringData
     {
         std::vector<int> lag_mastr_node_idxs, lag_slave_node_idxs;
@@ -191,6 +235,11 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+        std::vector<double> stiffnesses, rest_lengths;
+        std::vector<int> batch_offsets;
+        std::vector<SpringForceFcnPtr> batch_force_fcns;
+        std::vector<double> forces;
+        ForceGatherData gather;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -200,6 +249,8 @@ private:
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+        std::vector<double> forces;
+        ForceGatherData gather;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -274,6 +325,11 @@ private:
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements = false;
+
+    /*!
+     * \brief Whether the force passes are distributed among OpenMP threads.
+     */
+    bool d_use_threaded_force_computation = false;
 };
 } // namespace IBAMR
 
@@ -282,6 +282,62 @@ namespace IBAMR
  *
  * <HR>
  *
+ * <B>Binary structure file format</B>
+ *
+ * When the input database sets <TT>use_binary_structure_files = TRUE</TT>, the
+ * vertex, spring, crosslink spring, beam, rod, target point, and anchor point
+ * data of each structure are read from a single binary file with the extension
+ * <TT>".ibstruct"</TT> instead of from the ASCII files described above.  Such
+ * files may be generated from the ASCII files with the script
+ * <TT>scripts/IB/convert_structure_to_binary.py</TT>.  Binary files are read
+ * without file batons, and each section is read in bounded chunks.  Every
+ * process reads all of the sections of each file.  The header and section
+ * table are validated before any records are read (see
+ * checkBinaryStructureFile()).
+ *
+ * All values are stored in native (little-endian) byte order.  The file begins
+ * with a header and a section table:
+ \verbatim
+ char    magic[8]       # "IBSTRUCT"
+ int32   version        # 1
+ int32   ndim           # must equal NDIM
+ int32   num_sections
+ int32   reserved
+ # num_sections entries of:
+ int32   type           # 1 vertex, 2 spring, 3 xspring, 4 beam, 5 rod, 6 target, 7 anchor
+ int32   num_params     # maximum number of spring parameters (springs only)
+ int64   num_records
+ int64   offset         # byte offset of the first record
+ int64   record_size    # size of each record in bytes
+ \endverbatim
+ * Each section is an array of fixed-size records that use the same units and
+ * (local or global) vertex indexing as the corresponding ASCII file:
+ \verbatim
+ vertex:  double X[NDIM]
+ spring:  int32 i, j, fcn_idx, n; double params[num_params]  # n used entries: kappa, length, ...
+ xspring: int32 i, j, fcn_idx, n; double params[num_params]
+ beam:    int32 prev, curr, next, has_curvature; double bend, curvature[NDIM]
+ rod:     int32 curr, next; double ds, a1, a2, a3, b1, b2, b3, kappa1, kappa2, tau
+ target:  int32 i, unused; double kappa, eta
+ anchor:  int32 i, unused
+ \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Structure cache</B>
+ *
+ * If the input database provides <TT>structure_cache_filename</TT>, the
+ * processed vertex, spring, crosslink spring, beam, rod, target point, anchor
+ * point, boundary mass, and director data are stored in that file after the
+ * input files are read, and subsequent runs load them from the cache instead of
+ * reparsing the input files.  The cache is only used if the contents of all of
+ * those input files (as determined by a hash), the shift and scale factors, the
+ * uniform values and enable flags of all structures, and the optional input
+ * string <TT>structure_cache_key</TT> are unchanged.  Instrumentation and source
+ * files are always read.
+ *
+ * <HR>
+ *
  * <B>Mass point file format</B>
  *
  * Mass point input files end with the extension <TT>".mass"</TT> and have the
@@ -437,6 +493,21 @@ public:
      */
     void init() override;
 
+    /*!
+     * \brief Check the header and the section table of a binary structure
+     * file.
+     *
+     * A file passes this check if it has the expected magic number, version,
+     * and dimension, if the records of every section are at least as large as
+     * the data that are read from them (for springs and crosslink springs, this
+     * includes the <TT>num_params</TT> parameters), and if every section lies
+     * entirely within the file.
+     *
+     * \return An empty string if the file passes the check, and a description
+     * of the first problem that was found otherwise.
+     */
+    static std::string checkBinaryStructureFile(const std::string& filename);
+
 protected:
 private:
     /*!
@@ -466,6 +537,13 @@ private:
      */
     IBStandardInitializer& operator=(const IBStandardInitializer& that) = delete;
 
+    /*!
+     * \brief Generate the key of the structure cache from hashes of the
+     * contents of the input files and the input settings that are applied
+     * while reading them.
+     */
+    std::string getStructureCacheKey() const;
+
     /*!
      * \brief Read the vertex data from one or more input files.
      */
@@ -502,6 +580,71 @@ private:
      */
     void readAnchorPointFiles(const std::string& file_extension);
 
+    /*!
+     * \brief Read the vertex, spring, crosslink spring, beam, rod, target
+     * point, and anchor point data from one or more binary structure files.
+     */
+    void readBinaryStructureFiles(const std::string& file_extension);
+
+    /*!
+     * \brief Add a spring, after applying uniform values and converting to
+     * global indices, unless it duplicates an existing spring.
+     */
+    void addSpring(int ln,
+                   unsigned int j,
+                   Edge e,
+                   std::vector<double> parameters,
+                   int force_fcn_idx,
+                   bool input_uses_global_idxs,
+                   const std::string& spring_filename,
+                   bool& warned);
+
+    /*!
+     * \brief Add a crosslink spring, after applying uniform values and
+     * converting to global indices, unless it duplicates an existing one.
+     */
+    void addXSpring(int ln,
+                    unsigned int j,
+                    Edge e,
+                    std::vector<double> parameters,
+                    int force_fcn_idx,
+                    bool input_uses_global_idxs,
+                    const std::string& xspring_filename,
+                    bool& warned);
+
+    /*!
+     * \brief Add a beam, after applying uniform values and converting to
+     * global indices, unless it duplicates an existing beam.
+     */
+    void addBeam(int ln,
+                 unsigned int j,
+                 int prev_idx,
+                 int curr_idx,
+                 int next_idx,
+                 double bend,
+                 IBTK::Vector curv,
+                 bool input_uses_global_idxs,
+                 const std::string& beam_filename,
+                 bool& warned);
+
+    /*!
+     * \brief Add a rod, after applying uniform values and converting to
+     * global indices, unless it duplicates an existing rod.
+     */
+    void addRod(int ln,
+                unsigned int j,
+                int curr_idx,
+                int next_idx,
+                std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> properties,
+                bool input_uses_global_idxs,
+                const std::string& rod_filename);
+
+    /*!
+     * \brief Apply the enable flag and uniform values to the target point data
+     * of a structure.
+     */
+    void applyUniformTargetPointData(int ln, unsigned int j);
+
     /*!
      * \brief Read the boundary mass data from one or more input files.
      */
@@ -543,6 +686,12 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * The boolean value determines whether structure data are read from binary
+     * structure files instead of from the ASCII input files.
+     */
+    bool d_use_binary_structure_files = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
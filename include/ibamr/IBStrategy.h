@@ -22,6 +22,7 @@
 
 #include "ibtk/CartGridFunction.h"
 
+#include "BoxList.h"
 #include "CoarsenPatchStrategy.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
@@ -264,6 +265,21 @@ public:
         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
         double data_time) = 0;
 
+    /*!
+     * Compute boxes, in the index space of the specified level of the patch
+     * hierarchy, that contain the cells of the local patches of that level at
+     * which the Eulerian velocity is interpolated.  Ghost cell data that lie
+     * more than getMinimumGhostCellWidth() cells away from these boxes are not
+     * needed by interpolateVelocity() until the Lagrangian data are next
+     * redistributed.  The boxes are recomputed following each call to
+     * endDataRedistribution().
+     *
+     * Returns false if ghost cell data are needed on all patches of the level.
+     *
+     * A default implementation is provided that returns false.
+     */
+    virtual bool computeInterpolationRegionBoxes(SAMRAI::hier::BoxList<NDIM>& region_boxes, int level_number);
+
     /*!
      * Advance the positions of the Lagrangian structure using the forward Euler
      * method.
@@ -307,6 +323,28 @@ public:
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
                 double data_time) = 0;
 
+    /*!
+     * Interpolate the Eulerian velocity to the curvilinear mesh and spread the
+     * Lagrangian force to the Cartesian grid at the specified time within the
+     * current time interval. The Lagrangian force must already have been
+     * computed and \p u_data_idx and \p f_data_idx must be different.
+     *
+     * Implementations may use this function to compute the positions of the
+     * Lagrangian interaction points once and visit each patch only once
+     * instead of once per operation.
+     *
+     * A default implementation is provided that calls interpolateVelocity()
+     * and then spreadForce().
+     */
+    virtual void interpolateVelocityAndSpreadForce(
+        int u_data_idx,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& u_synch_scheds,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+        int f_data_idx,
+        IBTK::RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
+        double data_time);
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      *
@@ -150,6 +150,13 @@ public:
         const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
         double data_time) override;
 
+    /*!
+     * Compute the union of the interpolation region boxes of the strategy
+     * objects.  Returns false if any of the strategy objects requires ghost
+     * cell data on all patches of the level.
+     */
+    bool computeInterpolationRegionBoxes(SAMRAI::hier::BoxList<NDIM>& region_boxes, int level_number) override;
+
     /*!
      * Advance the positions of the Lagrangian structure using the forward Euler
      * method.
@@ -58,6 +58,17 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * With <tt>pc_type = "shell"</tt> the system is preconditioned by a few
+ * conjugate gradient iterations on the Rotne-Pragner-Yamakawa approximation
+ * of \f$ M \f$, which is applied matrix-free with
+ * MobilityFunctions::applyRPYMobilityOperator(). The accuracy of the
+ * preconditioner is set by the input keys \p rpy_opening_angle, \p
+ * rpy_pc_max_iterations, \p rpy_pc_rel_residual_tol and \p
+ * f_periodic_correction. Since the preconditioner is not a fixed linear
+ * operator, a flexible Krylov method (e.g. fgmres) should be used with it.
+ * Every process holds a copy of the marker positions and forces when the
+ * preconditioner is applied and evaluates the velocities of a share of the
+ * markers.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -273,6 +284,12 @@ private:
      */
     static PetscErrorCode PCApply_KMInv(PC pc, Vec x, Vec y);
 
+    /*!
+     * \brief Compute the matrix vector product \f$y=Ax\f$ for the RPY
+     * approximation of the mobility matrix used by the preconditioner.
+     */
+    static PetscErrorCode MatVecMult_RPY(Mat A, Vec x, Vec y);
+
     /*!
      * \brief Set KSP monitoring routine for the KSP.
      */
@@ -290,6 +307,13 @@ private:
     KSP d_petsc_ksp = nullptr;
     Mat d_petsc_mat = nullptr;
 
+    // Matrix-free RPY preconditioner.
+    KSP d_rpy_pc_ksp = nullptr;
+    Mat d_rpy_pc_mat = nullptr;
+    double d_rpy_opening_angle = 0.5, d_rpy_pc_rel_residual_tol = 1.0e-2, d_f_periodic_corr = 0.0;
+    int d_rpy_pc_max_iterations = 10;
+    double d_struct_dx[NDIM];
+
     // Linear operator.
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, PetscScalar> > > d_samrai_temp;
     SAMRAI::tbox::Pointer<IBAMR::INSStaggeredHierarchyIntegrator> d_ins_integrator;
@@ -99,6 +99,62 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Apply the Rotne-Pragner-Yamakawa mobility matrix to a force
+     * vector without forming the matrix.
+     *
+     * The product is evaluated by a tree code: markers are sorted into a
+     * hierarchy of cells, and the contribution of a cell that is well
+     * separated from a target marker is approximated by the total force of the
+     * cell placed at its centroid.  Nearby cells are summed directly.  This
+     * requires O(N) memory and O(N log N) work, compared to the O(N^2) storage
+     * of constructRPYMobilityMatrix().
+     *
+     * The tree is always built from all \p num_nodes markers, but only the
+     * velocities of the target markers in [\p target_begin, \p target_end) are
+     * computed.  This allows the evaluation to be divided among processes that
+     * each hold a copy of the positions and forces.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param mu Fluid viscosity.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param opening_angle A cell of radius \f$ R \f$ is treated as far away
+     * from a marker at distance \f$ r \f$ when \f$ R < \theta r \f$.  Smaller
+     * values are more accurate; zero reproduces the dense matrix exactly.
+     *
+     * \param F Force vector with \p num_nodes*NDIM entries.
+     *
+     * \param U Resulting velocity vector with \p num_nodes*NDIM entries.  Only
+     * the entries of the target markers are set.
+     *
+     * \param target_begin Index of the first target marker.
+     *
+     * \param target_end One past the index of the last target marker.  A
+     * negative value means \p num_nodes.
+     */
+    static void applyRPYMobilityOperator(const char* kernel_name,
+                                         const double mu,
+                                         const double dx,
+                                         const double* X,
+                                         const int num_nodes,
+                                         const double periodic_correction,
+                                         const double opening_angle,
+                                         const double* F,
+                                         double* U,
+                                         const int target_begin = 0,
+                                         const int target_end = -1);
 }; // MobilityFunctions
 
 } // namespace IBAMR
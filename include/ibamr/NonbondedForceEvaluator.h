@@ -66,20 +66,41 @@ public:
     // q_j will experience force -out_force.
     //
     // parameters are passed in the double* params.
+    //
+    // If the input database entry use_threaded_force_evaluation is TRUE (the
+    // default is FALSE) and IBAMR is compiled with OpenMP, the function is
+    // called concurrently for different pairs of nodes.  It must then be
+    // thread-safe: it may only write to out_force and must not modify any
+    // shared state without synchronization.
     using NonBddForceFcnPtr = void (*)(double* D, const SAMRAI::tbox::Array<double> params, double* out_force);
 
     // Class constructor.
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
 
-    // Function to evaluate forces.
+    // Function to evaluate the force between a single pair of nodes.
     void evaluateForces(int mstr_petsc_idx,
                         int search_petsc_idx,
                         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                         std::vector<int> cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Implementation of initializeLevelData.  Invalidates the neighbor list of
+    // the level, which is rebuilt the next time forces are computed.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // Implementation of computeLagrangianForce.
+    //
+    // Pairs of nodes are found with a Verlet neighbor list.  The list contains
+    // all pairs that are within interaction_radius + 2*regrid_alpha of each
+    // other (measured in units of the mesh width) and is reused until a node
+    // moves more than regrid_alpha from its position when the list was built,
+    // or until the Lagrangian data are redistributed.  Forces between pairs of
+    // local nodes are evaluated once and applied to both nodes.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> U_data,
@@ -88,7 +109,8 @@ public:
                                 const double data_time,
                                 IBTK::LDataManager* const l_data_manager) override;
 
-    // Register the force function used
+    // Register the force function used.  See NonBddForceFcnPtr for the
+    // thread-safety requirements when threaded force evaluation is enabled.
     void registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr);
 
 private:
@@ -110,12 +132,58 @@ private:
     // parameters for force function:
     SAMRAI::tbox::Array<double> d_parameters;
 
+    // whether the force function is evaluated for multiple pairs concurrently:
+    bool d_use_threaded_force_evaluation = false;
+
     // grid geometry
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
 
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
-    NonBddForceFcnPtr d_force_fcn_ptr;
+    NonBddForceFcnPtr d_force_fcn_ptr = nullptr;
+
+    // Neighbor list data maintained separately for each level of the patch
+    // hierarchy.  Node indices are local PETSc indices.  Pairs of local nodes
+    // are stored once; pairs of a local node and a ghost node are stored with
+    // the local node as the master node, and the force is only applied to the
+    // local node (the process that owns the ghost node applies the force to
+    // it).  Each pair has the periodic shift that is applied to the position
+    // of the search node.
+    struct NeighborList
+    {
+        bool is_valid = false;
+        std::vector<int> local_mstr_idxs, local_search_idxs;
+        std::vector<int> ghost_mstr_idxs, ghost_search_idxs;
+        std::vector<double> local_shifts, ghost_shifts;
+
+        // Node positions at the time the list was built, and the mesh width
+        // used to measure displacements.
+        std::vector<double> X_build;
+        double dx[NDIM] = {};
+    };
+    std::vector<NeighborList> d_neighbor_lists;
+
+    // Determine whether the neighbor list is still valid for the given node
+    // positions.
+    bool neighborListIsValid(const NeighborList& nbr_list, const double* X_node, int num_nodes) const;
+
+    // Rebuild the neighbor list of the given level.
+    void buildNeighborList(NeighborList& nbr_list,
+                           const double* X_node,
+                           int num_local_nodes,
+                           int num_nodes,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           IBTK::LDataManager* l_data_manager);
+
+    // Evaluate the forces from a list of pairs.  If apply_to_search_node is
+    // true, the opposite force is also applied to the search nodes.
+    void evaluateForces(const std::vector<int>& mstr_idxs,
+                        const std::vector<int>& search_idxs,
+                        const std::vector<double>& shifts,
+                        bool apply_to_search_node,
+                        const double* X_node,
+                        double* F_node) const;
 };
 } // namespace IBAMR
 
@@ -27,6 +27,7 @@
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/FACPreconditionerStrategy.h"
+#include "ibtk/SinglePrecisionGhostFill.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CoarsenAlgorithm.h"
@@ -94,6 +95,7 @@ namespace IBAMR
  coarse_solver_rel_residual_tol = 1.0e-5        // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50       // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10              // see setCoarseSolverMaxIterations()
+ use_single_precision_ghost_fill = FALSE        // see setUseSinglePrecisionGhostFill()
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
@@ -229,6 +231,24 @@ public:
      */
     void setRestrictionMethods(const std::string& U_restriction_method, const std::string& P_restriction_method);
 
+    /*!
+     * \brief Set whether the same-level ghost cell values of the velocity and
+     * pressure used by the smoothers are communicated in single precision.
+     *
+     * When enabled, the same-level ghost cell fills performed by the smoothers
+     * exchange single-precision copies of the parts of the patch interiors
+     * that neighboring patches read, which halves the size of the messages
+     * exchanged in each smoothing sweep.  Only the ghost cell values filled
+     * from neighboring patches on the same level are rounded.  The level data
+     * and the smoothers remain in double precision.  See class
+     * IBTK::SinglePrecisionGhostFill.
+     *
+     * \note The rounding makes the preconditioner a nonlinear function of the
+     * residual, so it must be used with a flexible Krylov method (e.g.,
+     * ksp_type = "fgmres" for IBTK::PETScKrylovLinearSolver).
+     */
+    void setUseSinglePrecisionGhostFill(bool use_single_precision_ghost_fill);
+
     //\}
 
     /*!
@@ -462,6 +482,11 @@ protected:
      */
     bool d_has_velocity_nullspace = false, d_has_pressure_nullspace = false;
 
+    /*
+     * Whether same-level ghost cell fills are performed in single precision.
+     */
+    bool d_use_single_precision_ghost_fill = false;
+
     //\}
 
     /*!
@@ -561,6 +586,12 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_ghostfill_nocoarse_refine_algorithm;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_ghostfill_nocoarse_refine_schedules;
 
+    /*
+     * Single-precision same-level ghost cell fill operator for side and cell
+     * data.
+     */
+    SAMRAI::tbox::Pointer<IBTK::SinglePrecisionGhostFill> d_single_precision_ghost_fill_op;
+
     /*
      * Operator for side data synchronization on same level.
      */
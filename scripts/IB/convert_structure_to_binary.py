@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2020 - 2020 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+#
+# filename: convert_structure_to_binary.py
+# usage: convert_structure_to_binary.py <ndim> <base filename> [<output filename>]
+#
+# Convert the ASCII vertex, spring, crosslink spring, beam, rod, target point,
+# and anchor point files of a structure (<base filename>.vertex, etc.) into a
+# single binary structure file (<base filename>.ibstruct by default) that can
+# be read by IBStandardInitializer when use_binary_structure_files = TRUE.
+# Only the vertex file is required.  See the documentation of
+# IBStandardInitializer for a description of the file format.
+
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"IBSTRUCT"
+VERSION = 1
+
+VERTEX, SPRING, XSPRING, BEAM, ROD, TARGET, ANCHOR = range(1, 8)
+NUM_ROD_PARAMS = 10
+
+HEADER_SIZE = 24
+SECTION_SIZE = 32
+
+
+def read_records(filename):
+    """Return the whitespace-separated entries of each record of an ASCII
+    structure file, after discarding comments and the leading record count."""
+    lines = []
+    with open(filename) as f:
+        for line in f:
+            line = re.split("[!#%]", line, 1)[0].split()
+            if line:
+                lines.append(line)
+    if not lines:
+        sys.exit("error: empty input file " + filename)
+    num_records = int(lines[0][0])
+    if len(lines) - 1 < num_records:
+        sys.exit("error: expected {} records in {} but found {}".format(num_records, filename, len(lines) - 1))
+    return lines[1:num_records + 1]
+
+
+def pack_springs(records):
+    springs = []
+    for r in records:
+        params = [float(r[2]), float(r[3])] + [float(p) for p in r[5:]]
+        fcn_idx = int(r[4]) if len(r) > 4 else 0
+        springs.append((int(r[0]), int(r[1]), fcn_idx, params))
+    num_params = max(len(s[3]) for s in springs)
+    record_size = 16 + 8 * num_params
+    data = bytearray()
+    for i, j, fcn_idx, params in springs:
+        padded = params + [0.0] * (num_params - len(params))
+        data += struct.pack("<4i{}d".format(num_params), i, j, fcn_idx, len(params), *padded)
+    return num_params, record_size, bytes(data)
+
+
+def pack_beams(records, ndim):
+    data = bytearray()
+    for r in records:
+        has_curv = len(r) >= 4 + ndim
+        curv = [float(c) for c in r[4:4 + ndim]] if has_curv else [0.0] * ndim
+        data += struct.pack("<4i{}d".format(ndim + 1), int(r[0]), int(r[1]), int(r[2]), int(has_curv),
+                            float(r[3]), *curv)
+    return 16 + 8 * (ndim + 1), bytes(data)
+
+
+def pack_rods(records):
+    data = bytearray()
+    for r in records:
+        props = [float(p) for p in r[2:2 + NUM_ROD_PARAMS]]
+        props += [0.0] * (NUM_ROD_PARAMS - len(props))
+        data += struct.pack("<2i{}d".format(NUM_ROD_PARAMS), int(r[0]), int(r[1]), *props)
+    return 8 + 8 * NUM_ROD_PARAMS, bytes(data)
+
+
+def pack_targets(records):
+    data = bytearray()
+    for r in records:
+        damping = float(r[2]) if len(r) > 2 else 0.0
+        data += struct.pack("<2i2d", int(r[0]), 0, float(r[1]), damping)
+    return 24, bytes(data)
+
+
+def pack_anchors(records):
+    data = bytearray()
+    for r in records:
+        data += struct.pack("<2i", int(r[0]), 0)
+    return 8, bytes(data)
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.exit("usage:\n  convert_structure_to_binary.py <ndim> <base filename> [<output filename>]")
+    ndim = int(sys.argv[1])
+    if ndim not in (2, 3):
+        sys.exit("error: ndim must be 2 or 3")
+    base = sys.argv[2]
+    output = sys.argv[3] if len(sys.argv) == 4 else base + ".ibstruct"
+
+    # Each section is (type, num_params, num_records, record_size, data).
+    sections = []
+    vertices = read_records(base + ".vertex")
+    data = bytearray()
+    for r in vertices:
+        data += struct.pack("<{}d".format(ndim), *[float(x) for x in r[:ndim]])
+    sections.append((VERTEX, 0, len(vertices), 8 * ndim, bytes(data)))
+
+    for ext, section_type in ((".spring", SPRING), (".xspring", XSPRING)):
+        if os.path.isfile(base + ext):
+            records = read_records(base + ext)
+            if records:
+                num_params, record_size, data = pack_springs(records)
+                sections.append((section_type, num_params, len(records), record_size, data))
+    for ext, section_type, pack in ((".beam", BEAM, lambda r: pack_beams(r, ndim)),
+                                    (".rod", ROD, pack_rods),
+                                    (".target", TARGET, pack_targets),
+                                    (".anchor", ANCHOR, pack_anchors)):
+        if os.path.isfile(base + ext):
+            records = read_records(base + ext)
+            if records:
+                record_size, data = pack(records)
+                sections.append((section_type, 0, len(records), record_size, data))
+
+    with open(output, "wb") as f:
+        f.write(struct.pack("<8s4i", MAGIC, VERSION, ndim, len(sections), 0))
+        offset = HEADER_SIZE + SECTION_SIZE * len(sections)
+        for section_type, num_params, num_records, record_size, data in sections:
+            f.write(struct.pack("<2i3q", section_type, num_params, num_records, offset, record_size))
+            offset += len(data)
+        for section in sections:
+            f.write(section[4])
+
+    for section_type, num_params, num_records, record_size, data in sections:
+        print("section {}: {} records of {} bytes".format(section_type, num_records, record_size))
+    print("wrote binary structure file " + output)
+
+
+if __name__ == "__main__":
+    main()
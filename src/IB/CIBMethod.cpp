@@ -114,6 +114,7 @@ CIBMethod::CIBMethod(std::string object_name,
 
 CIBMethod::~CIBMethod()
 {
+    clearArrayScatters();
     return;
 } // ~CIBMethod
 
@@ -626,6 +627,17 @@ CIBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // initializePatchHierarchy
 
+void
+CIBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                 Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
+{
+    IBMethod::endDataRedistribution(hierarchy, gridding_alg);
+
+    // The PETSc ordering of the Lagrangian nodes may have changed.
+    clearArrayScatters();
+    return;
+} // endDataRedistribution
+
 void
 CIBMethod::interpolateVelocity(const int u_data_idx,
                                const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds,
@@ -1265,67 +1277,13 @@ CIBMethod::copyVecToArray(Vec b,
                           const int array_rank)
 {
     if (struct_ids.empty()) return;
-    const auto num_structs = static_cast<unsigned>(struct_ids.size());
-
-    // Get the Lagrangian indices of the structures.
-    std::vector<int> map;
-    PetscInt total_nodes = 0;
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        total_nodes += getNumberOfNodes(struct_ids[k]);
-    }
-    map.reserve(total_nodes);
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
-        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
-        for (unsigned j = 0; j < struct_nodes; ++j)
-        {
-            map.push_back(lag_idx_range.first + j);
-        }
-    }
-
-    // Map the Lagrangian indices into PETSc indices
-    const int struct_ln = getStructuresLevelNumber();
-    d_l_data_manager->mapLagrangianToPETSc(map, struct_ln);
-
-    // Wrap the raw data in a PETSc Vec
-    PetscInt size = total_nodes * data_depth;
-    int rank = IBTK_MPI::getRank();
-    PetscInt array_local_size = 0;
-    if (rank == array_rank) array_local_size = size;
-    Vec array_vec;
-    VecCreateMPIWithArray(PETSC_COMM_WORLD, /*blocksize*/ 1, array_local_size, PETSC_DECIDE, array, &array_vec);
-
-    // Create index sets to define global index mapping.
-    std::vector<PetscInt> vec_indices, array_indices;
-    vec_indices.reserve(size);
-    array_indices.reserve(size);
-    for (PetscInt j = 0; j < total_nodes; ++j)
-    {
-        PetscInt petsc_idx = map[j];
-        for (int d = 0; d < data_depth; ++d)
-        {
-            array_indices.push_back(j * data_depth + d);
-            vec_indices.push_back(petsc_idx * data_depth + d);
-        }
-    }
-    IS is_vec;
-    IS is_array;
-    ISCreateGeneral(PETSC_COMM_SELF, size, &vec_indices[0], PETSC_COPY_VALUES, &is_vec);
-    ISCreateGeneral(PETSC_COMM_SELF, size, &array_indices[0], PETSC_COPY_VALUES, &is_array);
+    const ArrayScatter& array_scatter = getArrayScatter(b, struct_ids, data_depth, array_rank);
 
     // Scatter values
-    VecScatter ctx;
-    VecScatterCreate(b, is_vec, array_vec, is_array, &ctx);
-    VecScatterBegin(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
-    VecScatterEnd(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
-
-    // Cleanup temporary objects.
-    VecScatterDestroy(&ctx);
-    ISDestroy(&is_vec);
-    ISDestroy(&is_array);
-    VecDestroy(&array_vec);
+    VecPlaceArray(array_scatter.array_vec, array);
+    VecScatterBegin(array_scatter.scatter, b, array_scatter.array_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(array_scatter.scatter, b, array_scatter.array_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecResetArray(array_scatter.array_vec);
 
     return;
 } // copyVecToArray
@@ -1338,67 +1296,13 @@ CIBMethod::copyArrayToVec(Vec b,
                           const int array_rank)
 {
     if (struct_ids.empty()) return;
-    const auto num_structs = static_cast<unsigned>(struct_ids.size());
-
-    // Get the Lagrangian indices of the structures.
-    std::vector<int> map;
-    PetscInt total_nodes = 0;
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        total_nodes += getNumberOfNodes(struct_ids[k]);
-    }
-    map.reserve(total_nodes);
-    for (unsigned k = 0; k < num_structs; ++k)
-    {
-        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
-        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
-        for (unsigned j = 0; j < struct_nodes; ++j)
-        {
-            map.push_back(lag_idx_range.first + j);
-        }
-    }
-
-    // Map the Lagrangian indices into PETSc indices
-    const int struct_ln = getStructuresLevelNumber();
-    d_l_data_manager->mapLagrangianToPETSc(map, struct_ln);
-
-    // Wrap the array in a PETSc Vec
-    PetscInt size = total_nodes * data_depth;
-    int rank = IBTK_MPI::getRank();
-    PetscInt array_local_size = 0;
-    if (rank == array_rank) array_local_size = size;
-    Vec array_vec;
-    VecCreateMPIWithArray(PETSC_COMM_WORLD, /*blocksize*/ 1, array_local_size, PETSC_DECIDE, array, &array_vec);
-
-    // Create index sets to define global index mapping.
-    std::vector<PetscInt> vec_indices, array_indices;
-    vec_indices.reserve(size);
-    array_indices.reserve(size);
-    for (PetscInt j = 0; j < total_nodes; ++j)
-    {
-        PetscInt petsc_idx = map[j];
-        for (int d = 0; d < data_depth; ++d)
-        {
-            array_indices.push_back(j * data_depth + d);
-            vec_indices.push_back(petsc_idx * data_depth + d);
-        }
-    }
-    IS is_vec;
-    IS is_array;
-    ISCreateGeneral(PETSC_COMM_SELF, size, &vec_indices[0], PETSC_COPY_VALUES, &is_vec);
-    ISCreateGeneral(PETSC_COMM_SELF, size, &array_indices[0], PETSC_COPY_VALUES, &is_array);
+    const ArrayScatter& array_scatter = getArrayScatter(b, struct_ids, data_depth, array_rank);
 
     // Scatter values
-    VecScatter ctx;
-    VecScatterCreate(array_vec, is_array, b, is_vec, &ctx);
-    VecScatterBegin(ctx, array_vec, b, INSERT_VALUES, SCATTER_FORWARD);
-    VecScatterEnd(ctx, array_vec, b, INSERT_VALUES, SCATTER_FORWARD);
-
-    // Destroy temporary objects
-    VecScatterDestroy(&ctx);
-    ISDestroy(&is_vec);
-    ISDestroy(&is_array);
-    VecDestroy(&array_vec);
+    VecPlaceArray(array_scatter.array_vec, array);
+    VecScatterBegin(array_scatter.scatter, array_scatter.array_vec, b, INSERT_VALUES, SCATTER_REVERSE);
+    VecScatterEnd(array_scatter.scatter, array_scatter.array_vec, b, INSERT_VALUES, SCATTER_REVERSE);
+    VecResetArray(array_scatter.array_vec);
 
     return;
 } // copyArrayToVec
@@ -1513,6 +1417,82 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::applyMobilityOperator(Vec L,
+                                 Vec V,
+                                 MobilityMatrixType mat_type,
+                                 const std::vector<unsigned>& struct_ids,
+                                 const double* grid_dx,
+                                 double mu,
+                                 const std::pair<double, double>& scale,
+                                 double f_periodic_corr,
+                                 double opening_angle,
+                                 const int managing_rank)
+{
+    if (mat_type != RPY)
+    {
+        TBOX_ERROR("CIBMethod::applyMobilityOperator(): Only the RPY mobility operator can be "
+                   "applied matrix-free."
+                   << std::endl);
+    }
+
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+    const int rank = IBTK_MPI::getRank();
+
+    unsigned num_nodes = 0;
+    for (const auto& struct_id : struct_ids)
+    {
+        num_nodes += getNumberOfNodes(struct_id);
+    }
+    if (num_nodes == 0) return;
+    int size = num_nodes * NDIM;
+
+    // Gather the positions and forces on the managing rank and broadcast them,
+    // so that every process can build the tree.  Only O(N) storage is needed
+    // per process.
+    std::vector<double> X_array(size), L_array(size), V_array(size, 0.0), W_array;
+    if (rank == managing_rank) W_array.resize(size);
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    copyVecToArray((*X_half_data)[struct_ln]->getVec(), X_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+    copyVecToArray(L, L_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+    Vec W = d_l_data_manager->getLData("regulator", struct_ln)->getVec();
+    copyVecToArray(W, W_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+    IBTK_MPI::bcast(X_array.data(), size, managing_rank);
+    IBTK_MPI::bcast(L_array.data(), size, managing_rank);
+
+    // Each process evaluates the velocities of a contiguous range of target
+    // markers.  The partial results are summed on all processes.
+    const int nodes = IBTK_MPI::getNodes();
+    const int target_begin = static_cast<int>((static_cast<long>(num_nodes) * rank) / nodes);
+    const int target_end = static_cast<int>((static_cast<long>(num_nodes) * (rank + 1)) / nodes);
+    MobilityFunctions::applyRPYMobilityOperator(ib_kernel,
+                                                mu,
+                                                grid_dx[0],
+                                                X_array.data(),
+                                                num_nodes,
+                                                f_periodic_corr,
+                                                opening_angle,
+                                                L_array.data(),
+                                                V_array.data(),
+                                                target_begin,
+                                                target_end);
+    IBTK_MPI::sumReduction(V_array.data(), size);
+
+    if (rank == managing_rank)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            V_array[i] = scale.first * V_array[i] + scale.second * W_array[i] * L_array[i];
+        }
+    }
+    copyArrayToVec(V, V_array.data(), struct_ids, /*depth*/ NDIM, managing_rank);
+
+    return;
+} // applyMobilityOperator
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
@@ -1712,6 +1692,98 @@ CIBMethod::flagRegrid() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+const CIBMethod::ArrayScatter&
+CIBMethod::getArrayScatter(Vec b, const std::vector<unsigned>& struct_ids, const int data_depth, const int array_rank)
+{
+    PetscInt vec_local_size, vec_global_size;
+    VecGetLocalSize(b, &vec_local_size);
+    VecGetSize(b, &vec_global_size);
+
+    // Reuse the cached scatter if it was created for a vector with the same
+    // layout.
+    ArrayScatter& array_scatter = d_array_scatters[std::make_tuple(struct_ids, data_depth, array_rank)];
+    if (array_scatter.scatter)
+    {
+        if (array_scatter.vec_local_size == vec_local_size && array_scatter.vec_global_size == vec_global_size)
+        {
+            return array_scatter;
+        }
+        VecScatterDestroy(&array_scatter.scatter);
+        VecDestroy(&array_scatter.array_vec);
+    }
+    const auto num_structs = static_cast<unsigned>(struct_ids.size());
+
+    // Get the Lagrangian indices of the structures.
+    std::vector<int> map;
+    PetscInt total_nodes = 0;
+    for (unsigned k = 0; k < num_structs; ++k)
+    {
+        total_nodes += getNumberOfNodes(struct_ids[k]);
+    }
+    map.reserve(total_nodes);
+    for (unsigned k = 0; k < num_structs; ++k)
+    {
+        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
+        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
+        for (unsigned j = 0; j < struct_nodes; ++j)
+        {
+            map.push_back(lag_idx_range.first + j);
+        }
+    }
+
+    // Map the Lagrangian indices into PETSc indices
+    const int struct_ln = getStructuresLevelNumber();
+    d_l_data_manager->mapLagrangianToPETSc(map, struct_ln);
+
+    // Create a PETSc Vec that wraps the array.  The array itself is placed
+    // into the Vec whenever the scatter is used.
+    PetscInt size = total_nodes * data_depth;
+    int rank = IBTK_MPI::getRank();
+    PetscInt array_local_size = 0;
+    if (rank == array_rank) array_local_size = size;
+    VecCreateMPIWithArray(
+        PETSC_COMM_WORLD, /*blocksize*/ 1, array_local_size, PETSC_DECIDE, nullptr, &array_scatter.array_vec);
+
+    // Create index sets to define global index mapping.
+    std::vector<PetscInt> vec_indices, array_indices;
+    vec_indices.reserve(size);
+    array_indices.reserve(size);
+    for (PetscInt j = 0; j < total_nodes; ++j)
+    {
+        PetscInt petsc_idx = map[j];
+        for (int d = 0; d < data_depth; ++d)
+        {
+            array_indices.push_back(j * data_depth + d);
+            vec_indices.push_back(petsc_idx * data_depth + d);
+        }
+    }
+    IS is_vec;
+    IS is_array;
+    ISCreateGeneral(PETSC_COMM_SELF, size, vec_indices.data(), PETSC_COPY_VALUES, &is_vec);
+    ISCreateGeneral(PETSC_COMM_SELF, size, array_indices.data(), PETSC_COPY_VALUES, &is_array);
+
+    // Create the scatter from the Lagrangian vector to the array.
+    VecScatterCreate(b, is_vec, array_scatter.array_vec, is_array, &array_scatter.scatter);
+    array_scatter.vec_local_size = vec_local_size;
+    array_scatter.vec_global_size = vec_global_size;
+    ISDestroy(&is_vec);
+    ISDestroy(&is_array);
+
+    return array_scatter;
+} // getArrayScatter
+
+void
+CIBMethod::clearArrayScatters()
+{
+    for (auto& key_scatter : d_array_scatters)
+    {
+        VecScatterDestroy(&key_scatter.second.scatter);
+        VecDestroy(&key_scatter.second.array_vec);
+    }
+    d_array_scatters.clear();
+    return;
+} // clearArrayScatters
+
 void
 CIBMethod::getFromInput(Pointer<Database> input_db)
 {
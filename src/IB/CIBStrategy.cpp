@@ -20,6 +20,7 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "tbox/MathUtilities.h"
+#include "tbox/Utilities.h"
 
 #include "petscis.h"
 #include "petscistypes.h"
@@ -30,6 +31,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <ostream>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -825,6 +827,25 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::applyMobilityOperator(Vec /*L*/,
+                                   Vec /*V*/,
+                                   MobilityMatrixType /*mat_type*/,
+                                   const std::vector<unsigned>& /*struct_ids*/,
+                                   const double* /*grid_dx*/,
+                                   double /*mu*/,
+                                   const std::pair<double, double>& /*scale*/,
+                                   double /*f_periodic_corr*/,
+                                   double /*opening_angle*/,
+                                   const int /*managing_rank*/)
+{
+    TBOX_ERROR("CIBStrategy::applyMobilityOperator(): Matrix-free mobility operator is not "
+               "implemented by this strategy."
+               << std::endl);
+
+    return;
+} // applyMobilityOperator
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
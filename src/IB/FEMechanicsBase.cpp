@@ -69,6 +69,8 @@
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -82,6 +84,10 @@ namespace
 // Version of FEMechanicsBase restart file data.
 const int FE_MECHANICS_BASE_VERSION = 1;
 
+// Number of elements whose elemental force vectors are computed before they
+// are added to the global right-hand side vector.
+const std::size_t FORCE_ASSEMBLY_BATCH_SIZE = 1024;
+
 inline boundary_id_type
 get_dirichlet_bdry_ids(const std::vector<boundary_id_type>& bdry_ids)
 {
@@ -152,6 +158,74 @@ get_x_and_FF(libMesh::VectorValue<double>& x,
         FF(i, i) = 1.0;
     }
 }
+
+// Copy the current and reference positions, the deformation gradients, and
+// the data of the specified systems at the first n_qp quadrature points into
+// the structure-of-arrays layout used by IBTK::TensorMeshBatchFcnPtr.
+inline void
+pack_batch_data(std::vector<double>& FF_batch,
+                std::vector<double>& x_batch,
+                std::vector<double>& X_batch,
+                std::vector<std::vector<double> >& var_batch,
+                std::vector<std::vector<double> >& grad_var_batch,
+                std::vector<const double*>& var_batch_ptrs,
+                std::vector<const double*>& grad_var_batch_ptrs,
+                const std::vector<libMesh::Point>& q_point,
+                const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data,
+                const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data,
+                const size_t X_sys_idx,
+                const std::vector<size_t>& system_idxs,
+                const unsigned int n_qp)
+{
+    FF_batch.resize(NDIM * NDIM * n_qp);
+    x_batch.resize(NDIM * n_qp);
+    X_batch.resize(NDIM * n_qp);
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            x_batch[i * n_qp + qp] = x_data[i];
+            X_batch[i * n_qp + qp] = q_point[qp](i);
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                FF_batch[(i * NDIM + j) * n_qp + qp] = grad_x_data[i](j);
+            }
+        }
+    }
+
+    const size_t n_systems = system_idxs.size();
+    var_batch.resize(n_systems);
+    grad_var_batch.resize(n_systems);
+    var_batch_ptrs.resize(n_systems);
+    grad_var_batch_ptrs.resize(n_systems);
+    for (size_t k = 0; k < n_systems; ++k)
+    {
+        const size_t n_vars = n_qp > 0 ? fe_interp_var_data[0][system_idxs[k]].size() : 0;
+        const size_t n_grad_vars = n_qp > 0 ? fe_interp_grad_var_data[0][system_idxs[k]].size() : 0;
+        var_batch[k].resize(n_vars * n_qp);
+        grad_var_batch[k].resize(n_grad_vars * NDIM * n_qp);
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        {
+            const std::vector<double>& var_data = fe_interp_var_data[qp][system_idxs[k]];
+            const std::vector<VectorValue<double> >& grad_var_data = fe_interp_grad_var_data[qp][system_idxs[k]];
+            for (size_t v = 0; v < n_vars; ++v)
+            {
+                var_batch[k][v * n_qp + qp] = var_data[v];
+            }
+            for (size_t v = 0; v < n_grad_vars; ++v)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    grad_var_batch[k][(v * NDIM + d) * n_qp + qp] = grad_var_data[v](d);
+                }
+            }
+        }
+        var_batch_ptrs[k] = var_batch[k].data();
+        grad_var_batch_ptrs[k] = grad_var_batch[k].data();
+    }
+}
 } // namespace
 
 const std::string FEMechanicsBase::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -233,10 +307,86 @@ FEMechanicsBase::getInitialVelocityFunction(unsigned int part) const
     return d_initial_velocity_fcn_data[part];
 }
 
+void
+FEMechanicsBase::PK1StressFcnData::evaluate(
+    TensorValue<double>& PP,
+    const TensorValue<double>& FF,
+    const libMesh::Point& x,
+    const libMesh::Point& X,
+    Elem* const elem,
+    const std::vector<const std::vector<double>*>& system_var_data,
+    const std::vector<const std::vector<VectorValue<double> >*>& system_grad_var_data,
+    const double data_time) const
+{
+    if (fcn)
+    {
+        fcn(PP, FF, x, X, elem, system_var_data, system_grad_var_data, data_time, ctx);
+        return;
+    }
+    TBOX_ASSERT(batch_fcn);
+
+    // With a single quadrature point, the batched layout is the usual
+    // row-major ordering of the components.
+    std::array<double, NDIM * NDIM> PP_batch, FF_batch;
+    std::array<double, NDIM> x_batch, X_batch;
+    PP_batch.fill(0.0);
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        x_batch[i] = x(i);
+        X_batch[i] = X(i);
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            FF_batch[i * NDIM + j] = FF(i, j);
+        }
+    }
+    const size_t n_systems = system_var_data.size();
+    std::vector<const double*> var_batch_ptrs(n_systems);
+    std::vector<std::vector<double> > grad_var_batch(n_systems);
+    std::vector<const double*> grad_var_batch_ptrs(n_systems);
+    for (size_t k = 0; k < n_systems; ++k)
+    {
+        var_batch_ptrs[k] = system_var_data[k]->data();
+        const std::vector<VectorValue<double> >& grad_var_data = *system_grad_var_data[k];
+        grad_var_batch[k].resize(grad_var_data.size() * NDIM);
+        for (size_t v = 0; v < grad_var_data.size(); ++v)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                grad_var_batch[k][v * NDIM + d] = grad_var_data[v](d);
+            }
+        }
+        grad_var_batch_ptrs[k] = grad_var_batch[k].data();
+    }
+    batch_fcn(PP_batch.data(),
+              FF_batch.data(),
+              x_batch.data(),
+              X_batch.data(),
+              1,
+              elem,
+              var_batch_ptrs,
+              grad_var_batch_ptrs,
+              data_time,
+              ctx);
+    PP.zero();
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            PP(i, j) = PP_batch[i * NDIM + j];
+        }
+    }
+    return;
+} // evaluate
+
 void
 FEMechanicsBase::registerPK1StressFunction(const PK1StressFcnData& data, const unsigned int part)
 {
     TBOX_ASSERT(part < d_meshes.size());
+    if (data.fcn && data.batch_fcn)
+    {
+        TBOX_ERROR(d_object_name << "::registerPK1StressFunction():\n"
+                                 << "  only one of fcn and batch_fcn may be provided." << std::endl);
+    }
     d_PK1_stress_fcn_data[part].push_back(data);
     if (data.quad_type == INVALID_Q_RULE)
     {
@@ -410,12 +560,18 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
 
     // First handle the stress contributions.  These are handled separately
     // because each stress function may use a different quadrature rule.
+    //
+    // The local elements are processed in batches.  The elemental right-hand
+    // side vectors of a batch are computed independently of one another (by
+    // several threads if threaded force assembly is enabled) and are then
+    // summed into the global vector in element order, so that the assembled
+    // vector does not depend on the number of threads.
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        if (!d_PK1_stress_fcn_data[part][k].isSet()) continue;
 
-        // Extract the FE systems and DOF maps, and setup the FE object.
+        // Extract the FE systems and DOF maps.
         const DofMap& F_dof_map = F_system.get_dof_map();
         FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(FORCE_SYSTEM_NAME);
         FEType F_fe_type = F_dof_map.variable_type(0);
@@ -427,170 +583,278 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<int> vars(NDIM);
         for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
 
-        FEDataInterpolation fe(dim, d_fe_data[part]);
-        std::unique_ptr<QBase> qrule =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
-        std::unique_ptr<QBase> qrule_face =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
-        fe.attachQuadratureRule(qrule.get());
-        fe.attachQuadratureRuleFace(qrule_face.get());
-        fe.evalNormalsFace();
-        fe.evalQuadraturePoints();
-        fe.evalQuadraturePointsFace();
-        fe.evalQuadratureWeights();
-        fe.evalQuadratureWeightsFace();
-        fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
-        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-        std::vector<size_t> PK1_fcn_system_idxs;
-        fe.setupInterpolatedSystemDataIndexes(
-            PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, &equation_systems);
-        fe.init();
-
-        const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-        const std::vector<double>& JxW = fe.getQuadratureWeights();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
-
-        const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-        const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-        const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-        const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
-
-        const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-        const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-            fe.getGradVarInterpolation();
-
-        std::vector<const std::vector<double>*> PK1_var_data;
-        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
-
-        // Loop over the elements to compute the right-hand side vector.  This
-        // is computed via
-        //
-        //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
-        //    phi_k(s)}dA(s)
-        //
-        // This right-hand side vector is used to solve for the nodal values of
-        // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n, x;
+        // Collect the local elements and their force DOFs.  The DOF caches are
+        // populated on first use and must not be modified concurrently.
+        std::vector<Elem*> local_elems;
+        std::vector<const boost::multi_array<dof_id_type, 2>*> local_F_dof_indices;
         const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
         const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
         for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
         {
             Elem* const elem = *el_it;
-            const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
-            }
-            fe.reinit(elem);
-            fe.collectDataForInterpolation(elem);
-            fe.interpolate(elem);
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dphi.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
-            {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
+            local_elems.push_back(elem);
+            local_F_dof_indices.push_back(&F_dof_map_cache.dof_indices(elem));
+        }
+        const size_t n_local_elems = local_elems.size();
+        const size_t batch_size = std::min(n_local_elems, FORCE_ASSEMBLY_BATCH_SIZE);
+        std::vector<std::array<DenseVector<double>, NDIM> > F_rhs_batch(batch_size);
 
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
-                {
-                    F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        F_rhs_e[i](basis_n) += F_qp(i);
-                    }
-                }
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_force_assembly)
+#endif
+        {
+            // Each thread uses its own FE object.  Setting up the FE object
+            // registers DOF caches with the FE data manager, which is not
+            // thread-safe.
+            FEDataInterpolation fe(dim, d_fe_data[part]);
+            std::unique_ptr<QBase> qrule = QBase::build(
+                d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
+            std::unique_ptr<QBase> qrule_face = QBase::build(
+                d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
+            size_t X_sys_idx = 0;
+            std::vector<size_t> PK1_fcn_system_idxs;
+#ifdef _OPENMP
+#pragma omp critical(FEMechanicsBase_assembleInteriorForceDensityRHS)
+#endif
+            {
+                fe.attachQuadratureRule(qrule.get());
+                fe.attachQuadratureRuleFace(qrule_face.get());
+                fe.evalNormalsFace();
+                fe.evalQuadraturePoints();
+                fe.evalQuadraturePointsFace();
+                fe.evalQuadratureWeights();
+                fe.evalQuadratureWeightsFace();
+                fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
+                X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+                fe.setupInterpolatedSystemDataIndexes(
+                    PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, &equation_systems);
+                fe.init();
             }
 
-            // Loop over the element boundaries.
-            for (unsigned int side = 0; side < elem->n_sides(); ++side)
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            std::vector<const std::vector<double>*> PK1_var_data;
+            std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+
+            // Scratch data for batched stress functions.
+            const PK1StressBatchFcnPtr PK1_batch_fcn = d_PK1_stress_fcn_data[part][k].batch_fcn;
+            std::vector<double> PP_batch, FF_batch, x_batch, X_batch;
+            std::vector<std::vector<double> > PK1_var_batch, PK1_grad_var_batch;
+            std::vector<const double*> PK1_var_batch_ptrs, PK1_grad_var_batch_ptrs;
+
+            // Loop over the elements to compute the right-hand side vector.
+            // This is computed via
+            //
+            //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
+            //    phi_k(s)}dA(s)
+            //
+            // This right-hand side vector is used to solve for the nodal values
+            // of the interior elastic force density.
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_qp, n, x;
+            for (size_t batch_begin = 0; batch_begin < n_local_elems; batch_begin += batch_size)
             {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
-
-                // Determine if we need to integrate surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
-                const bool integrate_normal_stress = (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
-                                                     (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
-                const bool integrate_tangential_stress =
-                    (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
-                    (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
-                if (!integrate_normal_stress && !integrate_tangential_stress) continue;
-
-                fe.reinit(elem, side);
-                fe.interpolate(elem, side);
-                const unsigned int n_qp_face = qrule_face->n_points();
-                const size_t n_basis_face = phi_face.size();
-                for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                const size_t batch_end = std::min(batch_begin + batch_size, n_local_elems);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+                for (size_t e = batch_begin; e < batch_end; ++e)
                 {
-                    const libMesh::Point& X = q_point_face[qp];
-                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                    get_x_and_FF(x, FF, x_data, grad_x_data);
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-
-                    F.zero();
-
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    Elem* const elem = local_elems[e];
+                    const auto& F_dof_indices = *local_F_dof_indices[e];
+                    std::array<DenseVector<double>, NDIM>& F_rhs_elem = F_rhs_batch[e - batch_begin];
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
+                        F_rhs_elem[d].resize(static_cast<int>(F_dof_indices[d].size()));
                     }
-
-                    n = (FF_inv_trans * normal_face[qp]).unit();
-
-                    if (!integrate_normal_stress)
+                    fe.reinit(elem);
+                    // Extracting the elemental data accesses the DOF caches
+                    // and the raw arrays of the (shared) PETSc vectors.
+#ifdef _OPENMP
+#pragma omp critical(FEMechanicsBase_assembleInteriorForceDensityRHS)
+#endif
+                    fe.collectDataForInterpolation(elem);
+                    fe.interpolate(elem);
+                    const unsigned int n_qp = qrule->n_points();
+                    const size_t n_basis = dphi.size();
+
+                    // Batched stress functions are evaluated at all quadrature
+                    // points of the element at once.
+                    if (PK1_batch_fcn)
                     {
-                        F -= (F * n) * n; // remove the normal component.
+                        pack_batch_data(FF_batch,
+                                        x_batch,
+                                        X_batch,
+                                        PK1_var_batch,
+                                        PK1_grad_var_batch,
+                                        PK1_var_batch_ptrs,
+                                        PK1_grad_var_batch_ptrs,
+                                        q_point,
+                                        fe_interp_var_data,
+                                        fe_interp_grad_var_data,
+                                        X_sys_idx,
+                                        PK1_fcn_system_idxs,
+                                        n_qp);
+                        PP_batch.assign(NDIM * NDIM * n_qp, 0.0);
+                        PK1_batch_fcn(PP_batch.data(),
+                                      FF_batch.data(),
+                                      x_batch.data(),
+                                      X_batch.data(),
+                                      n_qp,
+                                      elem,
+                                      PK1_var_batch_ptrs,
+                                      PK1_grad_var_batch_ptrs,
+                                      data_time,
+                                      d_PK1_stress_fcn_data[part][k].ctx);
                     }
 
-                    if (!integrate_tangential_stress)
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
                     {
-                        F -= (F - (F * n) * n); // remove the tangential component.
+                        // Compute the value of the first Piola-Kirchhoff stress
+                        // tensor at the quadrature point and add the
+                        // corresponding forces to the right-hand-side vector.
+                        if (PK1_batch_fcn)
+                        {
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                for (unsigned int j = 0; j < NDIM; ++j)
+                                {
+                                    PP(i, j) = PP_batch[(i * NDIM + j) * n_qp + qp];
+                                }
+                            }
+                        }
+                        else
+                        {
+                            const libMesh::Point& X = q_point[qp];
+                            const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                            const std::vector<VectorValue<double> >& grad_x_data =
+                                fe_interp_grad_var_data[qp][X_sys_idx];
+                            get_x_and_FF(x, FF, x_data, grad_x_data);
+                            fe.setInterpolatedDataPointers(
+                                PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                            d_PK1_stress_fcn_data[part][k].fcn(PP,
+                                                               FF,
+                                                               x,
+                                                               X,
+                                                               elem,
+                                                               PK1_var_data,
+                                                               PK1_grad_var_data,
+                                                               data_time,
+                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                        }
+                        for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                        {
+                            F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                F_rhs_elem[i](basis_n) += F_qp(i);
+                            }
+                        }
                     }
 
-                    // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
+                    // Loop over the element boundaries.
+                    for (unsigned int side = 0; side < elem->n_sides(); ++side)
                     {
-                        F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
-                        for (unsigned int i = 0; i < NDIM; ++i)
+                        // Skip non-physical boundaries.
+                        if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
+
+                        // Determine if we need to integrate surface forces
+                        // along this part of the physical boundary; if not,
+                        // skip the present side.
+                        const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
+                        const bool integrate_normal_stress =
+                            (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
+                            (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
+                        const bool integrate_tangential_stress =
+                            (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
+                            (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
+                        if (!integrate_normal_stress && !integrate_tangential_stress) continue;
+
+                        fe.reinit(elem, side);
+                        fe.interpolate(elem, side);
+                        const unsigned int n_qp_face = qrule_face->n_points();
+                        const size_t n_basis_face = phi_face.size();
+                        for (unsigned int qp = 0; qp < n_qp_face; ++qp)
                         {
-                            F_rhs_e[i](basis_face_n) += F_qp(i);
+                            const libMesh::Point& X = q_point_face[qp];
+                            const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                            const std::vector<VectorValue<double> >& grad_x_data =
+                                fe_interp_grad_var_data[qp][X_sys_idx];
+                            get_x_and_FF(x, FF, x_data, grad_x_data);
+                            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+
+                            F.zero();
+
+                            // Compute the value of the first Piola-Kirchhoff
+                            // stress tensor at the quadrature point and add the
+                            // corresponding traction force to the
+                            // right-hand-side vector.
+                            fe.setInterpolatedDataPointers(
+                                PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time);
+                            F += PP * normal_face[qp];
+
+                            n = (FF_inv_trans * normal_face[qp]).unit();
+
+                            if (!integrate_normal_stress)
+                            {
+                                F -= (F * n) * n; // remove the normal component.
+                            }
+
+                            if (!integrate_tangential_stress)
+                            {
+                                F -= (F - (F * n) * n); // remove the tangential component.
+                            }
+
+                            // Add the boundary forces to the right-hand-side
+                            // vector.
+                            for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
+                            {
+                                F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
+                                for (unsigned int i = 0; i < NDIM; ++i)
+                                {
+                                    F_rhs_elem[i](basis_face_n) += F_qp(i);
+                                }
+                            }
                         }
                     }
                 }
-            }
 
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
-            {
-                copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-                F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
-                for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                // Apply constraints (e.g., enforce periodic boundary
+                // conditions) and add the elemental contributions to the
+                // global vector.  The implicit barrier at the end of the
+                // preceding loop ensures that all of the elemental vectors in
+                // the batch are complete.
+#ifdef _OPENMP
+#pragma omp single
+#endif
                 {
-                    F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    for (size_t e = batch_begin; e < batch_end; ++e)
+                    {
+                        std::array<DenseVector<double>, NDIM>& F_rhs_elem = F_rhs_batch[e - batch_begin];
+                        for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+                        {
+                            copy_dof_ids_to_vector(var_n, *local_F_dof_indices[e], dof_id_scratch);
+                            F_dof_map.constrain_element_vector(F_rhs_elem[var_n], dof_id_scratch);
+                            for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                            {
+                                F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] +=
+                                    F_rhs_elem[var_n](j);
+                            }
+                        }
+                    }
                 }
             }
         }
@@ -1147,6 +1411,8 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
     // Force computation settings.
     if (db->isBool("use_consistent_mass_matrix"))
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
+    if (db->isBool("use_threaded_force_assembly"))
+        d_use_threaded_force_assembly = db->getBool("use_threaded_force_assembly");
 
     // Restart settings.
     if (db->isString("libmesh_restart_file_extension"))
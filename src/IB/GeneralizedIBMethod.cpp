@@ -30,6 +30,7 @@
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "BoxList.h"
 #include "CellVariable.h"
 #include "CoarsenSchedule.h"
 #include "GriddingAlgorithm.h"
@@ -302,6 +303,16 @@ GeneralizedIBMethod::interpolateVelocity(const int u_data_idx,
     return;
 } // interpolateVelocity
 
+bool
+GeneralizedIBMethod::computeInterpolationRegionBoxes(BoxList<NDIM>& region_boxes, const int /*level_number*/)
+{
+    // The curl of the velocity is evaluated on all patches, including those
+    // without Lagrangian nodes, and the ghost cells of the curl are then
+    // filled from those patches.
+    region_boxes.clearItems();
+    return false;
+} // computeInterpolationRegionBoxes
+
 void
 GeneralizedIBMethod::forwardEulerStep(const double current_time, const double new_time)
 {
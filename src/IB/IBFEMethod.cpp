@@ -41,6 +41,7 @@
 #include "BasePatchLevel.h"
 #include "BergerRigoutsos.h"
 #include "Box.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
@@ -164,6 +165,7 @@ static Timer* t_postprocess_integrate_data;
 static Timer* t_interpolate_velocity;
 static Timer* t_compute_lagrangian_force;
 static Timer* t_spread_force;
+static Timer* t_interpolate_velocity_and_spread_force;
 static Timer* t_compute_lagrangian_fluid_source;
 static Timer* t_spread_fluid_source;
 static Timer* t_add_workload_estimate;
@@ -593,23 +595,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
     IBAMR_TIMER_START(t_interpolate_velocity);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
-    if (d_use_scratch_hierarchy)
-    {
-        assertStructureOnFinestLevel();
-        getPrimaryToScratchSchedule(
-            d_hierarchy->getFinestLevelNumber(), u_data_idx, u_data_idx, d_ib_solver->getVelocityPhysBdryOp())
-            .fillData(data_time);
-    }
-    else
-    {
-        // Communicate ghost data. Note that this only needs to be done when
-        // we do *not* use the scratch hierarchy since the schedule will, in
-        // that case, fill ghost data.
-        for (const auto& u_ghost_fill_sched : u_ghost_fill_scheds)
-        {
-            if (u_ghost_fill_sched) u_ghost_fill_sched->fillData(data_time);
-        }
-    }
+    fillVelocityGhostData(u_data_idx, u_ghost_fill_scheds, data_time);
 
     std::vector<PetscVector<double>*> U_vecs = d_U_vecs->get(data_time_str);
     std::vector<PetscVector<double>*> X_vecs = d_X_vecs->get(data_time_str);
@@ -638,50 +624,31 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
     // Note that FEDataManager only reads (and does not modify) Eulerian data
     // during interpolation so nothing needs to be transferred back to
     // d_hierarchy from d_scratch_hierarchy.
-    batch_vec_ghost_update(U_rhs_vecs, ADD_VALUES, SCATTER_REVERSE);
-    batch_vec_ghost_update(U_rhs_vecs, INSERT_VALUES, SCATTER_FORWARD);
-
-    // If the velocity system has constraints then those need to be dealt with
-    // here and not during assembly because we do not distribute the
-    // constraints corresponding to the IB partitioning.
-    std::vector<PetscVector<double>*> vecs_for_second_summation;
-    for (unsigned int part = 0; part < d_meshes.size(); ++part)
-    {
-        if (d_part_is_active[part])
-        {
-            EquationSystems& equation_systems = *d_primary_fe_data_managers[part]->getEquationSystems();
-            vecs_for_second_summation.push_back(U_rhs_vecs[part]);
-            apply_transposed_constraint_matrix(equation_systems.get_system(VELOCITY_SYSTEM_NAME).get_dof_map(),
-                                               *U_rhs_vecs[part]);
-        }
-    }
-
-    batch_vec_ghost_update(vecs_for_second_summation, ADD_VALUES, SCATTER_REVERSE);
-    batch_vec_ghost_update(vecs_for_second_summation, INSERT_VALUES, SCATTER_FORWARD);
+    solveVelocityProjection(U_rhs_vecs, U_vecs);
+    IBAMR_TIMER_STOP(t_interpolate_velocity);
+    return;
+} // interpolateVelocity
 
-    // Solve for the interpolated data.
+bool
+IBFEMethod::computeInterpolationRegionBoxes(BoxList<NDIM>& region_boxes, const int level_number)
+{
+    region_boxes.clearItems();
+    if (d_use_scratch_hierarchy) return false;
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
-        if (d_part_is_active[part])
-        {
-            // TODO: Commenting out this line changes the solution slightly.
-            d_U_vecs->get("solution", part) = *U_vecs[part];
-            d_active_fe_data_managers[part]->computeL2Projection(d_U_vecs->get("solution", part),
-                                                                 *U_rhs_vecs[part],
-                                                                 VELOCITY_SYSTEM_NAME,
-                                                                 d_interp_spec[part].use_consistent_mass_matrix,
-                                                                 /*close_U*/ false,
-                                                                 /*close_F*/ false);
-            *U_vecs[part] = d_U_vecs->get("solution", part);
-        }
-        else
+        if (!d_part_is_active[part] || d_primary_fe_data_managers[part]->getLevelNumber() != level_number) continue;
+        const std::vector<std::vector<Elem*> >& active_patch_element_map =
+            d_primary_fe_data_managers[part]->getActivePatchElementMap();
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
-            U_vecs[part]->zero();
+            if (active_patch_element_map[local_patch_num].empty()) continue;
+            region_boxes.appendItem(level->getPatch(p())->getBox());
         }
     }
-    IBAMR_TIMER_STOP(t_interpolate_velocity);
-    return;
-} // interpolateVelocity
+    return true;
+} // computeInterpolationRegionBoxes
 
 void
 IBFEMethod::forwardEulerStep(const double current_time, const double new_time)
@@ -867,17 +834,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
     batch_vec_ghost_update({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
     // set up a new data index for computing forces on the active hierarchy.
-    Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
-    const int ln = hierarchy->getFinestLevelNumber();
-    const auto f_scratch_data_idx = d_active_eulerian_data_cache->getCachedPatchDataIndex(f_data_idx);
-    // zero data.
-    Pointer<hier::Variable<NDIM> > f_var;
-    VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(f_data_idx, f_var);
-    auto f_active_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, hierarchy);
-    f_active_data_ops->resetLevels(ln, ln);
-    f_active_data_ops->setToScalar(f_scratch_data_idx,
-                                   0.0,
-                                   /*interior_only*/ false);
+    const int f_scratch_data_idx = zeroForceScratchData(f_data_idx);
 
     // Spread interior force density values.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
@@ -888,86 +845,60 @@ IBFEMethod::spreadForce(const int f_data_idx,
         d_active_fe_data_managers[part]->spread(f_scratch_data_idx, *F_ghost_vec, *X_ghost_vec, FORCE_SYSTEM_NAME);
     }
 
-    // Handle any transmission conditions.
-    for (unsigned int part = 0; part < d_meshes.size(); ++part)
-    {
-        if (!d_part_is_active[part]) continue;
-        PetscVector<double>* X_ghost_vec = X_IB_ghost_vecs[part];
-        PetscVector<double>* F_ghost_vec = F_IB_ghost_vecs[part];
-        if (d_split_normal_force || d_split_tangential_force)
-        {
-            if (d_use_jump_conditions && d_split_normal_force)
-            {
-                imposeJumpConditions(f_scratch_data_idx, *F_ghost_vec, *X_ghost_vec, data_time, part);
-            }
-            if (!d_use_jump_conditions || d_split_tangential_force)
-            {
-                spreadTransmissionForceDensity(f_scratch_data_idx, *X_ghost_vec, data_time, part);
-            }
-        }
-    }
+    finishSpreadForce(f_data_idx, f_scratch_data_idx, f_phys_bdry_op, X_IB_ghost_vecs, F_IB_ghost_vecs, data_time);
+    IBAMR_TIMER_STOP(t_spread_force);
+    return;
+} // spreadForce
 
-    // Deal with force values spread outside the physical domain. Since these
-    // are spread into ghost regions that don't correspond to actual degrees
-    // of freedom they are ignored by the accumulation step - we have to
-    // handle this before we do that.
-    if (f_phys_bdry_op)
-    {
-        f_phys_bdry_op->setPatchDataIndex(f_scratch_data_idx);
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_scratch_data_idx);
-            f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, data_time, f_data->getGhostCellWidth());
-        }
-    }
+void
+IBFEMethod::interpolateVelocityAndSpreadForce(
+    const int u_data_idx,
+    const std::vector<Pointer<CoarsenSchedule<NDIM> > >& /*u_synch_scheds*/,
+    const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+    const int f_data_idx,
+    RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+    const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
+    const double data_time)
+{
+    IBAMR_TIMER_START(t_interpolate_velocity_and_spread_force);
+    const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
-    {
-        if (!d_ghost_data_accumulator)
-        {
-            // If we have multiple IBMethod objects we may end up with a wider
-            // ghost region than the one required by this class. Hence, set the
-            // ghost width by just picking whatever the data actually has at the
-            // moment.
-            const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-            const IntVector<NDIM> gcw =
-                level->getPatchDescriptor()->getPatchDataFactory(f_scratch_data_idx)->getGhostCellWidth();
+    fillVelocityGhostData(u_data_idx, u_ghost_fill_scheds, data_time);
 
-            d_ghost_data_accumulator.reset(new SAMRAIGhostDataAccumulator(
-                hierarchy, f_var, gcw, d_hierarchy->getFinestLevelNumber(), d_hierarchy->getFinestLevelNumber()));
-        }
-        d_ghost_data_accumulator->accumulateGhostData(f_scratch_data_idx);
-    }
+    // Both operations use the structure positions at data_time, so the
+    // IB-ghosted position vector only needs to be set up once.
+    std::vector<PetscVector<double>*> U_vecs = d_U_vecs->get(data_time_str);
+    std::vector<PetscVector<double>*> U_rhs_vecs = d_U_IB_vecs->getIBGhosted("tmp");
+    std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
+    std::vector<PetscVector<double>*> F_IB_ghost_vecs = d_F_IB_vecs->getIBGhosted("tmp");
+    batch_vec_copy({ d_X_vecs->get(data_time_str), d_F_vecs->get(data_time_str) },
+                   { X_IB_ghost_vecs, F_IB_ghost_vecs });
+    batch_vec_ghost_update({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
-    if (d_use_scratch_hierarchy)
-    {
-        // harder case: we have a scratch index on the scratch hierarchy but
-        // no corresponding index on the primary hierarchy.
-        //
-        // unlike the other data ops, this is always on the primary hierarchy
-        auto f_primary_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy);
-        f_primary_data_ops->resetLevels(ln, ln);
-        const auto f_primary_scratch_data_idx = d_primary_eulerian_data_cache->getCachedPatchDataIndex(f_data_idx);
-        // we have to zero everything here since the scratch to primary
-        // communication does not touch ghost cells, which may have junk
-        f_primary_data_ops->setToScalar(f_primary_scratch_data_idx,
-                                        0.0,
-                                        /*interior_only*/ false);
+    const int f_scratch_data_idx = zeroForceScratchData(f_data_idx);
 
-        assertStructureOnFinestLevel();
-        getScratchToPrimarySchedule(ln, f_primary_scratch_data_idx, f_scratch_data_idx).fillData(data_time);
-        f_primary_data_ops->add(f_data_idx, f_data_idx, f_primary_scratch_data_idx);
-    }
-    else
+    // Build the right-hand-sides to compute the interpolated data and spread
+    // interior force density values in a single pass over the patches.
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
-        // easier case: f_scratch_data_idx is on the primary hierarchy so we
-        // just need to add its values to those in f_data_idx
-        f_active_data_ops->add(f_data_idx, f_data_idx, f_scratch_data_idx);
-    }
-    IBAMR_TIMER_STOP(t_spread_force);
+        if (!d_part_is_active[part]) continue;
+        FEDataManager* const fe_data_manager = d_active_fe_data_managers[part];
+        fe_data_manager->interpWeightedAndSpread(u_data_idx,
+                                                 *U_rhs_vecs[part],
+                                                 VELOCITY_SYSTEM_NAME,
+                                                 fe_data_manager->getDefaultInterpSpec(),
+                                                 f_scratch_data_idx,
+                                                 *F_IB_ghost_vecs[part],
+                                                 FORCE_SYSTEM_NAME,
+                                                 fe_data_manager->getDefaultSpreadSpec(),
+                                                 *X_IB_ghost_vecs[part]);
+    }
+
+    solveVelocityProjection(U_rhs_vecs, U_vecs);
+    finishSpreadForce(f_data_idx, f_scratch_data_idx, f_phys_bdry_op, X_IB_ghost_vecs, F_IB_ghost_vecs, data_time);
+    IBAMR_TIMER_STOP(t_interpolate_velocity_and_spread_force);
     return;
-} // spreadForce
+} // interpolateVelocityAndSpreadForce
 
 bool
 IBFEMethod::hasFluidSources() const
@@ -1645,6 +1576,7 @@ IBFEMethod::doInitializeFEEquationSystems()
         d_fe_data[part] = d_primary_fe_data_managers[part]->getFEData();
 
         d_active_fe_data_managers[part]->setLoggingEnabled(d_do_log);
+        d_active_fe_data_managers[part]->setQuadratureDataCachingEnabled(d_cache_quadrature_data);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_active_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -1972,22 +1904,15 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].isSet())
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        d_PK1_stress_fcn_data[part][k].evaluate(
+                            PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -2251,22 +2176,15 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2636,22 +2554,15 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                PP, FF, x, X, elem, PK1_var_data[k], PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2932,6 +2843,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
                   t_interpolate_velocity = set_timer("IBAMR::IBFEMethod::interpolateVelocity()");
                   t_compute_lagrangian_force = set_timer("IBAMR::IBFEMethod::computeLagrangianForce()");
                   t_spread_force = set_timer("IBAMR::IBFEMethod::spreadForce()");
+                  t_interpolate_velocity_and_spread_force =
+                      set_timer("IBAMR::IBFEMethod::interpolateVelocityAndSpreadForce()");
                   t_compute_lagrangian_fluid_source = set_timer("IBAMR::IBFEMethod::computeLagrangianFluidSource()");
                   t_spread_fluid_source = set_timer("IBAMR::IBFEMethod::spreadFluidSource()");
                   t_add_workload_estimate = set_timer("IBAMR::IBFEMethod::addWorkloadEstimate()");
@@ -3035,6 +2948,8 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     else if (db->isDouble("IB_point_density"))
         d_default_spread_spec.point_density = db->getDouble("IB_point_density");
 
+    if (db->isBool("cache_quadrature_data")) d_cache_quadrature_data = db->getBool("cache_quadrature_data");
+
     // Force computation settings.
     if (db->isBool("split_normal_force"))
         d_split_normal_force = db->getBool("split_normal_force");
@@ -3136,6 +3051,191 @@ IBFEMethod::getFromRestart()
     return;
 } // getFromRestart
 
+void
+IBFEMethod::fillVelocityGhostData(const int u_data_idx,
+                                  const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+                                  const double data_time)
+{
+    if (d_use_scratch_hierarchy)
+    {
+        assertStructureOnFinestLevel();
+        getPrimaryToScratchSchedule(
+            d_hierarchy->getFinestLevelNumber(), u_data_idx, u_data_idx, d_ib_solver->getVelocityPhysBdryOp())
+            .fillData(data_time);
+    }
+    else
+    {
+        // Communicate ghost data. Note that this only needs to be done when
+        // we do *not* use the scratch hierarchy since the schedule will, in
+        // that case, fill ghost data.
+        for (const auto& u_ghost_fill_sched : u_ghost_fill_scheds)
+        {
+            if (u_ghost_fill_sched) u_ghost_fill_sched->fillData(data_time);
+        }
+    }
+    return;
+} // fillVelocityGhostData
+
+void
+IBFEMethod::solveVelocityProjection(const std::vector<PetscVector<double>*>& U_rhs_vecs,
+                                    const std::vector<PetscVector<double>*>& U_vecs)
+{
+    batch_vec_ghost_update(U_rhs_vecs, ADD_VALUES, SCATTER_REVERSE);
+    batch_vec_ghost_update(U_rhs_vecs, INSERT_VALUES, SCATTER_FORWARD);
+
+    // If the velocity system has constraints then those need to be dealt with
+    // here and not during assembly because we do not distribute the
+    // constraints corresponding to the IB partitioning.
+    std::vector<PetscVector<double>*> vecs_for_second_summation;
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        if (d_part_is_active[part])
+        {
+            EquationSystems& equation_systems = *d_primary_fe_data_managers[part]->getEquationSystems();
+            vecs_for_second_summation.push_back(U_rhs_vecs[part]);
+            apply_transposed_constraint_matrix(equation_systems.get_system(VELOCITY_SYSTEM_NAME).get_dof_map(),
+                                               *U_rhs_vecs[part]);
+        }
+    }
+
+    batch_vec_ghost_update(vecs_for_second_summation, ADD_VALUES, SCATTER_REVERSE);
+    batch_vec_ghost_update(vecs_for_second_summation, INSERT_VALUES, SCATTER_FORWARD);
+
+    // Solve for the interpolated data.
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        if (d_part_is_active[part])
+        {
+            // TODO: Commenting out this line changes the solution slightly.
+            d_U_vecs->get("solution", part) = *U_vecs[part];
+            d_active_fe_data_managers[part]->computeL2Projection(d_U_vecs->get("solution", part),
+                                                                 *U_rhs_vecs[part],
+                                                                 VELOCITY_SYSTEM_NAME,
+                                                                 d_interp_spec[part].use_consistent_mass_matrix,
+                                                                 /*close_U*/ false,
+                                                                 /*close_F*/ false);
+            *U_vecs[part] = d_U_vecs->get("solution", part);
+        }
+        else
+        {
+            U_vecs[part]->zero();
+        }
+    }
+    return;
+} // solveVelocityProjection
+
+int
+IBFEMethod::zeroForceScratchData(const int f_data_idx)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
+    const int ln = hierarchy->getFinestLevelNumber();
+    const auto f_scratch_data_idx = d_active_eulerian_data_cache->getCachedPatchDataIndex(f_data_idx);
+    // zero data.
+    Pointer<hier::Variable<NDIM> > f_var;
+    VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(f_data_idx, f_var);
+    auto f_active_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, hierarchy);
+    f_active_data_ops->resetLevels(ln, ln);
+    f_active_data_ops->setToScalar(f_scratch_data_idx,
+                                   0.0,
+                                   /*interior_only*/ false);
+    return f_scratch_data_idx;
+} // zeroForceScratchData
+
+void
+IBFEMethod::finishSpreadForce(const int f_data_idx,
+                              const int f_scratch_data_idx,
+                              RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                              const std::vector<PetscVector<double>*>& X_IB_ghost_vecs,
+                              const std::vector<PetscVector<double>*>& F_IB_ghost_vecs,
+                              const double data_time)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
+    const int ln = hierarchy->getFinestLevelNumber();
+    Pointer<hier::Variable<NDIM> > f_var;
+    VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(f_data_idx, f_var);
+    auto f_active_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, hierarchy);
+    f_active_data_ops->resetLevels(ln, ln);
+
+    // Handle any transmission conditions.
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        if (!d_part_is_active[part]) continue;
+        PetscVector<double>* X_ghost_vec = X_IB_ghost_vecs[part];
+        PetscVector<double>* F_ghost_vec = F_IB_ghost_vecs[part];
+        if (d_split_normal_force || d_split_tangential_force)
+        {
+            if (d_use_jump_conditions && d_split_normal_force)
+            {
+                imposeJumpConditions(f_scratch_data_idx, *F_ghost_vec, *X_ghost_vec, data_time, part);
+            }
+            if (!d_use_jump_conditions || d_split_tangential_force)
+            {
+                spreadTransmissionForceDensity(f_scratch_data_idx, *X_ghost_vec, data_time, part);
+            }
+        }
+    }
+
+    // Deal with force values spread outside the physical domain. Since these
+    // are spread into ghost regions that don't correspond to actual degrees
+    // of freedom they are ignored by the accumulation step - we have to
+    // handle this before we do that.
+    if (f_phys_bdry_op)
+    {
+        f_phys_bdry_op->setPatchDataIndex(f_scratch_data_idx);
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_scratch_data_idx);
+            f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, data_time, f_data->getGhostCellWidth());
+        }
+    }
+
+    {
+        if (!d_ghost_data_accumulator)
+        {
+            // If we have multiple IBMethod objects we may end up with a wider
+            // ghost region than the one required by this class. Hence, set the
+            // ghost width by just picking whatever the data actually has at the
+            // moment.
+            const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            const IntVector<NDIM> gcw =
+                level->getPatchDescriptor()->getPatchDataFactory(f_scratch_data_idx)->getGhostCellWidth();
+
+            d_ghost_data_accumulator.reset(new SAMRAIGhostDataAccumulator(
+                hierarchy, f_var, gcw, d_hierarchy->getFinestLevelNumber(), d_hierarchy->getFinestLevelNumber()));
+        }
+        d_ghost_data_accumulator->accumulateGhostData(f_scratch_data_idx);
+    }
+
+    if (d_use_scratch_hierarchy)
+    {
+        // harder case: we have a scratch index on the scratch hierarchy but
+        // no corresponding index on the primary hierarchy.
+        //
+        // unlike the other data ops, this is always on the primary hierarchy
+        auto f_primary_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy);
+        f_primary_data_ops->resetLevels(ln, ln);
+        const auto f_primary_scratch_data_idx = d_primary_eulerian_data_cache->getCachedPatchDataIndex(f_data_idx);
+        // we have to zero everything here since the scratch to primary
+        // communication does not touch ghost cells, which may have junk
+        f_primary_data_ops->setToScalar(f_primary_scratch_data_idx,
+                                        0.0,
+                                        /*interior_only*/ false);
+
+        assertStructureOnFinestLevel();
+        getScratchToPrimarySchedule(ln, f_primary_scratch_data_idx, f_scratch_data_idx).fillData(data_time);
+        f_primary_data_ops->add(f_data_idx, f_data_idx, f_primary_scratch_data_idx);
+    }
+    else
+    {
+        // easier case: f_scratch_data_idx is on the primary hierarchy so we
+        // just need to add its values to those in f_data_idx
+        f_active_data_ops->add(f_data_idx, f_data_idx, f_scratch_data_idx);
+    }
+    return;
+} // finishSpreadForce
+
 void
 IBFEMethod::assertStructureOnFinestLevel() const
 {
@@ -25,13 +25,16 @@
 #include "ibtk/CartGridFunctionSet.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/HierarchyIntegrator.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/StencilRegionFillPattern.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -63,6 +66,7 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <cmath>
 #include <deque>
 #include <memory>
 #include <ostream>
@@ -287,7 +291,25 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
 
     d_u_ghostfill_alg = new RefineAlgorithm<NDIM>();
     d_u_ghostfill_op = nullptr;
-    d_u_ghostfill_alg->registerRefine(d_u_idx, d_u_idx, d_u_idx, d_u_ghostfill_op);
+    if (d_use_stencil_region_ghost_fill)
+    {
+        // The regions are only updated when the Lagrangian data are
+        // redistributed, so they are grown to contain every position the
+        // structure can reach before the next regrid: regrid_cfl_interval
+        // cells, plus one more cell for the time step that exceeds it.
+        if (d_regrid_cfl_interval <= 0.0)
+        {
+            TBOX_ERROR(d_object_name << "::initializeHierarchyIntegrator():\n"
+                                     << "  use_stencil_region_ghost_fill requires a positive regrid_cfl_interval\n");
+        }
+        const int region_margin = static_cast<int>(std::ceil(d_regrid_cfl_interval)) + 1;
+        d_u_ghostfill_pattern = new StencilRegionFillPattern(ib_ghosts.max(), region_margin);
+        d_u_ghostfill_alg->registerRefine(d_u_idx, d_u_idx, d_u_idx, d_u_ghostfill_op, d_u_ghostfill_pattern);
+    }
+    else
+    {
+        d_u_ghostfill_alg->registerRefine(d_u_idx, d_u_idx, d_u_idx, d_u_ghostfill_op);
+    }
     std::unique_ptr<RefinePatchStrategy<NDIM> > u_phys_bdry_op_unique(d_u_phys_bdry_op);
     registerGhostfillRefineAlgorithm(d_object_name + "::u", d_u_ghostfill_alg, std::move(u_phys_bdry_op_unique));
 
@@ -387,6 +409,7 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
 
         // Finish Lagrangian data movement.
         d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
+        resetVelocityGhostfillRegions();
     }
 
     // Initialize Lagrangian data on the patch hierarchy.
@@ -442,6 +465,7 @@ IBHierarchyIntegrator::regridHierarchyBeginSpecialized()
     // Before regridding, begin Lagrangian data movement.
     if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): starting Lagrangian data movement\n";
     d_ib_method_ops->beginDataRedistribution(d_hierarchy, d_gridding_alg);
+    if (d_u_ghostfill_pattern) d_u_ghostfill_pattern->clearRegionBoxes();
     if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): regridding the patch hierarchy\n";
     return;
 } // regridHierarchyBeginSpecialized
@@ -452,6 +476,7 @@ IBHierarchyIntegrator::regridHierarchyEndSpecialized()
     // After regridding, finish Lagrangian data movement.
     if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): finishing Lagrangian data movement\n";
     d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
+    resetVelocityGhostfillRegions();
 
     // Prune any duplicated markers located in the "invalid" regions of coarser
     // levels of the patch hierarchy.
@@ -533,6 +558,7 @@ IBHierarchyIntegrator::initializeCompositeHierarchyDataSpecialized(double /*init
 
         // Finish Lagrangian data movement.
         d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
+        resetVelocityGhostfillRegions();
     }
 
     return;
@@ -635,6 +661,27 @@ IBHierarchyIntegrator::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierar
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBHierarchyIntegrator::resetVelocityGhostfillRegions()
+{
+    if (!d_u_ghostfill_pattern) return;
+    d_u_ghostfill_pattern->clearRegionBoxes();
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        // Setting the regions is collective, so only restrict the level if
+        // the regions are known on every process.
+        BoxList<NDIM> region_boxes;
+        const int restrict_level = d_ib_method_ops->computeInterpolationRegionBoxes(region_boxes, ln);
+        if (IBTK_MPI::minReduction(restrict_level))
+        {
+            d_u_ghostfill_pattern->setRegionBoxes(d_hierarchy->getPatchLevel(ln), region_boxes);
+        }
+    }
+    rebuildGhostfillRefineSchedules(d_object_name + "::u");
+    return;
+} // resetVelocityGhostfillRegions
+
 void
 IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
@@ -656,6 +703,8 @@ IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart
     else if (db->keyExists("timestepping_type"))
         d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("timestepping_type"));
     if (db->keyExists("marker_file_name")) d_mark_file_name = db->getString("marker_file_name");
+    if (db->keyExists("use_stencil_region_ghost_fill"))
+        d_use_stencil_region_ghost_fill = db->getBool("use_stencil_region_ghost_fill");
     return;
 } // getFromInput
 
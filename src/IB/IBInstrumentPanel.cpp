@@ -25,6 +25,7 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchLevel.h"
@@ -1201,6 +1202,10 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
                                  << "  dump directory name is empty" << std::endl);
     }
 
+    // Silo is not thread-safe, so any asynchronous Lagrangian data writes must
+    // finish first.
+    LSiloDataWriter::waitForAllPendingWrites();
+
     char temp_buf[SILO_NAME_BUFSIZE];
     std::string current_file_name;
     DBfile* dbfile;
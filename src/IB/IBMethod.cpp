@@ -173,6 +173,8 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseMortonOrdering(d_use_morton_ordering);
+    d_l_data_manager->setLDataRestartDirectory(d_ldata_restart_dirname);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -714,6 +716,13 @@ IBMethod::interpolateLinearizedVelocity(const int u_data_idx,
     return;
 } // interpolateLinearizedVelocity
 
+bool
+IBMethod::computeInterpolationRegionBoxes(BoxList<NDIM>& region_boxes, const int level_number)
+{
+    d_l_data_manager->computeLagrangianNodeBoxes(region_boxes, level_number);
+    return true;
+} // computeInterpolationRegionBoxes
+
 void
 IBMethod::forwardEulerStep(const double current_time, const double new_time)
 {
@@ -2028,11 +2037,14 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("use_morton_ordering")) d_use_morton_ordering = db->getBool("use_morton_ordering");
+    if (db->keyExists("ldata_restart_dirname")) d_ldata_restart_dirname = db->getString("ldata_restart_dirname");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     return;
 } // getFromInput
 
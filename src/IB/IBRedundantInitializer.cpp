@@ -59,10 +59,14 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <limits>
 #include <map>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -75,6 +79,267 @@ class LDataManager;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+const char STRUCTURE_CACHE_MAGIC[8] = { 'I', 'B', 'C', 'A', 'C', 'H', 'E', '\0' };
+const std::int32_t STRUCTURE_CACHE_VERSION = 1;
+
+// Binary serialization of the structure data.  Containers are stored as their
+// size followed by their elements.  Errors are reported through the state of
+// the stream.
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+write_cache(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+} // write_cache
+
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+read_cache(std::istream& is, T& value)
+{
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+} // read_cache
+
+void write_cache(std::ostream& os, const Vector& value);
+void read_cache(std::istream& is, Vector& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::SpringSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::SpringSpec& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::XSpringSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::XSpringSpec& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::BeamSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::BeamSpec& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::RodSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::RodSpec& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::TargetSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::TargetSpec& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::AnchorSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::AnchorSpec& value);
+void write_cache(std::ostream& os, const IBRedundantInitializer::BdryMassSpec& value);
+void read_cache(std::istream& is, IBRedundantInitializer::BdryMassSpec& value);
+template <typename T1, typename T2>
+void write_cache(std::ostream& os, const std::pair<T1, T2>& value);
+template <typename T1, typename T2>
+void read_cache(std::istream& is, std::pair<T1, T2>& value);
+template <typename T>
+void write_cache(std::ostream& os, const std::vector<T>& value);
+template <typename T>
+void read_cache(std::istream& is, std::vector<T>& value);
+template <typename Key, typename T, typename Compare>
+void write_cache(std::ostream& os, const std::map<Key, T, Compare>& value);
+template <typename Key, typename T, typename Compare>
+void read_cache(std::istream& is, std::map<Key, T, Compare>& value);
+template <typename Key, typename T, typename Compare>
+void write_cache(std::ostream& os, const std::multimap<Key, T, Compare>& value);
+template <typename Key, typename T, typename Compare>
+void read_cache(std::istream& is, std::multimap<Key, T, Compare>& value);
+
+template <typename T1, typename T2>
+void
+write_cache(std::ostream& os, const std::pair<T1, T2>& value)
+{
+    write_cache(os, value.first);
+    write_cache(os, value.second);
+} // write_cache
+
+template <typename T1, typename T2>
+void
+read_cache(std::istream& is, std::pair<T1, T2>& value)
+{
+    read_cache(is, value.first);
+    read_cache(is, value.second);
+} // read_cache
+
+template <typename T>
+void
+write_cache(std::ostream& os, const std::vector<T>& value)
+{
+    write_cache(os, static_cast<std::uint64_t>(value.size()));
+    for (const auto& v : value) write_cache(os, v);
+} // write_cache
+
+template <typename T>
+void
+read_cache(std::istream& is, std::vector<T>& value)
+{
+    std::uint64_t size = 0;
+    read_cache(is, size);
+    value.clear();
+    for (std::uint64_t k = 0; k < size && is; ++k)
+    {
+        T v;
+        read_cache(is, v);
+        value.push_back(std::move(v));
+    }
+} // read_cache
+
+template <typename Map>
+void
+write_cache_map(std::ostream& os, const Map& value)
+{
+    write_cache(os, static_cast<std::uint64_t>(value.size()));
+    for (const auto& v : value)
+    {
+        write_cache(os, v.first);
+        write_cache(os, v.second);
+    }
+} // write_cache_map
+
+template <typename Map>
+void
+read_cache_map(std::istream& is, Map& value)
+{
+    std::uint64_t size = 0;
+    read_cache(is, size);
+    value.clear();
+    for (std::uint64_t k = 0; k < size && is; ++k)
+    {
+        std::pair<typename Map::key_type, typename Map::mapped_type> v;
+        read_cache(is, v.first);
+        read_cache(is, v.second);
+        value.insert(value.end(), std::move(v));
+    }
+} // read_cache_map
+
+template <typename Key, typename T, typename Compare>
+void
+write_cache(std::ostream& os, const std::map<Key, T, Compare>& value)
+{
+    write_cache_map(os, value);
+} // write_cache
+
+template <typename Key, typename T, typename Compare>
+void
+read_cache(std::istream& is, std::map<Key, T, Compare>& value)
+{
+    read_cache_map(is, value);
+} // read_cache
+
+template <typename Key, typename T, typename Compare>
+void
+write_cache(std::ostream& os, const std::multimap<Key, T, Compare>& value)
+{
+    write_cache_map(os, value);
+} // write_cache
+
+template <typename Key, typename T, typename Compare>
+void
+read_cache(std::istream& is, std::multimap<Key, T, Compare>& value)
+{
+    read_cache_map(is, value);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const Vector& value)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) write_cache(os, value[d]);
+} // write_cache
+
+void
+read_cache(std::istream& is, Vector& value)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) read_cache(is, value[d]);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::SpringSpec& value)
+{
+    write_cache(os, value.parameters);
+    write_cache(os, value.force_fcn_idx);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::SpringSpec& value)
+{
+    read_cache(is, value.parameters);
+    read_cache(is, value.force_fcn_idx);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::XSpringSpec& value)
+{
+    write_cache(os, value.parameters);
+    write_cache(os, value.force_fcn_idx);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::XSpringSpec& value)
+{
+    read_cache(is, value.parameters);
+    read_cache(is, value.force_fcn_idx);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::BeamSpec& value)
+{
+    write_cache(os, value.neighbor_idxs);
+    write_cache(os, value.bend_rigidity);
+    write_cache(os, value.curvature);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::BeamSpec& value)
+{
+    read_cache(is, value.neighbor_idxs);
+    read_cache(is, value.bend_rigidity);
+    read_cache(is, value.curvature);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::RodSpec& value)
+{
+    for (const double p : value.properties) write_cache(os, p);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::RodSpec& value)
+{
+    for (double& p : value.properties) read_cache(is, p);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::TargetSpec& value)
+{
+    write_cache(os, value.stiffness);
+    write_cache(os, value.damping);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::TargetSpec& value)
+{
+    read_cache(is, value.stiffness);
+    read_cache(is, value.damping);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::AnchorSpec& value)
+{
+    write_cache(os, value.is_anchor_point);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::AnchorSpec& value)
+{
+    read_cache(is, value.is_anchor_point);
+} // read_cache
+
+void
+write_cache(std::ostream& os, const IBRedundantInitializer::BdryMassSpec& value)
+{
+    write_cache(os, value.bdry_mass);
+    write_cache(os, value.stiffness);
+} // write_cache
+
+void
+read_cache(std::istream& is, IBRedundantInitializer::BdryMassSpec& value)
+{
+    read_cache(is, value.bdry_mass);
+    read_cache(is, value.stiffness);
+} // read_cache
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBRedundantInitializer::IBRedundantInitializer(std::string object_name, Pointer<Database> input_db)
@@ -1234,15 +1499,31 @@ IBRedundantInitializer::init()
     }
     else
     {
-        // Process structure information.
-        initializeStructurePosition();
-        initializeSprings();
-        initializeXSprings();
-        initializeBeams();
-        initializeDirectorAndRods();
-        initializeBoundaryMass();
-        initializeTargetPts();
-        initializeAnchorPts();
+        // Process structure information, unless it can be read from the
+        // structure cache.
+        std::string cache_key;
+        const bool use_cache = !d_structure_cache_filename.empty();
+        if (use_cache)
+        {
+            cache_key = d_structure_cache_key;
+            for (const auto& base_filenames : d_base_filename)
+            {
+                for (const auto& base_filename : base_filenames) cache_key += "\n" + base_filename;
+                cache_key += "\n";
+            }
+        }
+        if (!use_cache || !readStructureCache(d_structure_cache_filename, cache_key))
+        {
+            initializeStructurePosition();
+            initializeSprings();
+            initializeXSprings();
+            initializeBeams();
+            initializeDirectorAndRods();
+            initializeBoundaryMass();
+            initializeTargetPts();
+            initializeAnchorPts();
+            if (use_cache) writeStructureCache(d_structure_cache_filename, cache_key);
+        }
         initializeInstrumentationData();
         initializeSourceData();
     }
@@ -1255,6 +1536,130 @@ IBRedundantInitializer::init()
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+IBRedundantInitializer::writeStructureCache(const std::string& filename, const std::string& key) const
+{
+    if (IBTK_MPI::getRank() != 0) return;
+
+    // Write to a temporary file that is moved into place once it is complete,
+    // so that a concurrently starting run never reads a partial cache.
+    const std::string tmp_filename = filename + ".tmp";
+    std::ofstream os(tmp_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    os.write(STRUCTURE_CACHE_MAGIC, sizeof(STRUCTURE_CACHE_MAGIC));
+    write_cache(os, STRUCTURE_CACHE_VERSION);
+    write_cache(os, static_cast<std::int32_t>(NDIM));
+    write_cache(os, static_cast<std::uint64_t>(key.size()));
+    os.write(key.data(), key.size());
+    write_cache(os, d_num_vertex);
+    write_cache(os, d_vertex_offset);
+    write_cache(os, d_vertex_posn);
+    write_cache(os, d_spring_edge_map);
+    write_cache(os, d_spring_spec_data);
+    write_cache(os, d_xspring_edge_map);
+    write_cache(os, d_xspring_spec_data);
+    write_cache(os, d_beam_spec_data);
+    write_cache(os, d_rod_edge_map);
+    write_cache(os, d_rod_spec_data);
+    write_cache(os, d_target_spec_data);
+    write_cache(os, d_anchor_spec_data);
+    write_cache(os, d_bdry_mass_spec_data);
+    write_cache(os, d_directors);
+    os.close();
+    if (!os || std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+    {
+        TBOX_WARNING(d_object_name << ":\n  Unable to write structure cache file " << filename << std::endl);
+        std::remove(tmp_filename.c_str());
+        return;
+    }
+    plog << d_object_name << ":  "
+         << "wrote structure cache file named " << filename << std::endl;
+    return;
+} // writeStructureCache
+
+bool
+IBRedundantInitializer::readStructureCache(const std::string& filename, const std::string& key)
+{
+    // Read into temporaries so that a missing, stale, or truncated file leaves
+    // the current data untouched.
+    std::vector<std::vector<int> > num_vertex, vertex_offset;
+    std::vector<std::vector<std::vector<Point> > > vertex_posn;
+    std::vector<std::vector<std::multimap<int, Edge> > > spring_edge_map, xspring_edge_map, rod_edge_map;
+    std::vector<std::vector<std::map<Edge, SpringSpec, EdgeComp> > > spring_spec_data;
+    std::vector<std::vector<std::map<Edge, XSpringSpec, EdgeComp> > > xspring_spec_data;
+    std::vector<std::vector<std::multimap<int, BeamSpec> > > beam_spec_data;
+    std::vector<std::vector<std::map<Edge, RodSpec, EdgeComp> > > rod_spec_data;
+    std::vector<std::vector<std::vector<TargetSpec> > > target_spec_data;
+    std::vector<std::vector<std::vector<AnchorSpec> > > anchor_spec_data;
+    std::vector<std::vector<std::vector<BdryMassSpec> > > bdry_mass_spec_data;
+    std::vector<std::vector<std::vector<std::vector<double> > > > directors;
+    auto read_cache_file = [&]() {
+        std::ifstream is(filename, std::ios::in | std::ios::binary);
+        if (!is.is_open()) return false;
+
+        char magic[8];
+        std::int32_t version = 0, ndim = 0;
+        std::uint64_t key_size = 0;
+        is.read(magic, sizeof(magic));
+        read_cache(is, version);
+        read_cache(is, ndim);
+        read_cache(is, key_size);
+        if (!is || !std::equal(magic, magic + 8, STRUCTURE_CACHE_MAGIC) || version != STRUCTURE_CACHE_VERSION ||
+            ndim != NDIM || key_size != key.size())
+        {
+            return false;
+        }
+        std::string cached_key(key_size, '\0');
+        is.read(&cached_key[0], key_size);
+        if (!is || cached_key != key) return false;
+
+        read_cache(is, num_vertex);
+        read_cache(is, vertex_offset);
+        read_cache(is, vertex_posn);
+        read_cache(is, spring_edge_map);
+        read_cache(is, spring_spec_data);
+        read_cache(is, xspring_edge_map);
+        read_cache(is, xspring_spec_data);
+        read_cache(is, beam_spec_data);
+        read_cache(is, rod_edge_map);
+        read_cache(is, rod_spec_data);
+        read_cache(is, target_spec_data);
+        read_cache(is, anchor_spec_data);
+        read_cache(is, bdry_mass_spec_data);
+        read_cache(is, directors);
+        if (!is || num_vertex.size() != d_num_vertex.size())
+        {
+            TBOX_WARNING(d_object_name << ":\n  Ignoring invalid structure cache file " << filename
+                                       << " on MPI process " << IBTK_MPI::getRank() << std::endl);
+            return false;
+        }
+        return true;
+    };
+
+    // Only use the cache if every process could read it.  Otherwise, the
+    // processes that could not would read the input files by themselves and
+    // wait forever in the collective operations used while reading.
+    const int local_success = read_cache_file() ? 1 : 0;
+    if (IBTK_MPI::minReduction(local_success) == 0) return false;
+
+    d_num_vertex = std::move(num_vertex);
+    d_vertex_offset = std::move(vertex_offset);
+    d_vertex_posn = std::move(vertex_posn);
+    d_spring_edge_map = std::move(spring_edge_map);
+    d_spring_spec_data = std::move(spring_spec_data);
+    d_xspring_edge_map = std::move(xspring_edge_map);
+    d_xspring_spec_data = std::move(xspring_spec_data);
+    d_beam_spec_data = std::move(beam_spec_data);
+    d_rod_edge_map = std::move(rod_edge_map);
+    d_rod_spec_data = std::move(rod_spec_data);
+    d_target_spec_data = std::move(target_spec_data);
+    d_anchor_spec_data = std::move(anchor_spec_data);
+    d_bdry_mass_spec_data = std::move(bdry_mass_spec_data);
+    d_directors = std::move(directors);
+    plog << d_object_name << ":  "
+         << "read structure data from cache file named " << filename << std::endl;
+    return true;
+} // readStructureCache
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -1676,6 +2081,11 @@ IBRedundantInitializer::getFromInput(Pointer<Database> db)
 
     d_global_index_offset.resize(d_max_levels);
 
+    // Determine whether to cache the processed structure data.
+    if (db->keyExists("structure_cache_filename"))
+        d_structure_cache_filename = db->getString("structure_cache_filename");
+    if (db->keyExists("structure_cache_key")) d_structure_cache_key = db->getString("structure_cache_key");
+
     // Determine the various input file names.
     //
     // Prefer to use the new ``structure_names'' key, but revert to the
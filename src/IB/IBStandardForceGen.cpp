@@ -117,6 +117,169 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// Sort the (node, force) contributions by node so that the contributions to
+// each node are accumulated in a fixed order.  Each contribution list pairs
+// the node indices of the force elements with the weight of their forces.
+template <typename GatherData>
+void
+buildForceGatherData(GatherData& gather, const std::vector<std::pair<const std::vector<int>*, double> >& contributions)
+{
+    struct Contribution
+    {
+        int node_idx, force_idx;
+        double weight;
+    };
+    std::vector<Contribution> entries;
+    for (const auto& contribution : contributions)
+    {
+        const std::vector<int>& node_idxs = *contribution.first;
+        for (unsigned int k = 0; k < node_idxs.size(); ++k)
+        {
+            entries.push_back({ node_idxs[k], static_cast<int>(NDIM * k), contribution.second });
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const Contribution& a, const Contribution& b) {
+        return a.node_idx < b.node_idx;
+    });
+
+    gather.node_idxs.clear();
+    gather.offsets.clear();
+    gather.force_idxs.resize(entries.size());
+    gather.weights.resize(entries.size());
+    for (unsigned int l = 0; l < entries.size(); ++l)
+    {
+        if (l == 0 || entries[l].node_idx != entries[l - 1].node_idx)
+        {
+            gather.node_idxs.push_back(entries[l].node_idx);
+            gather.offsets.push_back(static_cast<int>(l));
+        }
+        gather.force_idxs[l] = entries[l].force_idx;
+        gather.weights[l] = entries[l].weight;
+    }
+    gather.offsets.push_back(static_cast<int>(entries.size()));
+    return;
+} // buildForceGatherData
+
+// Add the weighted element forces to the nodal forces.  Each node is updated
+// by exactly one thread, and always in the same order.
+template <typename GatherData>
+void
+accumulateForces(double* const F_node, const double* const forces, const GatherData& gather, const bool use_threads)
+{
+    const int num_nodes = static_cast<int>(gather.node_idxs.size());
+    const int* const node_idxs = gather.node_idxs.data();
+    const int* const offsets = gather.offsets.data();
+    const int* const force_idxs = gather.force_idxs.data();
+    const double* const weights = gather.weights.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (use_threads)
+#endif
+    for (int n = 0; n < num_nodes; ++n)
+    {
+        double F[NDIM] = { 0.0 };
+        for (int l = offsets[n]; l < offsets[n + 1]; ++l)
+        {
+            const double w = weights[l];
+            const double* const f = forces + force_idxs[l];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                F[d] += w * f[d];
+            }
+        }
+        double* const F_n = F_node + node_idxs[n];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F_n[d] += F[d];
+        }
+    }
+    return;
+} // accumulateForces
+
+// Compute the forces of the linear springs k_begin through k_end-1, whose
+// stiffnesses and rest lengths are stored in contiguous arrays.
+void
+computeLinearSpringForces(double* const forces,
+                          const double* const X_node,
+                          const int* const petsc_mastr_node_idxs,
+                          const int* const petsc_slave_node_idxs,
+                          const double* const stiffnesses,
+                          const double* const rest_lengths,
+                          const int k_begin,
+                          const int k_end,
+                          const bool use_threads)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (use_threads)
+#endif
+    for (int k = k_begin; k < k_end; ++k)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int slave_idx = petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+        double D[NDIM], R = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            D[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+            R += D[d] * D[d];
+        }
+        R = std::sqrt(R);
+        const double T_over_R =
+            LIKELY(R >= std::numeric_limits<double>::epsilon()) ? stiffnesses[k] * (R - rest_lengths[k]) / R : 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            forces[NDIM * k + d] = T_over_R * D[d];
+        }
+    }
+    return;
+} // computeLinearSpringForces
+
+// Compute the forces of the springs k_begin through k_end-1 with a
+// user-provided force function.
+void
+computeSpringForces(double* const forces,
+                    const double* const X_node,
+                    const int* const petsc_mastr_node_idxs,
+                    const int* const petsc_slave_node_idxs,
+                    const int* const lag_mastr_node_idxs,
+                    const int* const lag_slave_node_idxs,
+                    const double* const* const parameters,
+                    const SpringForceFcnPtr force_fcn,
+                    const int k_begin,
+                    const int k_end,
+                    const bool use_threads)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (use_threads)
+#endif
+    for (int k = k_begin; k < k_end; ++k)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int slave_idx = petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+        double D[NDIM], R = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            D[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+            R += D[d] * D[d];
+        }
+        R = std::sqrt(R);
+        double T_over_R = 0.0;
+        if (LIKELY(R >= std::numeric_limits<double>::epsilon()))
+        {
+            T_over_R = force_fcn(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            forces[NDIM * k + d] = T_over_R * D[d];
+        }
+    }
+    return;
+} // computeSpringForces
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -131,6 +294,8 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("use_threaded_force_computation"))
+            d_use_threaded_force_computation = input_db->getBool("use_threaded_force_computation");
     }
     return;
 } // IBStandardForceGen
@@ -243,6 +408,19 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
         std::for_each(v_ptr->begin(), v_ptr->end(), [](int& i) { i *= NDIM; });
     }
 
+    // Setup the workspace and the accumulation order for the spring and beam
+    // forces.
+    SpringData& spring_data = d_spring_data[level_number];
+    spring_data.forces.resize(NDIM * spring_data.petsc_mastr_node_idxs.size());
+    buildForceGatherData(spring_data.gather,
+                         { { &spring_data.petsc_mastr_node_idxs, 1.0 }, { &spring_data.petsc_slave_node_idxs, -1.0 } });
+    BeamData& beam_data = d_beam_data[level_number];
+    beam_data.forces.resize(NDIM * beam_data.petsc_mastr_node_idxs.size());
+    buildForceGatherData(beam_data.gather,
+                         { { &beam_data.petsc_mastr_node_idxs, 2.0 },
+                           { &beam_data.petsc_next_node_idxs, -1.0 },
+                           { &beam_data.petsc_prev_node_idxs, -1.0 } });
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -277,14 +455,18 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
+
+    // The target point forces only require the positions of locally owned
+    // nodes, so they are computed while the ghost values are communicated.
+    computeLagrangianTargetPointForce(
+        F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
 
-    // Compute the forces.
+    // Compute the spring and beam forces.
     computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
     computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianTargetPointForce(
-        F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
 
     // Add the locally computed forces to the Lagrangian force vector.
     //
@@ -725,19 +907,41 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
     std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
     std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
+    std::vector<double>& stiffnesses = d_spring_data[level_number].stiffnesses;
+    std::vector<double>& rest_lengths = d_spring_data[level_number].rest_lengths;
+    std::vector<int>& batch_offsets = d_spring_data[level_number].batch_offsets;
+    std::vector<SpringForceFcnPtr>& batch_force_fcns = d_spring_data[level_number].batch_force_fcns;
 
     // The LMesh object provides the set of local Lagrangian nodes.
     const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_number);
     const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
     const int num_local_nodes = static_cast<int>(local_nodes.size());
 
-    // Determine how many springs are associated with the present MPI process.
+    // Determine how many springs are associated with the present MPI process,
+    // and how many of those use each force function.
     unsigned int total_num_springs = 0;
+    std::map<int, int> num_springs_per_fcn;
     for (const auto& node_idx : local_nodes)
     {
         const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
-        if (force_spec) total_num_springs += force_spec->getNumberOfSprings();
+        if (!force_spec) continue;
+        total_num_springs += force_spec->getNumberOfSprings();
+        for (const int fcn_idx : force_spec->getForceFunctionIndices()) ++num_springs_per_fcn[fcn_idx];
+    }
+
+    // Springs are stored in contiguous batches that share a force function.
+    std::map<int, int> current_spring_per_fcn;
+    batch_offsets.clear();
+    batch_force_fcns.clear();
+    int batch_offset = 0;
+    for (const auto& fcn_count : num_springs_per_fcn)
+    {
+        current_spring_per_fcn[fcn_count.first] = batch_offset;
+        batch_offsets.push_back(batch_offset);
+        batch_force_fcns.push_back(d_spring_force_fcn_map[fcn_count.first]);
+        batch_offset += fcn_count.second;
     }
+    batch_offsets.push_back(batch_offset);
 
     // Resize arrays for storing cached values used to compute spring forces.
     lag_mastr_node_idxs.resize(total_num_springs);
@@ -749,9 +953,10 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     force_fcns.resize(total_num_springs);
     force_deriv_fcns.resize(total_num_springs);
     parameters.resize(total_num_springs);
+    stiffnesses.resize(total_num_springs);
+    rest_lengths.resize(total_num_springs);
 
     // Setup the data structures used to compute spring forces.
-    int current_spring = 0;
     for (const auto& node_idx : local_nodes)
     {
         const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
@@ -773,13 +978,15 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
 #endif
         for (unsigned int k = 0; k < num_springs; ++k)
         {
+            const int current_spring = current_spring_per_fcn[fcn[k]]++;
             lag_mastr_node_idxs[current_spring] = lag_idx;
             lag_slave_node_idxs[current_spring] = slv[k];
             petsc_mastr_node_idxs[current_spring] = petsc_idx;
             force_fcns[current_spring] = d_spring_force_fcn_map[fcn[k]];
             force_deriv_fcns[current_spring] = d_spring_force_deriv_fcn_map[fcn[k]];
             parameters[current_spring] = params.empty() ? nullptr : &params[k][0];
-            ++current_spring;
+            stiffnesses[current_spring] = params.empty() || params[k].size() < 1 ? 0.0 : params[k][0];
+            rest_lengths[current_spring] = params.empty() || params[k].size() < 2 ? 0.0 : params[k][1];
         }
     }
 
@@ -815,111 +1022,56 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    const bool uses_springs = (num_springs > 0);
-    const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
-    const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
-    const int* const petsc_mastr_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_slave_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
-    const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
+    SpringData& spring_data = d_spring_data[level_number];
+    const int* const lag_mastr_node_idxs = spring_data.lag_mastr_node_idxs.data();
+    const int* const lag_slave_node_idxs = spring_data.lag_slave_node_idxs.data();
+    const int* const petsc_mastr_node_idxs = spring_data.petsc_mastr_node_idxs.data();
+    const int* const petsc_slave_node_idxs = spring_data.petsc_slave_node_idxs.data();
+    const double* const* const parameters = spring_data.parameters.data();
+    double* const forces = spring_data.forces.data();
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Compute the force of each spring, one batch of springs that share a
+    // force function at a time.  The kernel is selected once per batch: the
+    // default linear spring force is evaluated inline from the contiguous
+    // stiffness and rest length arrays.
+    const int num_batches = static_cast<int>(spring_data.batch_force_fcns.size());
+    for (int b = 0; b < num_batches; ++b)
     {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        const int k_begin = spring_data.batch_offsets[b];
+        const int k_end = spring_data.batch_offsets[b + 1];
+        const SpringForceFcnPtr force_fcn = spring_data.batch_force_fcns[b];
+        if (force_fcn == &default_spring_force)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-            F[2] = T_over_R * D[2];
-#endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
-#endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
-#endif
+            computeLinearSpringForces(forces,
+                                      X_node,
+                                      petsc_mastr_node_idxs,
+                                      petsc_slave_node_idxs,
+                                      spring_data.stiffnesses.data(),
+                                      spring_data.rest_lengths.data(),
+                                      k_begin,
+                                      k_end,
+                                      d_use_threaded_force_computation);
+        }
+        else
+        {
+            computeSpringForces(forces,
+                                X_node,
+                                petsc_mastr_node_idxs,
+                                petsc_slave_node_idxs,
+                                lag_mastr_node_idxs,
+                                lag_slave_node_idxs,
+                                parameters,
+                                force_fcn,
+                                k_begin,
+                                k_end,
+                                d_use_threaded_force_computation);
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-        F[2] = T_over_R * D[2];
-#endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
-#endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
-#endif
-    }
+
+    // Add the spring forces to the master and slave nodes.
+    accumulateForces(F_node, forces, spring_data.gather, d_use_threaded_force_computation);
 
     F_data->restoreArrays();
     X_data->restoreArrays();
@@ -1039,105 +1191,42 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                const double /*data_time*/,
                                                LDataManager* const /*l_data_manager*/)
 {
-    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
-    const bool uses_beams = (num_beams > 0);
-    const int* const petsc_mastr_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_next_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_next_node_idxs[0] : nullptr;
-    const int* const petsc_prev_node_idxs = uses_beams ? &d_beam_data[level_number].petsc_prev_node_idxs[0] : nullptr;
-    const double** const rigidities = uses_beams ? &d_beam_data[level_number].rigidities[0] : nullptr;
-    const Vector** const curvatures = uses_beams ? &d_beam_data[level_number].curvatures[0] : nullptr;
+    BeamData& beam_data = d_beam_data[level_number];
+    const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+    const int* const petsc_mastr_node_idxs = beam_data.petsc_mastr_node_idxs.data();
+    const int* const petsc_next_node_idxs = beam_data.petsc_next_node_idxs.data();
+    const int* const petsc_prev_node_idxs = beam_data.petsc_prev_node_idxs.data();
+    const double* const* const rigidities = beam_data.rigidities.data();
+    const Vector* const* const curvatures = beam_data.curvatures.data();
+    double* const forces = beam_data.forces.data();
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
-    double K;
-    const double* D2X0;
-    double F[NDIM];
-    kblock = 0;
-    for (; kblock < (num_beams - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
-    {
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(rigidities + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(curvatures + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
-        {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            next_idx = petsc_next_node_idxs[k];
-            prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != next_idx);
-            TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(rigidities[k + 1]);
-            PREFETCH_READ_NTA(curvatures[k + 1]);
-            K = *rigidities[k];
-            D2X0 = curvatures[k]->data();
-            F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-            F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-            F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
+    // Compute the force of each beam.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_force_computation)
 #endif
-            F_node[mastr_idx + 0] += 2.0 * F[0];
-            F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-            F_node[next_idx + 0] -= F[0];
-            F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[next_idx + 2] -= F[2];
-#endif
-            F_node[prev_idx + 0] -= F[0];
-            F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[prev_idx + 2] -= F[2];
-#endif
-        }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_beams; ++k)
+    for (int k = 0; k < num_beams; ++k)
     {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        next_idx = petsc_next_node_idxs[k];
-        prev_idx = petsc_prev_node_idxs[k];
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int next_idx = petsc_next_node_idxs[k];
+        const int prev_idx = petsc_prev_node_idxs[k];
 #if !defined(NDEBUG)
         TBOX_ASSERT(mastr_idx != next_idx);
         TBOX_ASSERT(mastr_idx != prev_idx);
 #endif
-        K = *rigidities[k];
-        D2X0 = curvatures[k]->data();
-        F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-        F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-        F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-        F_node[mastr_idx + 0] += 2.0 * F[0];
-        F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-        F_node[next_idx + 0] -= F[0];
-        F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[next_idx + 2] -= F[2];
-#endif
-        F_node[prev_idx + 0] -= F[0];
-        F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[prev_idx + 2] -= F[2];
-#endif
+        const double K = *rigidities[k];
+        const double* const D2X0 = curvatures[k]->data();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            forces[NDIM * k + d] =
+                K * (X_node[next_idx + d] + X_node[prev_idx + d] - 2.0 * X_node[mastr_idx + d] - D2X0[d]);
+        }
     }
 
+    // Add the beam forces to the master and neighbor nodes.
+    accumulateForces(F_node, forces, beam_data.gather, d_use_threaded_force_computation);
+
     F_data->restoreArrays();
     X_data->restoreArrays();
     return;
@@ -1207,80 +1296,39 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     double max_displacement = 0.0;
 
     const int num_target_points = static_cast<int>(d_target_point_data[level_number].petsc_node_idxs.size());
-    const bool uses_target_points = (num_target_points > 0);
-    const int* const petsc_node_idxs =
-        uses_target_points ? &d_target_point_data[level_number].petsc_node_idxs[0] : nullptr;
-    const double** const kappa = uses_target_points ? &d_target_point_data[level_number].kappa[0] : nullptr;
-    const double** const eta = uses_target_points ? &d_target_point_data[level_number].eta[0] : nullptr;
-    const Point** const X0 = uses_target_points ? &d_target_point_data[level_number].X0[0] : nullptr;
+    const int* const petsc_node_idxs = d_target_point_data[level_number].petsc_node_idxs.data();
+    const double* const* const kappa = d_target_point_data[level_number].kappa.data();
+    const double* const* const eta = d_target_point_data[level_number].eta.data();
+    const Point* const* const X0 = d_target_point_data[level_number].X0.data();
     double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getLocalFormVecArray()->data();
     const double* const U_node = U_data->getLocalFormVecArray()->data();
+    const bool log_target_point_displacements = d_log_target_point_displacements;
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, idx;
-    double K, E, dX;
-    const double* X_target;
-    kblock = 0;
-    for (; kblock < (num_target_points - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
-    {
-        PREFETCH_READ_NTA_BLOCK(petsc_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(kappa + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(eta + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(X0 + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
-        {
-            k = kblock * BLOCKSIZE + kunroll;
-            idx = petsc_node_idxs[k];
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(kappa[k + 1]);
-            PREFETCH_READ_NTA(eta[k + 1]);
-            PREFETCH_READ_NTA(X0[k + 1]);
-            K = *kappa[k];
-            E = *eta[k];
-            X_target = X0[k]->data();
-            F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-            F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-            F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
-            if (d_log_target_point_displacements)
-            {
-                dX = 0.0;
-                dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-                dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-                dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
+    // The ghost values of the positions may still be being updated, so the
+    // positions are only read.
+    int ierr;
+    const double* X_node;
+    ierr = VecGetArrayRead(X_data->getVec(), &X_node);
+    IBTK_CHKERRQ(ierr);
+
+    // Each target point is associated with a distinct node, so the forces can
+    // be added directly.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_displacement) if (d_use_threaded_force_computation)
 #endif
-                dX = std::sqrt(dX);
-                max_displacement = std::max(max_displacement, dX);
-            }
-        }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_target_points; ++k)
+    for (int k = 0; k < num_target_points; ++k)
     {
-        idx = petsc_node_idxs[k];
-        K = *kappa[k];
-        E = *eta[k];
-        X_target = X0[k]->data();
-        F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-        F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-        F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
-        if (d_log_target_point_displacements)
+        const int idx = petsc_node_idxs[k];
+        const double K = *kappa[k];
+        const double E = *eta[k];
+        const double* const X_target = X0[k]->data();
+        double dX = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            dX = 0.0;
-            dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-            dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-            dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
-#endif
-            dX = std::sqrt(dX);
-            max_displacement = std::max(max_displacement, dX);
+            F_node[idx + d] += K * (X_target[d] - X_node[idx + d]) - E * U_node[idx + d];
+            dX += (X_target[d] - X_node[idx + d]) * (X_target[d] - X_node[idx + d]);
         }
+        if (log_target_point_displacements) max_displacement = std::max(max_displacement, std::sqrt(dX));
     }
 
     if (d_log_target_point_displacements)
@@ -1290,8 +1338,9 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     }
 
     F_data->restoreArrays();
-    X_data->restoreArrays();
     U_data->restoreArrays();
+    ierr = VecRestoreArrayRead(X_data->getVec(), &X_node);
+    IBTK_CHKERRQ(ierr);
     return;
 } // computeLagrangianTargetPointForce
 
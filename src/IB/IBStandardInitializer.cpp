@@ -40,6 +40,10 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -50,6 +54,7 @@
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -87,6 +92,219 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Section types and record layouts of the binary structure file format.  See
+// the documentation of class IBStandardInitializer.
+enum BinaryStructureSectionType
+{
+    BINARY_VERTEX = 1,
+    BINARY_SPRING = 2,
+    BINARY_XSPRING = 3,
+    BINARY_BEAM = 4,
+    BINARY_ROD = 5,
+    BINARY_TARGET = 6,
+    BINARY_ANCHOR = 7
+};
+
+const char BINARY_STRUCTURE_MAGIC[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+const std::int32_t BINARY_STRUCTURE_VERSION = 1;
+
+struct BinaryStructureSection
+{
+    std::int32_t type;
+    std::int32_t num_params;
+    std::int64_t num_records;
+    std::int64_t offset;
+    std::int64_t record_size;
+};
+
+// Minimum size of a record of the given section, or zero if the section type
+// is unknown.
+std::int64_t
+min_binary_record_size(const BinaryStructureSection& section)
+{
+    switch (section.type)
+    {
+    case BINARY_VERTEX:
+        return NDIM * sizeof(double);
+    case BINARY_SPRING:
+    case BINARY_XSPRING:
+        return 4 * sizeof(std::int32_t) + static_cast<std::int64_t>(section.num_params) * sizeof(double);
+    case BINARY_BEAM:
+        return 4 * sizeof(std::int32_t) + (NDIM + 1) * sizeof(double);
+    case BINARY_ROD:
+        return 2 * sizeof(std::int32_t) + IBRodForceSpec::NUM_MATERIAL_PARAMS * sizeof(double);
+    case BINARY_TARGET:
+        return 2 * sizeof(std::int32_t) + 2 * sizeof(double);
+    case BINARY_ANCHOR:
+        return 2 * sizeof(std::int32_t);
+    default:
+        return 0;
+    }
+} // min_binary_record_size
+
+// Reads and validates the header and section table of a binary structure file.
+// The records of each section are then read with readRecords().  A section is
+// only accepted if its records are at least as large as the data that is read
+// from them and if all of its records lie within the file, so that reading a
+// record can never run past the end of the record or of the file.
+class BinaryStructureFile
+{
+public:
+    explicit BinaryStructureFile(const std::string& filename)
+        : d_filename(filename), d_file_stream(filename, std::ios::in | std::ios::binary)
+    {
+        if (!d_file_stream.is_open()) return;
+
+        d_file_stream.seekg(0, std::ios::end);
+        const std::int64_t file_size = d_file_stream.tellg();
+        d_file_stream.seekg(0, std::ios::beg);
+
+        char magic[8];
+        std::int32_t version, ndim, num_sections, reserved;
+        d_file_stream.read(magic, sizeof(magic));
+        d_file_stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+        d_file_stream.read(reinterpret_cast<char*>(&ndim), sizeof(ndim));
+        d_file_stream.read(reinterpret_cast<char*>(&num_sections), sizeof(num_sections));
+        d_file_stream.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+        std::ostringstream error;
+        if (!d_file_stream || !std::equal(magic, magic + 8, BINARY_STRUCTURE_MAGIC))
+        {
+            error << "File " << filename << " is not a binary structure file";
+            d_error_message = error.str();
+            return;
+        }
+        if (version != BINARY_STRUCTURE_VERSION)
+        {
+            error << "Unsupported binary structure file version " << version << " in file " << filename;
+            d_error_message = error.str();
+            return;
+        }
+        if (ndim != NDIM)
+        {
+            error << "Binary structure file " << filename << " contains " << ndim << "D data, but NDIM = " << NDIM;
+            d_error_message = error.str();
+            return;
+        }
+        for (int k = 0; k < num_sections; ++k)
+        {
+            BinaryStructureSection section;
+            d_file_stream.read(reinterpret_cast<char*>(&section.type), sizeof(section.type));
+            d_file_stream.read(reinterpret_cast<char*>(&section.num_params), sizeof(section.num_params));
+            d_file_stream.read(reinterpret_cast<char*>(&section.num_records), sizeof(section.num_records));
+            d_file_stream.read(reinterpret_cast<char*>(&section.offset), sizeof(section.offset));
+            d_file_stream.read(reinterpret_cast<char*>(&section.record_size), sizeof(section.record_size));
+            if (!d_file_stream)
+            {
+                error << "Premature end to binary structure file " << filename << " encountered in section table";
+                d_error_message = error.str();
+                return;
+            }
+            if (section.num_params < 0 || section.num_records < 0 || section.offset < 0 ||
+                section.record_size < std::max<std::int64_t>(min_binary_record_size(section), 1))
+            {
+                error << "Invalid record size " << section.record_size << " in section " << section.type
+                      << " of binary structure file " << filename;
+                d_error_message = error.str();
+                return;
+            }
+            if (section.offset > file_size ||
+                section.num_records > (file_size - section.offset) / section.record_size)
+            {
+                error << "Premature end to binary structure file " << filename << " encountered in section "
+                      << section.type;
+                d_error_message = error.str();
+                return;
+            }
+            d_sections[section.type] = section;
+        }
+    }
+
+    bool isOpen() const
+    {
+        return d_file_stream.is_open();
+    }
+
+    // Returns an empty string if the header and section table are valid, and a
+    // description of the first problem otherwise.
+    const std::string& getErrorMessage() const
+    {
+        return d_error_message;
+    }
+
+    const BinaryStructureSection* getSection(const int type) const
+    {
+        auto it = d_sections.find(type);
+        return it == d_sections.end() ? nullptr : &it->second;
+    }
+
+    // Read records [begin, end) of a section into buf.
+    void readRecords(const std::string& object_name,
+                     const BinaryStructureSection& section,
+                     const std::int64_t begin,
+                     const std::int64_t end,
+                     std::vector<char>& buf)
+    {
+        buf.resize((end - begin) * section.record_size);
+        d_file_stream.clear();
+        d_file_stream.seekg(section.offset + begin * section.record_size);
+        d_file_stream.read(buf.data(), buf.size());
+        if (!d_file_stream)
+        {
+            TBOX_ERROR(object_name << ":\n  Premature end to binary structure file " << d_filename
+                                   << " encountered in section " << section.type << std::endl);
+        }
+    }
+
+private:
+    std::string d_filename;
+    std::ifstream d_file_stream;
+    std::string d_error_message;
+    std::map<int, BinaryStructureSection> d_sections;
+};
+
+// Compute a 64-bit FNV-1a hash of the contents of a file.  Returns false if
+// the file cannot be opened.
+bool
+hash_file_contents(const std::string& filename, std::uint64_t& hash)
+{
+    std::ifstream is(filename, std::ios::in | std::ios::binary);
+    if (!is.is_open()) return false;
+    hash = 14695981039346656037ULL;
+    std::vector<char> buf(1 << 16);
+    while (is.read(buf.data(), buf.size()) || is.gcount() > 0)
+    {
+        const std::streamsize n = is.gcount();
+        for (std::streamsize i = 0; i < n; ++i)
+        {
+            hash ^= static_cast<unsigned char>(buf[i]);
+            hash *= 1099511628211ULL;
+        }
+    }
+    return true;
+} // hash_file_contents
+
+// Append the per-structure values of an input setting to a structure cache
+// key.
+template <typename T>
+void
+append_cache_key(std::ostream& key, const std::vector<std::vector<T> >& settings)
+{
+    for (const auto& level_settings : settings)
+    {
+        for (const auto& value : level_settings) key << value << " ";
+        key << "\n";
+    }
+} // append_cache_key
+
+template <typename T>
+inline T
+read_binary_value(const char* record, const std::size_t offset)
+{
+    T value;
+    std::memcpy(&value, record + offset, sizeof(T));
+    return value;
+} // read_binary_value
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -129,6 +347,14 @@ IBStandardInitializer::~IBStandardInitializer()
     return;
 } // ~IBStandardInitializer
 
+std::string
+IBStandardInitializer::checkBinaryStructureFile(const std::string& filename)
+{
+    BinaryStructureFile file(filename);
+    if (!file.isOpen()) return "Cannot open binary structure file " + filename;
+    return file.getErrorMessage();
+} // checkBinaryStructureFile
+
 void
 IBStandardInitializer::init()
 {
@@ -138,32 +364,50 @@ IBStandardInitializer::init()
     }
     else
     {
-        // Process the vertex information.
-        readVertexFiles(".vertex");
+        // Use the structure cache when it is present and was generated from
+        // the same input files and settings.
+        const bool use_cache = !d_structure_cache_filename.empty();
+        const std::string cache_key = use_cache ? getStructureCacheKey() : std::string();
+        if (!use_cache || !readStructureCache(d_structure_cache_filename, cache_key))
+        {
+            if (d_use_binary_structure_files)
+            {
+                // Process the vertex, spring, crosslink spring, beam, rod,
+                // target point, and anchor point information.
+                readBinaryStructureFiles(".ibstruct");
+            }
+            else
+            {
+                // Process the vertex information.
+                readVertexFiles(".vertex");
 
-        // Process the spring information.
-        readSpringFiles(".spring", /*input_uses_global_idxs*/ false);
+                // Process the spring information.
+                readSpringFiles(".spring", /*input_uses_global_idxs*/ false);
 
-        // Process the crosslink spring ("x-spring") information.
-        readXSpringFiles(".xspring", /*input_uses_global_idxs*/ true);
+                // Process the crosslink spring ("x-spring") information.
+                readXSpringFiles(".xspring", /*input_uses_global_idxs*/ true);
 
-        // Process the beam information.
-        readBeamFiles(".beam", /*input_uses_global_idxs*/ false);
+                // Process the beam information.
+                readBeamFiles(".beam", /*input_uses_global_idxs*/ false);
 
-        // Process the rod information.
-        readRodFiles(".rod", /*input_uses_global_idxs*/ false);
+                // Process the rod information.
+                readRodFiles(".rod", /*input_uses_global_idxs*/ false);
 
-        // Process the target point information.
-        readTargetPointFiles(".target");
+                // Process the target point information.
+                readTargetPointFiles(".target");
 
-        // Process the anchor point information.
-        readAnchorPointFiles(".anchor");
+                // Process the anchor point information.
+                readAnchorPointFiles(".anchor");
+            }
 
-        // Process the mass information.
-        readBoundaryMassFiles(".mass");
+            // Process the mass information.
+            readBoundaryMassFiles(".mass");
 
-        // Process the directors information.
-        readDirectorFiles(".director");
+            // Process the directors information.
+            readDirectorFiles(".director");
+
+            if (use_cache) writeStructureCache(d_structure_cache_filename, cache_key);
+        }
 
         // Process the instrumentation information.
         readInstrumentationFiles(".inst");
@@ -182,6 +426,99 @@ IBStandardInitializer::init()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+std::string
+IBStandardInitializer::getStructureCacheKey() const
+{
+    // The key records a hash of the contents of every input file that
+    // contributes to the cached data, along with all input settings that are
+    // applied while reading those files.
+    std::ostringstream key;
+    key.precision(std::numeric_limits<double>::max_digits10);
+    key << d_structure_cache_key << "\n"
+        << d_use_binary_structure_files << " " << d_length_scale_factor << " " << d_posn_shift.transpose() << "\n";
+
+    // Only the root process reads the input files to hash them.  The result is
+    // broadcast so that every process computes the same key.
+    std::string file_hashes;
+    if (IBTK_MPI::getRank() == 0)
+    {
+        const std::vector<std::string> extensions =
+            d_use_binary_structure_files ?
+                std::vector<std::string>{ ".ibstruct", ".mass", ".director" } :
+                std::vector<std::string>{ ".vertex", ".spring", ".xspring", ".beam", ".rod",
+                                          ".target", ".anchor", ".mass", ".director" };
+        std::ostringstream os;
+        os << std::hex;
+        for (int ln = 0; ln < d_max_levels; ++ln)
+        {
+            for (const auto& base_filename : d_base_filename[ln])
+            {
+                for (const auto& extension : extensions)
+                {
+                    const std::string filename = base_filename + extension;
+                    std::uint64_t hash = 0;
+                    os << filename << " ";
+                    if (hash_file_contents(filename, hash))
+                        os << hash << "\n";
+                    else
+                        os << "missing\n";
+                }
+            }
+        }
+        file_hashes = os.str();
+    }
+    int num_chars = IBTK_MPI::bcast(static_cast<int>(file_hashes.size()), 0);
+    file_hashes.resize(num_chars);
+    if (num_chars > 0) IBTK_MPI::bcast(&file_hashes[0], num_chars, 0);
+    key << file_hashes;
+
+    append_cache_key(key, d_enable_springs);
+    append_cache_key(key, d_using_uniform_spring_stiffness);
+    append_cache_key(key, d_uniform_spring_stiffness);
+    append_cache_key(key, d_using_uniform_spring_rest_length);
+    append_cache_key(key, d_uniform_spring_rest_length);
+    append_cache_key(key, d_using_uniform_spring_force_fcn_idx);
+    append_cache_key(key, d_uniform_spring_force_fcn_idx);
+    append_cache_key(key, d_enable_xsprings);
+    append_cache_key(key, d_using_uniform_xspring_stiffness);
+    append_cache_key(key, d_uniform_xspring_stiffness);
+    append_cache_key(key, d_using_uniform_xspring_rest_length);
+    append_cache_key(key, d_uniform_xspring_rest_length);
+    append_cache_key(key, d_using_uniform_xspring_force_fcn_idx);
+    append_cache_key(key, d_uniform_xspring_force_fcn_idx);
+    append_cache_key(key, d_enable_beams);
+    append_cache_key(key, d_using_uniform_beam_bend_rigidity);
+    append_cache_key(key, d_uniform_beam_bend_rigidity);
+    append_cache_key(key, d_using_uniform_beam_curvature);
+    for (const auto& level_curvatures : d_uniform_beam_curvature)
+    {
+        for (const auto& curvature : level_curvatures) key << curvature.transpose() << " ";
+        key << "\n";
+    }
+    append_cache_key(key, d_enable_rods);
+    append_cache_key(key, d_using_uniform_rod_properties);
+    for (const auto& level_properties : d_uniform_rod_properties)
+    {
+        for (const auto& properties : level_properties)
+        {
+            for (const double p : properties) key << p << " ";
+        }
+        key << "\n";
+    }
+    append_cache_key(key, d_enable_target_points);
+    append_cache_key(key, d_using_uniform_target_stiffness);
+    append_cache_key(key, d_uniform_target_stiffness);
+    append_cache_key(key, d_using_uniform_target_damping);
+    append_cache_key(key, d_uniform_target_damping);
+    append_cache_key(key, d_enable_anchor_points);
+    append_cache_key(key, d_enable_bdry_mass);
+    append_cache_key(key, d_using_uniform_bdry_mass);
+    append_cache_key(key, d_uniform_bdry_mass);
+    append_cache_key(key, d_using_uniform_bdry_mass_stiffness);
+    append_cache_key(key, d_uniform_bdry_mass_stiffness);
+    return key.str();
+} // getStructureCacheKey
+
 void
 IBStandardInitializer::readVertexFiles(const std::string& extension)
 {
@@ -437,72 +774,7 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         }
                     }
 
-                    // Modify kappa and length according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_spring_stiffness[ln][j])
-                    {
-                        parameters[0] = d_uniform_spring_stiffness[ln][j];
-                    }
-                    if (d_using_uniform_spring_rest_length[ln][j])
-                    {
-                        parameters[1] = d_uniform_spring_rest_length[ln][j];
-                    }
-                    if (d_using_uniform_spring_force_fcn_idx[ln][j])
-                    {
-                        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
-                    }
-
-                    // Check to see if the spring constant is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_springs[ln][j] &&
-                        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
-                                                   << spring_filename << "." << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the edge numbers to be in the global Lagrangian indexing
-                    // scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        e.first += d_vertex_offset[ln][j];
-                        e.second += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present edge.
-                    //
-                    // Note that in the edge map, each edge is associated with only the
-                    // first vertex.
-                    if (e.first > e.second)
-                    {
-                        std::swap<int>(e.first, e.second);
-                    }
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_spring_edge_map[ln][j].equal_range(e.first);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate spring connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << spring_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        SpringSpec spec_data;
-                        spec_data.parameters = parameters;
-                        spec_data.force_fcn_idx = force_fcn_idx;
-                        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
-                    }
+                    addSpring(ln, j, e, parameters, force_fcn_idx, input_uses_global_idxs, spring_filename, warned);
                 }
 
                 // Close the input file.
@@ -671,73 +943,7 @@ IBStandardInitializer::readXSpringFiles(const std::string& extension, const bool
                         }
                     }
 
-                    // Modify kappa and length according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_xspring_stiffness[ln][j])
-                    {
-                        parameters[0] = d_uniform_xspring_stiffness[ln][j];
-                    }
-                    if (d_using_uniform_xspring_rest_length[ln][j])
-                    {
-                        parameters[1] = d_uniform_xspring_rest_length[ln][j];
-                    }
-                    if (d_using_uniform_xspring_force_fcn_idx[ln][j])
-                    {
-                        force_fcn_idx = d_uniform_xspring_force_fcn_idx[ln][j];
-                    }
-
-                    // Check to see if the spring constant is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_xsprings[ln][j] &&
-                        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Crosslink spring with zero spring "
-                                                      "constant encountered in ASCII input file "
-                                                      "named "
-                                                   << xspring_filename << "." << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the edge numbers to be in the global Lagrangian indexing
-                    // scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        e.first += d_vertex_offset[ln][j];
-                        e.second += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present edge.
-                    //
-                    // Note that in the edge map, each edge is associated with only the
-                    // first vertex.
-                    if (e.first > e.second)
-                    {
-                        std::swap<int>(e.first, e.second);
-                    }
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_xspring_edge_map[ln][j].equal_range(e.first);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate xspring connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << xspring_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_xspring_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        XSpringSpec spec_data;
-                        spec_data.parameters = parameters;
-                        spec_data.force_fcn_idx = force_fcn_idx;
-                        d_xspring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
-                    }
+                    addXSpring(ln, j, e, parameters, force_fcn_idx, input_uses_global_idxs, xspring_filename, warned);
                 }
 
                 // Close the input file.
@@ -916,67 +1122,7 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                         }
                     }
 
-                    // Modify bend and curvature according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_beam_bend_rigidity[ln][j])
-                    {
-                        bend = d_uniform_beam_bend_rigidity[ln][j];
-                    }
-                    if (d_using_uniform_beam_curvature[ln][j])
-                    {
-                        curv = d_uniform_beam_curvature[ln][j];
-                    }
-
-                    // Check to see if the bending rigidity is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
-                                                      "encountered in ASCII input file named "
-                                                   << beam_filename << "." << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the node numbers to be in the global Lagrangian
-                    // indexing scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        prev_idx += d_vertex_offset[ln][j];
-                        curr_idx += d_vertex_offset[ln][j];
-                        next_idx += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present
-                    // beam.
-                    //
-                    // Note that in the beam property map, each edge is
-                    // associated with only the "current" vertex.
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
-                        d_beam_spec_data[ln][j].equal_range(curr_idx);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        const BeamSpec& spec_data = it->second;
-                        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate beam connection between nodes "
-                                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
-                                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
-                                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << beam_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        BeamSpec spec_data;
-                        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
-                        spec_data.bend_rigidity = bend;
-                        spec_data.curvature = curv;
-                        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
-                    }
+                    addBeam(ln, j, prev_idx, curr_idx, next_idx, bend, curv, input_uses_global_idxs, beam_filename, warned);
                 }
 
                 // Close the input file.
@@ -1249,51 +1395,7 @@ IBStandardInitializer::readRodFiles(const std::string& extension, const bool inp
                         }
                     }
 
-                    // Modify properties according to whether uniform values are
-                    // to be employed for this particular structure.
-                    if (d_using_uniform_rod_properties[ln][j])
-                    {
-                        properties = d_uniform_rod_properties[ln][j];
-                    }
-
-                    // Correct the node numbers to be in the global Lagrangian
-                    // indexing scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        curr_idx += d_vertex_offset[ln][j];
-                        next_idx += d_vertex_offset[ln][j];
-                    }
-                    Edge e;
-                    e.first = curr_idx;
-                    e.second = next_idx;
-
-                    // Initialize the map data corresponding to the present rod.
-                    //
-                    // Note that in the rod property map, each edge is
-                    // associated with only the "current" vertex.
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_rod_edge_map[ln][j].equal_range(curr_idx);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate rod connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << rod_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_rod_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        RodSpec rod_spec;
-                        rod_spec.properties = properties;
-                        d_rod_spec_data[ln][j].insert(std::make_pair(e, rod_spec));
-                    }
+                    addRod(ln, j, curr_idx, next_idx, properties, input_uses_global_idxs, rod_filename);
                 }
 
                 // Close the input file.
@@ -1482,31 +1584,7 @@ IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             // Modify the target point stiffness constants according to whether
             // target point penalty forces are enabled, or whether uniform
             // values are to be employed, for this particular structure.
-            if (!d_enable_target_points[ln][j])
-            {
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                {
-                    d_target_spec_data[ln][j][k].stiffness = 0.0;
-                    d_target_spec_data[ln][j][k].damping = 0.0;
-                }
-            }
-            else
-            {
-                if (d_using_uniform_target_stiffness[ln][j])
-                {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                    {
-                        d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
-                    }
-                }
-                if (d_using_uniform_target_damping[ln][j])
-                {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                    {
-                        d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
-                    }
-                }
-            }
+            applyUniformTargetPointData(ln, j);
 
             // Free the next MPI process to start reading the current file.
             if (d_use_file_batons && rank != nodes - 1) IBTK_MPI::send(&flag, sz, rank + 1, false, j);
@@ -2394,6 +2472,610 @@ IBStandardInitializer::readSourceFiles(const std::string& extension)
     return;
 } // readSourceFiles
 
+void
+IBStandardInitializer::readBinaryStructureFiles(const std::string& extension)
+{
+    // Records are read in fixed-size chunks so that the transient buffer does
+    // not scale with the size of the structure.
+    static const std::int64_t CHUNK_SIZE = 1 << 16;
+    std::vector<char> buf;
+    // The record sizes of all sections were validated against the record
+    // layouts and the file size when the file was opened.
+    auto for_each_record = [&](BinaryStructureFile& file,
+                               const BinaryStructureSection& section,
+                               const std::function<void(const char*, int)>& fcn) {
+        for (std::int64_t begin = 0; begin < section.num_records; begin += CHUNK_SIZE)
+        {
+            const std::int64_t end = std::min(begin + CHUNK_SIZE, section.num_records);
+            file.readRecords(d_object_name, section, begin, end, buf);
+            for (std::int64_t k = begin; k < end; ++k)
+            {
+                fcn(buf.data() + (k - begin) * section.record_size, static_cast<int>(k));
+            }
+        }
+    };
+    auto check_idx = [&](const int idx, const int max_idx, const int k, const std::string& filename) {
+        if (idx < 0 || idx >= max_idx)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in record " << k << " of binary structure file "
+                                     << filename << std::endl
+                                     << "  vertex index " << idx << " is out of range" << std::endl);
+        }
+    };
+    auto check_nonnegative = [&](const double val, const int k, const std::string& filename, const std::string& name) {
+        if (val < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in record " << k << " of binary structure file "
+                                     << filename << std::endl
+                                     << "  " << name << " is negative" << std::endl);
+        }
+    };
+
+    // Read the vertices of all structures first, since crosslink springs
+    // refer to the vertices of all structures on a level.
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+        d_num_vertex[ln].resize(num_base_filename, 0);
+        d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
+        d_vertex_posn[ln].resize(num_base_filename);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            d_vertex_offset[ln][j] = (j == 0 ? 0 : d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1]);
+
+            const std::string filename = d_base_filename[ln][j] + extension;
+            BinaryStructureFile file(filename);
+            if (!file.isOpen())
+            {
+                TBOX_ERROR(d_object_name << ":\n  Cannot find required binary structure file: " << filename
+                                         << std::endl);
+            }
+            if (!file.getErrorMessage().empty())
+            {
+                TBOX_ERROR(d_object_name << ":\n  " << file.getErrorMessage() << std::endl);
+            }
+            const BinaryStructureSection* section = file.getSection(BINARY_VERTEX);
+            if (!section || section->num_records <= 0 || section->num_records > std::numeric_limits<int>::max())
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid vertex section in binary structure file " << filename
+                                         << std::endl);
+            }
+            d_num_vertex[ln][j] = static_cast<int>(section->num_records);
+            d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+            for_each_record(file, *section, [&](const char* record, const int k) {
+                Point& X = d_vertex_posn[ln][j][k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = d_length_scale_factor * (read_binary_value<double>(record, d * sizeof(double)) +
+                                                    d_posn_shift[d]);
+                }
+            });
+
+            plog << d_object_name << ":  "
+                 << "read " << d_num_vertex[ln][j] << " vertices from binary structure file named " << filename
+                 << std::endl
+                 << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+        }
+    }
+
+    // Read the remaining sections.
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+        d_spring_edge_map[ln].resize(num_base_filename);
+        d_spring_spec_data[ln].resize(num_base_filename);
+        d_xspring_edge_map[ln].resize(num_base_filename);
+        d_xspring_spec_data[ln].resize(num_base_filename);
+        d_beam_spec_data[ln].resize(num_base_filename);
+        d_rod_edge_map[ln].resize(num_base_filename);
+        d_rod_spec_data[ln].resize(num_base_filename);
+        d_target_spec_data[ln].resize(num_base_filename);
+        d_anchor_spec_data[ln].resize(num_base_filename);
+        const int num_level_vertex = std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            const std::string filename = d_base_filename[ln][j] + extension;
+            BinaryStructureFile file(filename);
+            const int num_vertex = d_num_vertex[ln][j];
+
+            // Springs and crosslink springs: int32 idx0, idx1, force_fcn_idx,
+            // num_params; double params[num_params].
+            const BinaryStructureSection* section = file.getSection(BINARY_SPRING);
+            if (section)
+            {
+                bool warned = false;
+                for_each_record(file, *section, [&](const char* record, const int k) {
+                    Edge e(read_binary_value<std::int32_t>(record, 0), read_binary_value<std::int32_t>(record, 4));
+                    const int force_fcn_idx = read_binary_value<std::int32_t>(record, 8);
+                    const int num_params = read_binary_value<std::int32_t>(record, 12);
+                    if (num_params < 2 || num_params > section->num_params)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid number of spring parameters in record " << k
+                                                 << " of binary structure file " << filename << std::endl);
+                    }
+                    check_idx(e.first, num_vertex, k, filename);
+                    check_idx(e.second, num_vertex, k, filename);
+                    std::vector<double> parameters(num_params);
+                    for (int p = 0; p < num_params; ++p)
+                    {
+                        parameters[p] = read_binary_value<double>(record, 16 + p * sizeof(double));
+                    }
+                    check_nonnegative(parameters[0], k, filename, "spring constant");
+                    check_nonnegative(parameters[1], k, filename, "spring resting length");
+                    parameters[1] *= d_length_scale_factor;
+                    addSpring(ln, j, e, parameters, force_fcn_idx, /*input_uses_global_idxs*/ false, filename, warned);
+                });
+            }
+            section = file.getSection(BINARY_XSPRING);
+            if (section)
+            {
+                bool warned = false;
+                for_each_record(file, *section, [&](const char* record, const int k) {
+                    Edge e(read_binary_value<std::int32_t>(record, 0), read_binary_value<std::int32_t>(record, 4));
+                    const int force_fcn_idx = read_binary_value<std::int32_t>(record, 8);
+                    const int num_params = read_binary_value<std::int32_t>(record, 12);
+                    if (num_params < 2 || num_params > section->num_params)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid number of spring parameters in record " << k
+                                                 << " of binary structure file " << filename << std::endl);
+                    }
+                    check_idx(e.first, num_level_vertex, k, filename);
+                    check_idx(e.second, num_level_vertex, k, filename);
+                    std::vector<double> parameters(num_params);
+                    for (int p = 0; p < num_params; ++p)
+                    {
+                        parameters[p] = read_binary_value<double>(record, 16 + p * sizeof(double));
+                    }
+                    check_nonnegative(parameters[0], k, filename, "spring constant");
+                    check_nonnegative(parameters[1], k, filename, "spring resting length");
+                    parameters[1] *= d_length_scale_factor;
+                    addXSpring(ln, j, e, parameters, force_fcn_idx, /*input_uses_global_idxs*/ true, filename, warned);
+                });
+            }
+
+            // Beams: int32 prev_idx, curr_idx, next_idx, has_curvature; double
+            // bend_rigidity, curvature[NDIM].
+            section = file.getSection(BINARY_BEAM);
+            if (section)
+            {
+                bool warned = false;
+                for_each_record(file, *section, [&](const char* record, const int k) {
+                    const int prev_idx = read_binary_value<std::int32_t>(record, 0);
+                    const int curr_idx = read_binary_value<std::int32_t>(record, 4);
+                    const int next_idx = read_binary_value<std::int32_t>(record, 8);
+                    const bool has_curvature = read_binary_value<std::int32_t>(record, 12) != 0;
+                    check_idx(prev_idx, num_vertex, k, filename);
+                    check_idx(curr_idx, num_vertex, k, filename);
+                    check_idx(next_idx, num_vertex, k, filename);
+                    const double bend = read_binary_value<double>(record, 16);
+                    check_nonnegative(bend, k, filename, "beam constant");
+                    Vector curv(Vector::Zero());
+                    for (unsigned int d = 0; d < NDIM && has_curvature; ++d)
+                    {
+                        curv[d] = read_binary_value<double>(record, 24 + d * sizeof(double));
+                    }
+                    addBeam(ln,
+                            j,
+                            prev_idx,
+                            curr_idx,
+                            next_idx,
+                            bend,
+                            curv,
+                            /*input_uses_global_idxs*/ false,
+                            filename,
+                            warned);
+                });
+            }
+
+            // Rods: int32 curr_idx, next_idx; double properties[10].
+            section = file.getSection(BINARY_ROD);
+            if (section)
+            {
+                for_each_record(file, *section, [&](const char* record, const int k) {
+                    const int curr_idx = read_binary_value<std::int32_t>(record, 0);
+                    const int next_idx = read_binary_value<std::int32_t>(record, 4);
+                    check_idx(curr_idx, num_vertex, k, filename);
+                    check_idx(next_idx, num_vertex, k, filename);
+                    std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> properties;
+                    for (int p = 0; p < IBRodForceSpec::NUM_MATERIAL_PARAMS; ++p)
+                    {
+                        properties[p] = read_binary_value<double>(record, 8 + p * sizeof(double));
+                        if (p < 7) check_nonnegative(properties[p], k, filename, "rod property");
+                    }
+                    addRod(ln, j, curr_idx, next_idx, properties, /*input_uses_global_idxs*/ false, filename);
+                });
+            }
+
+            // Target points: int32 idx, unused; double stiffness, damping.
+            TargetSpec default_target_spec;
+            default_target_spec.stiffness = 0.0;
+            default_target_spec.damping = 0.0;
+            d_target_spec_data[ln][j].resize(num_vertex, default_target_spec);
+            section = file.getSection(BINARY_TARGET);
+            if (section)
+            {
+                bool warned = false;
+                std::set<int> target_point_idxs;
+                for_each_record(file, *section, [&](const char* record, const int k) {
+                    const int n = read_binary_value<std::int32_t>(record, 0);
+                    check_idx(n, num_vertex, k, filename);
+                    if (!target_point_idxs.insert(n).second)
+                    {
+                        TBOX_WARNING(d_object_name << ":\n  Duplicate target point node " << n
+                                                   << " encountered in binary structure file named " << filename
+                                                   << ".\n"
+                                                   << "  Skipping duplicated point." << std::endl);
+                        return;
+                    }
+                    TargetSpec& spec = d_target_spec_data[ln][j][n];
+                    spec.stiffness = read_binary_value<double>(record, 8);
+                    spec.damping = read_binary_value<double>(record, 16);
+                    check_nonnegative(spec.stiffness, k, filename, "target point spring constant");
+                    check_nonnegative(spec.damping, k, filename, "target point damping coefficient");
+                    if (!warned && d_enable_target_points[ln][j] &&
+                        (spec.stiffness == 0.0 || MathUtilities<double>::equalEps(spec.stiffness, 0.0)))
+                    {
+                        TBOX_WARNING(d_object_name << ":\n  Target point with zero penalty spring "
+                                                      "constant encountered in binary structure file named "
+                                                   << filename << "." << std::endl);
+                        warned = true;
+                    }
+                });
+            }
+            applyUniformTargetPointData(ln, j);
+
+            // Anchor points: int32 idx, unused.
+            AnchorSpec default_anchor_spec;
+            default_anchor_spec.is_anchor_point = false;
+            d_anchor_spec_data[ln][j].resize(num_vertex, default_anchor_spec);
+            section = file.getSection(BINARY_ANCHOR);
+            if (section)
+            {
+                for_each_record(file, *section, [&](const char* record, const int k) {
+                    const int n = read_binary_value<std::int32_t>(record, 0);
+                    check_idx(n, num_vertex, k, filename);
+                    if (d_anchor_spec_data[ln][j][n].is_anchor_point)
+                    {
+                        TBOX_WARNING(d_object_name << ":\n  Duplicate anchor point node " << n
+                                                   << " encountered in binary structure file named " << filename
+                                                   << ".\n"
+                                                   << "  Skipping duplicated point." << std::endl);
+                    }
+                    d_anchor_spec_data[ln][j][n].is_anchor_point = true;
+                });
+            }
+
+            plog << d_object_name << ":  "
+                 << "read connectivity data from binary structure file named " << filename << std::endl
+                 << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+        }
+    }
+    return;
+} // readBinaryStructureFiles
+
+void
+IBStandardInitializer::addSpring(const int ln,
+                                 const unsigned int j,
+                                 Edge e,
+                                 std::vector<double> parameters,
+                                 int force_fcn_idx,
+                                 const bool input_uses_global_idxs,
+                                 const std::string& spring_filename,
+                                 bool& warned)
+{
+    // Modify kappa and length according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_spring_stiffness[ln][j])
+    {
+        parameters[0] = d_uniform_spring_stiffness[ln][j];
+    }
+    if (d_using_uniform_spring_rest_length[ln][j])
+    {
+        parameters[1] = d_uniform_spring_rest_length[ln][j];
+    }
+    if (d_using_uniform_spring_force_fcn_idx[ln][j])
+    {
+        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+    }
+
+    // Check to see if the spring constant is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_springs[ln][j] &&
+        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
+                                      "encountered in input file named "
+                                   << spring_filename << "." << std::endl);
+        warned = true;
+    }
+
+    // Correct the edge numbers to be in the global Lagrangian indexing
+    // scheme.
+    if (!input_uses_global_idxs)
+    {
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present edge.
+    //
+    // Note that in the edge map, each edge is associated with only the
+    // first vertex.
+    if (e.first > e.second)
+    {
+        std::swap<int>(e.first, e.second);
+    }
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_spring_edge_map[ln][j].equal_range(e.first);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate spring connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << spring_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        SpringSpec spec_data;
+        spec_data.parameters = parameters;
+        spec_data.force_fcn_idx = force_fcn_idx;
+        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // addSpring
+
+void
+IBStandardInitializer::addXSpring(const int ln,
+                                  const unsigned int j,
+                                  Edge e,
+                                  std::vector<double> parameters,
+                                  int force_fcn_idx,
+                                  const bool input_uses_global_idxs,
+                                  const std::string& xspring_filename,
+                                  bool& warned)
+{
+    // Modify kappa and length according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_xspring_stiffness[ln][j])
+    {
+        parameters[0] = d_uniform_xspring_stiffness[ln][j];
+    }
+    if (d_using_uniform_xspring_rest_length[ln][j])
+    {
+        parameters[1] = d_uniform_xspring_rest_length[ln][j];
+    }
+    if (d_using_uniform_xspring_force_fcn_idx[ln][j])
+    {
+        force_fcn_idx = d_uniform_xspring_force_fcn_idx[ln][j];
+    }
+
+    // Check to see if the spring constant is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_xsprings[ln][j] &&
+        (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Crosslink spring with zero spring "
+                                      "constant encountered in input file "
+                                      "named "
+                                   << xspring_filename << "." << std::endl);
+        warned = true;
+    }
+
+    // Correct the edge numbers to be in the global Lagrangian indexing
+    // scheme.
+    if (!input_uses_global_idxs)
+    {
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present edge.
+    //
+    // Note that in the edge map, each edge is associated with only the
+    // first vertex.
+    if (e.first > e.second)
+    {
+        std::swap<int>(e.first, e.second);
+    }
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_xspring_edge_map[ln][j].equal_range(e.first);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate xspring connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << xspring_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        d_xspring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        XSpringSpec spec_data;
+        spec_data.parameters = parameters;
+        spec_data.force_fcn_idx = force_fcn_idx;
+        d_xspring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // addXSpring
+
+void
+IBStandardInitializer::addBeam(const int ln,
+                               const unsigned int j,
+                               int prev_idx,
+                               int curr_idx,
+                               int next_idx,
+                               double bend,
+                               Vector curv,
+                               const bool input_uses_global_idxs,
+                               const std::string& beam_filename,
+                               bool& warned)
+{
+    // Modify bend and curvature according to whether uniform
+    // values are to be employed for this particular structure.
+    if (d_using_uniform_beam_bend_rigidity[ln][j])
+    {
+        bend = d_uniform_beam_bend_rigidity[ln][j];
+    }
+    if (d_using_uniform_beam_curvature[ln][j])
+    {
+        curv = d_uniform_beam_curvature[ln][j];
+    }
+
+    // Check to see if the bending rigidity is zero and, if so,
+    // emit a warning.
+    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
+                                      "encountered in input file named "
+                                   << beam_filename << "." << std::endl);
+        warned = true;
+    }
+
+    // Correct the node numbers to be in the global Lagrangian
+    // indexing scheme.
+    if (!input_uses_global_idxs)
+    {
+        prev_idx += d_vertex_offset[ln][j];
+        curr_idx += d_vertex_offset[ln][j];
+        next_idx += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present
+    // beam.
+    //
+    // Note that in the beam property map, each edge is
+    // associated with only the "current" vertex.
+    bool found_connection = false;
+    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
+        d_beam_spec_data[ln][j].equal_range(curr_idx);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const BeamSpec& spec_data = it->second;
+        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate beam connection between nodes "
+                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
+                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
+                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << beam_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        BeamSpec spec_data;
+        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
+        spec_data.bend_rigidity = bend;
+        spec_data.curvature = curv;
+        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
+    }
+    return;
+} // addBeam
+
+void
+IBStandardInitializer::addRod(const int ln,
+                              const unsigned int j,
+                              int curr_idx,
+                              int next_idx,
+                              std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> properties,
+                              const bool input_uses_global_idxs,
+                              const std::string& rod_filename)
+{
+    // Modify properties according to whether uniform values are
+    // to be employed for this particular structure.
+    if (d_using_uniform_rod_properties[ln][j])
+    {
+        properties = d_uniform_rod_properties[ln][j];
+    }
+
+    // Correct the node numbers to be in the global Lagrangian
+    // indexing scheme.
+    if (!input_uses_global_idxs)
+    {
+        curr_idx += d_vertex_offset[ln][j];
+        next_idx += d_vertex_offset[ln][j];
+    }
+    Edge e;
+    e.first = curr_idx;
+    e.second = next_idx;
+
+    // Initialize the map data corresponding to the present rod.
+    //
+    // Note that in the rod property map, each edge is
+    // associated with only the "current" vertex.
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_rod_edge_map[ln][j].equal_range(curr_idx);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate rod connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << rod_filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        d_rod_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        RodSpec rod_spec;
+        rod_spec.properties = properties;
+        d_rod_spec_data[ln][j].insert(std::make_pair(e, rod_spec));
+    }
+    return;
+} // addRod
+
+void
+IBStandardInitializer::applyUniformTargetPointData(const int ln, const unsigned int j)
+{
+    if (!d_enable_target_points[ln][j])
+    {
+        for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+        {
+            d_target_spec_data[ln][j][k].stiffness = 0.0;
+            d_target_spec_data[ln][j][k].damping = 0.0;
+        }
+    }
+    else
+    {
+        if (d_using_uniform_target_stiffness[ln][j])
+        {
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
+            }
+        }
+        if (d_using_uniform_target_damping[ln][j])
+        {
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
+            }
+        }
+    }
+    return;
+} // applyUniformTargetPointData
+
 std::vector<Pointer<Streamable> >
 IBStandardInitializer::initializeNodeData(const std::pair<int, int>& point_index,
                                           const unsigned int global_index_offset,
@@ -2580,6 +3262,10 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to read structure data from binary structure files.
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
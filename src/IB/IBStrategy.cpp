@@ -22,6 +22,7 @@
 #include "ibtk/HierarchyMathOps.h"
 
 #include "BasePatchLevel.h"
+#include "BoxList.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenPatchStrategy.h"
 #include "GriddingAlgorithm.h"
@@ -168,6 +169,12 @@ IBStrategy::updateFixedLEOperators()
     return;
 } // updateFixedLEOperators
 
+bool
+IBStrategy::computeInterpolationRegionBoxes(BoxList<NDIM>& /*region_boxes*/, int /*level_number*/)
+{
+    return false;
+} // computeInterpolationRegionBoxes
+
 void
 IBStrategy::backwardEulerStep(double /*current_time*/, double /*new_time*/)
 {
@@ -175,6 +182,20 @@ IBStrategy::backwardEulerStep(double /*current_time*/, double /*new_time*/)
     return;
 } // backwardEulerStep
 
+void
+IBStrategy::interpolateVelocityAndSpreadForce(const int u_data_idx,
+                                              const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds,
+                                              const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
+                                              const int f_data_idx,
+                                              RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                              const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
+                                              const double data_time)
+{
+    interpolateVelocity(u_data_idx, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
+    return;
+} // interpolateVelocityAndSpreadForce
+
 bool
 IBStrategy::hasFluidSources() const
 {
@@ -20,6 +20,7 @@
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "BoxList.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -157,6 +158,21 @@ IBStrategySet::interpolateVelocity(int u_data_idx,
     return;
 } // interpolateVelocity
 
+bool
+IBStrategySet::computeInterpolationRegionBoxes(BoxList<NDIM>& region_boxes, const int level_number)
+{
+    region_boxes.clearItems();
+    bool restrict_region = true;
+    for (const auto& strategy : d_strategy_set)
+    {
+        BoxList<NDIM> strategy_region_boxes;
+        restrict_region =
+            strategy->computeInterpolationRegionBoxes(strategy_region_boxes, level_number) && restrict_region;
+        region_boxes.catenateItems(strategy_region_boxes);
+    }
+    return restrict_region;
+} // computeInterpolationRegionBoxes
+
 void
 IBStrategySet::IBStrategySet::forwardEulerStep(double current_time, double new_time)
 {
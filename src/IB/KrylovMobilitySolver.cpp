@@ -35,6 +35,7 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "ArrayData.h"
+#include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenSchedule.h"
 #include "HierarchyCellDataOpsReal.h"
@@ -70,6 +71,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -323,6 +325,16 @@ KrylovMobilitySolver::~KrylovMobilitySolver()
         KSPDestroy(&d_petsc_ksp);
         d_petsc_ksp = nullptr;
     }
+    if (d_rpy_pc_ksp)
+    {
+        KSPDestroy(&d_rpy_pc_ksp);
+        d_rpy_pc_ksp = nullptr;
+    }
+    if (d_rpy_pc_mat)
+    {
+        MatDestroy(&d_rpy_pc_mat);
+        d_rpy_pc_mat = nullptr;
+    }
 } // ~KrylovMobilitySolver
 
 void
@@ -497,6 +509,15 @@ KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vb[0], &vb0);
 
+    // Get the grid spacing of the structure level for the RPY preconditioner.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(finest_ln)->getRatio();
+    const double* dx0 = grid_geom->getDx();
+    for (int d = 0; d < NDIM; ++d)
+    {
+        d_struct_dx[d] = dx0[d] / ratio(d);
+    }
+
     // Setup the interpolation transaction information.
     d_fill_pattern = nullptr;
     using InterpolationTransactionComponent = IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
@@ -579,6 +600,13 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("rpy_opening_angle")) d_rpy_opening_angle = input_db->getDouble("rpy_opening_angle");
+    if (input_db->keyExists("rpy_pc_max_iterations"))
+        d_rpy_pc_max_iterations = input_db->getInteger("rpy_pc_max_iterations");
+    if (input_db->keyExists("rpy_pc_rel_residual_tol"))
+        d_rpy_pc_rel_residual_tol = input_db->getDouble("rpy_pc_rel_residual_tol");
+    if (input_db->keyExists("f_periodic_correction"))
+        d_f_periodic_corr = input_db->getDouble("f_periodic_correction");
 } // getFromInput
 
 void
@@ -817,6 +845,10 @@ KrylovMobilitySolver::destroyKSP()
 {
     KSPDestroy(&d_petsc_ksp);
     d_petsc_ksp = nullptr;
+    KSPDestroy(&d_rpy_pc_ksp);
+    d_rpy_pc_ksp = nullptr;
+    MatDestroy(&d_rpy_pc_mat);
+    d_rpy_pc_mat = nullptr;
 } // destroyKSP
 
 void
@@ -906,6 +938,32 @@ KrylovMobilitySolver::resetKSPPC()
         PCSetType(petsc_pc, PCSHELL);
         PCShellSetContext(petsc_pc, static_cast<void*>(this));
         PCShellSetApply(petsc_pc, KrylovMobilitySolver::PCApply_KMInv);
+
+        // The preconditioner approximately inverts the RPY mobility operator,
+        // which is symmetric positive definite, by unpreconditioned CG.
+        if (!d_rpy_pc_mat)
+        {
+            int n;
+            VecGetLocalSize(d_petsc_b, &n);
+            MatCreateShell(
+                d_petsc_comm, n, n, PETSC_DETERMINE, PETSC_DETERMINE, static_cast<void*>(this), &d_rpy_pc_mat);
+            MatShellSetOperation(
+                d_rpy_pc_mat, MATOP_MULT, reinterpret_cast<void (*)(void)>(KrylovMobilitySolver::MatVecMult_RPY));
+        }
+        if (!d_rpy_pc_ksp)
+        {
+            KSPCreate(d_petsc_comm, &d_rpy_pc_ksp);
+            KSPSetOptionsPrefix(d_rpy_pc_ksp, (d_options_prefix + "rpy_pc_").c_str());
+            KSPSetType(d_rpy_pc_ksp, KSPCG);
+            KSPSetInitialGuessNonzero(d_rpy_pc_ksp, PETSC_FALSE);
+            KSPSetTolerances(
+                d_rpy_pc_ksp, d_rpy_pc_rel_residual_tol, PETSC_DEFAULT, PETSC_DEFAULT, d_rpy_pc_max_iterations);
+            KSPSetOperators(d_rpy_pc_ksp, d_rpy_pc_mat, d_rpy_pc_mat);
+            PC rpy_pc;
+            KSPGetPC(d_rpy_pc_ksp, &rpy_pc);
+            PCSetType(rpy_pc, PCNONE);
+            KSPSetFromOptions(d_rpy_pc_ksp);
+        }
     }
     else
     {
@@ -992,14 +1050,55 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     PetscFunctionReturn(0);
 } // MatVecMult_KMInv
 
-// Routine to apply DirectMobility preconditioner
-PetscErrorCode KrylovMobilitySolver::PCApply_KMInv(PC /*pc*/, Vec /*x*/, Vec /*y*/)
+// Routine to apply the RPY mobility preconditioner
+PetscErrorCode
+KrylovMobilitySolver::PCApply_KMInv(PC pc, Vec x, Vec y)
 {
-    TBOX_ERROR(
-        "KrylovMobilitySolver::PCApply_KMInv(). Shell Preconditioner for KrylovMobilitySolver not implemented.\n");
+    void* ctx;
+    PCShellGetContext(pc, &ctx);
+    auto solver = static_cast<KrylovMobilitySolver*>(ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(solver);
+    TBOX_ASSERT(solver->d_rpy_pc_ksp);
+#endif
+
+    // Approximately solve [RPY]y = x. The iteration count is capped, so the
+    // outer KSP must be a flexible method.
+    KSPSolve(solver->d_rpy_pc_ksp, x, y);
     PetscFunctionReturn(0);
 } // PCApply_KMInv
 
+PetscErrorCode
+KrylovMobilitySolver::MatVecMult_RPY(Mat A, Vec x, Vec y)
+{
+    void* p_ctx;
+    MatShellGetContext(A, &p_ctx);
+    auto solver = static_cast<KrylovMobilitySolver*>(p_ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(solver);
+#endif
+
+    // Mirror the scaling of MatVecMult_KMInv: y := beta*[gamma*M + delta*W]x.
+    const double gamma = solver->d_scale_spread;
+    const double beta = solver->d_scale_interp;
+    const double delta = solver->d_reg_mob_factor;
+    const double mu = solver->d_ins_integrator->getStokesSpecifications()->getMu();
+    std::vector<unsigned> struct_ids(solver->d_cib_strategy->getNumberOfRigidStructures());
+    std::iota(struct_ids.begin(), struct_ids.end(), 0);
+    static const int managing_rank = 0;
+    solver->d_cib_strategy->applyMobilityOperator(x,
+                                                  y,
+                                                  RPY,
+                                                  struct_ids,
+                                                  solver->d_struct_dx,
+                                                  mu,
+                                                  std::make_pair(gamma * beta, delta * beta),
+                                                  solver->d_f_periodic_corr,
+                                                  solver->d_rpy_opening_angle,
+                                                  managing_rank);
+    PetscFunctionReturn(0);
+} // MatVecMult_RPY
+
 // Routine to log output of KrylovMobilitySolver
 PetscErrorCode
 KrylovMobilitySolver::monitorKSP(KSP ksp, int it, PetscReal rnorm, void* /*mctx*/)
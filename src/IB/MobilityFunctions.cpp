@@ -17,10 +17,13 @@
 
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -558,6 +561,178 @@ getEmpiricalMobilityComponents(const char* IBKernelName,
     }
     return;
 } // getEmpiricalMobilityComponents
+
+// Adds the product of the (unregularized, unshifted) RPY tensor for the
+// separation r_vec = X_i - X_j and the vector F to U.
+inline void
+add_rpy_tensor_product(const double* r_vec, const double* F, const double a, const double mu_tt, double* U)
+{
+    const double rsq = get_sqnorm(r_vec);
+    if (rsq == 0.0)
+    {
+        for (int d = 0; d < NDIM; ++d) U[d] += mu_tt * F[d];
+        return;
+    }
+    const double r = std::sqrt(rsq);
+    double r_dot_F = 0.0;
+    for (int d = 0; d < NDIM; ++d) r_dot_F += r_vec[d] * F[d];
+    double c_I, c_rr;
+    if (r <= 2.0 * a)
+    {
+        c_I = mu_tt * (1.0 - 9.0 / 32.0 * r / a);
+        c_rr = mu_tt * 3.0 * r / 32.0 / a;
+    }
+    else
+    {
+        const double cube = a * a * a / (rsq * r);
+        c_I = mu_tt * (3.0 / 4.0 * a / r + 1.0 / 2.0 * cube);
+        c_rr = mu_tt * (3.0 / 4.0 * a / r - 3.0 / 2.0 * cube);
+    }
+    for (int d = 0; d < NDIM; ++d) U[d] += c_I * F[d] + c_rr * r_vec[d] * r_dot_F / rsq;
+    return;
+} // add_rpy_tensor_product
+
+// Adds the first-order (dipole) correction to the far-field RPY interaction of
+// a cluster of markers whose total force is located at their centroid, where
+// r_vec is the separation between the target and the centroid and
+// D[k * NDIM + l] is the sum over the cluster of (X_j - centroid)_k * F_j_l.
+//
+// For r > 2a the RPY tensor is A(r) I + B(r) r r^T, and the correction is
+// -sum_kl d/dr_k (A delta_il + B r_i r_l) D_kl.
+inline void
+add_rpy_dipole_correction(const double* r_vec, const double* D, const double a, const double mu_tt, double* U)
+{
+    const double rsq = get_sqnorm(r_vec);
+    const double r = std::sqrt(rsq);
+    const double a3 = a * a * a;
+    const double B = mu_tt * (3.0 / 4.0 * a / (rsq * r) - 3.0 / 2.0 * a3 / (rsq * rsq * r));
+    const double dA_r = mu_tt * (-3.0 / 4.0 * a / (rsq * r) - 3.0 / 2.0 * a3 / (rsq * rsq * r));
+    const double dB_r = mu_tt * (-9.0 / 4.0 * a / (rsq * rsq * r) + 15.0 / 2.0 * a3 / (rsq * rsq * rsq * r));
+    double rD[NDIM], Dr[NDIM], rDr = 0.0, trD = 0.0;
+    for (int i = 0; i < NDIM; ++i)
+    {
+        rD[i] = 0.0;
+        Dr[i] = 0.0;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            rD[i] += r_vec[k] * D[k * NDIM + i];
+            Dr[i] += D[i * NDIM + k] * r_vec[k];
+        }
+        rDr += rD[i] * r_vec[i];
+        trD += D[i * NDIM + i];
+    }
+    for (int i = 0; i < NDIM; ++i)
+    {
+        U[i] -= dA_r * rD[i] + dB_r * r_vec[i] * rDr + B * (Dr[i] + r_vec[i] * trD);
+    }
+    return;
+} // add_rpy_dipole_correction
+
+// Cell of the spatial tree used by the matrix-free RPY operator.  Each cell
+// covers the markers perm[begin], ..., perm[end - 1] and stores their centroid,
+// the radius of the ball about the centroid that contains them, and the
+// monopole and dipole moments of their forces about the centroid.
+struct RPYTreeCell
+{
+    double center[NDIM];
+    double radius;
+    double F_sum[NDIM];
+    double F_dipole[NDIM * NDIM];
+    int begin, end;
+    bool is_leaf;
+    int child[1 << NDIM];
+};
+
+// Markers per leaf cell.  Interactions within a leaf are always evaluated
+// directly.
+const int RPY_TREE_LEAF_SIZE = 32;
+
+// Recursively builds the tree cell covering perm[begin], ..., perm[end - 1] and
+// returns its index in cells.
+int
+build_rpy_tree(std::vector<RPYTreeCell>& cells,
+               std::vector<int>& perm,
+               const int begin,
+               const int end,
+               const double* X,
+               const double* F)
+{
+    const int cell_idx = static_cast<int>(cells.size());
+    cells.emplace_back();
+    RPYTreeCell cell;
+    cell.begin = begin;
+    cell.end = end;
+    cell.is_leaf = true;
+    std::fill(cell.child, cell.child + (1 << NDIM), -1);
+
+    double X_min[NDIM], X_max[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        cell.center[d] = 0.0;
+        cell.F_sum[d] = 0.0;
+        X_min[d] = std::numeric_limits<double>::max();
+        X_max[d] = -std::numeric_limits<double>::max();
+    }
+    for (int k = begin; k < end; ++k)
+    {
+        const int j = perm[k];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            cell.center[d] += X[j * NDIM + d];
+            cell.F_sum[d] += F[j * NDIM + d];
+            X_min[d] = std::min(X_min[d], X[j * NDIM + d]);
+            X_max[d] = std::max(X_max[d], X[j * NDIM + d]);
+        }
+    }
+    for (int d = 0; d < NDIM; ++d) cell.center[d] /= static_cast<double>(end - begin);
+    cell.radius = 0.0;
+    std::fill(cell.F_dipole, cell.F_dipole + NDIM * NDIM, 0.0);
+    for (int k = begin; k < end; ++k)
+    {
+        const int j = perm[k];
+        double r_vec[NDIM];
+        for (int d = 0; d < NDIM; ++d) r_vec[d] = X[j * NDIM + d] - cell.center[d];
+        cell.radius = std::max(cell.radius, get_sqnorm(r_vec));
+        for (int d = 0; d < NDIM; ++d)
+        {
+            for (int l = 0; l < NDIM; ++l) cell.F_dipole[d * NDIM + l] += r_vec[d] * F[j * NDIM + l];
+        }
+    }
+    cell.radius = std::sqrt(cell.radius);
+
+    // Split the cell into (at most) 2^NDIM children by bisecting its bounding
+    // box.  Coincident markers cannot be separated and are kept in one leaf.
+    if (end - begin > RPY_TREE_LEAF_SIZE && cell.radius > 0.0)
+    {
+        cell.is_leaf = false;
+        int bounds[(1 << NDIM) + 1];
+        bounds[0] = begin;
+        bounds[1 << NDIM] = end;
+        for (int d = NDIM - 1, stride = (1 << NDIM); d >= 0; --d, stride /= 2)
+        {
+            const double X_mid = 0.5 * (X_min[d] + X_max[d]);
+            for (int b = 0; b < (1 << NDIM); b += stride)
+            {
+                auto mid = std::partition(perm.begin() + bounds[b],
+                                          perm.begin() + bounds[b + stride],
+                                          [&](const int j) { return X[j * NDIM + d] < X_mid; });
+                bounds[b + stride / 2] = static_cast<int>(mid - perm.begin());
+            }
+        }
+        for (int b = 0; b < (1 << NDIM); ++b)
+        {
+            // Guard against bounding boxes too thin to be bisected in floating
+            // point.
+            if (bounds[b + 1] - bounds[b] == end - begin) cell.is_leaf = true;
+        }
+        for (int b = 0; b < (1 << NDIM) && !cell.is_leaf; ++b)
+        {
+            if (bounds[b + 1] > bounds[b]) cell.child[b] = build_rpy_tree(cells, perm, bounds[b], bounds[b + 1], X, F);
+        }
+    }
+    cells[cell_idx] = cell;
+    return cell_idx;
+} // build_rpy_tree
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -685,6 +860,90 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyRPYMobilityOperator(const char* IBKernelName,
+                                            const double MU,
+                                            const double DX,
+                                            const double* X,
+                                            const int N,
+                                            const double PERIODIC_CORRECTION,
+                                            const double OPENING_ANGLE,
+                                            const double* F,
+                                            double* U,
+                                            const int target_begin,
+                                            const int target_end)
+{
+    if (N <= 0) return;
+    const int i_begin = std::max(target_begin, 0);
+    const int i_end = target_end < 0 ? N : std::min(target_end, N);
+    const double a = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * a);
+
+    // Build the tree.  Only the marker permutation and O(N) cells are stored.
+    std::vector<int> perm(N);
+    for (int j = 0; j < N; ++j) perm[j] = j;
+    std::vector<RPYTreeCell> cells;
+    cells.reserve(2 * (N / RPY_TREE_LEAF_SIZE + 1));
+    build_rpy_tree(cells, perm, 0, N, X, F);
+
+    // The periodic correction shifts every block of the mobility matrix by the
+    // same multiple of the identity.
+    const double* const F_total = cells[0].F_sum;
+
+    // Far-away cells are replaced by the monopole and dipole moments of their
+    // forces about their centroid.  A cell is far away from a marker if it is outside the RPY
+    // overlap region and it subtends an angle smaller than the opening angle.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> stack;
+        stack.reserve(64);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for (int i = i_begin; i < i_end; ++i)
+        {
+            const double* const X_i = &X[i * NDIM];
+            double U_i[NDIM];
+            for (int d = 0; d < NDIM; ++d) U_i[d] = -PERIODIC_CORRECTION * F_total[d];
+            stack.clear();
+            stack.push_back(0);
+            while (!stack.empty())
+            {
+                const RPYTreeCell& cell = cells[stack.back()];
+                stack.pop_back();
+                double r_vec[NDIM];
+                for (int d = 0; d < NDIM; ++d) r_vec[d] = X_i[d] - cell.center[d];
+                const double r = std::sqrt(get_sqnorm(r_vec));
+                if (r - cell.radius > 2.0 * a && cell.radius < OPENING_ANGLE * r)
+                {
+                    add_rpy_tensor_product(r_vec, cell.F_sum, a, mu_tt, U_i);
+                    add_rpy_dipole_correction(r_vec, cell.F_dipole, a, mu_tt, U_i);
+                }
+                else if (cell.is_leaf)
+                {
+                    for (int k = cell.begin; k < cell.end; ++k)
+                    {
+                        const int j = perm[k];
+                        for (int d = 0; d < NDIM; ++d) r_vec[d] = X_i[d] - X[j * NDIM + d];
+                        add_rpy_tensor_product(r_vec, &F[j * NDIM], a, mu_tt, U_i);
+                    }
+                }
+                else
+                {
+                    for (int b = 0; b < (1 << NDIM); ++b)
+                    {
+                        if (cell.child[b] >= 0) stack.push_back(cell.child[b]);
+                    }
+                }
+            }
+            for (int d = 0; d < NDIM; ++d) U[i * NDIM + d] = U_i[d];
+        }
+    }
+    return;
+} // applyRPYMobilityOperator
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
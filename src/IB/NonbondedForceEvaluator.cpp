@@ -81,6 +81,13 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // Threaded force evaluation requires a thread-safe force function, so it
+    // must be requested explicitly.
+    if (input_db->keyExists("use_threaded_force_evaluation"))
+    {
+        d_use_threaded_force_evaluation = input_db->getBool("use_threaded_force_evaluation");
+    }
 }
 
 void
@@ -93,8 +100,8 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //   Function to add nonbonded forces from the interaction between the nodes at
     //   mstr_petsc_idx and search_petsc_idx.
     //
-    //   inputs: mstr_petsc_idx:    integer petsc index of the master node
-    //           search_petsc_idx:  integer petsc index of the search node
+    //   inputs: mstr_petsc_idx:    integer local petsc index of the master node
+    //           search_petsc_idx:  integer local petsc index of the search node
     //           X_data:            pointer to LData of location values for the particles
     //           cell_offset:       vector of periodic offsets of the search particle,
     //                    integer value in units of the entire domain.  E.G. a particle
@@ -103,42 +110,44 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //
     //   outputs:
     //          F_data - pointer to LData object containing forces on particles.  Will
-    //                   be added to by this function.
+    //                   be added to by this function.  The force on the search node
+    //                   is only applied if it is a local node.
     //
     //////////////////////////////////////////////////////////////////////////////////
 
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
-    PetscScalar* position;
-    VecGetArray(X_data->getVec(), &position);
-    PetscScalar* force;
-    VecGetArray(F_data->getVec(), &force);
-
     // get domain bounds
     const double* x_lower = d_grid_geometry->getXLower();
     const double* x_upper = d_grid_geometry->getXUpper();
 
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
+    const std::vector<int> mstr_idxs(1, mstr_petsc_idx);
+    const std::vector<int> search_idxs(1, search_petsc_idx);
+    std::vector<double> shifts(NDIM);
     for (int k = 0; k < NDIM; ++k)
     {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += std::pow(D[k], 2);
+        shifts[k] = cell_offset[k] * (x_upper[k] - x_lower[k]);
     }
-    R = std::sqrt(R);
+    const bool search_node_is_local = search_petsc_idx < static_cast<int>(F_data->getLocalNodeCount());
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+    evaluateForces(mstr_idxs, search_idxs, shifts, search_node_is_local, X_node, F_node);
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // evaluateForces
 
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int level_number,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    if (level_number < static_cast<int>(d_neighbor_lists.size()))
     {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+        d_neighbor_lists[level_number] = NeighborList();
     }
-    VecRestoreArray(F_data->getVec(), &force);
     return;
-} // evaluateForces
+} // initializeLevelData
 
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
@@ -149,21 +158,111 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 const double /*data_time*/,
                                                 LDataManager* const l_data_manager)
 {
-    // Get grid geometry and relevant lower and upper limits.
+    // Get grid geometry.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
 
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
+    if (level_number >= static_cast<int>(d_neighbor_lists.size())) d_neighbor_lists.resize(level_number + 1);
+    NeighborList& nbr_list = d_neighbor_lists[level_number];
+
+    // Get the node positions (including ghost nodes) and the forces on the
+    // local nodes once for all pairs.
+    const int num_local_nodes = static_cast<int>(X_data->getLocalNodeCount());
+    const int num_nodes = num_local_nodes + static_cast<int>(X_data->getGhostNodeCount());
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+
+    // Rebuild the neighbor list if any node has moved too far since the list
+    // was last built.
+    if (!neighborListIsValid(nbr_list, X_node, num_nodes))
+    {
+        buildNeighborList(nbr_list, X_node, num_local_nodes, num_nodes, hierarchy, level_number, l_data_manager);
+    }
+
+    evaluateForces(nbr_list.local_mstr_idxs,
+                   nbr_list.local_search_idxs,
+                   nbr_list.local_shifts,
+                   /*apply_to_search_node*/ true,
+                   X_node,
+                   F_node);
+    evaluateForces(nbr_list.ghost_mstr_idxs,
+                   nbr_list.ghost_search_idxs,
+                   nbr_list.ghost_shifts,
+                   /*apply_to_search_node*/ false,
+                   X_node,
+                   F_node);
+
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool
+NonbondedForceEvaluator::neighborListIsValid(const NeighborList& nbr_list,
+                                             const double* const X_node,
+                                             const int num_nodes) const
+{
+    if (!nbr_list.is_valid || static_cast<int>(nbr_list.X_build.size()) != NDIM * num_nodes) return false;
+
+    // The list contains all pairs within interaction_radius + 2*regrid_alpha
+    // of each other, so it is valid as long as no node has moved more than
+    // regrid_alpha.
+    const double max_displacement_sq = d_regrid_alpha * d_regrid_alpha;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        double displacement_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double dX = (X_node[NDIM * k + d] - nbr_list.X_build[NDIM * k + d]) / nbr_list.dx[d];
+            displacement_sq += dX * dX;
+        }
+        if (displacement_sq > max_displacement_sq) return false;
+    }
+    return true;
+} // neighborListIsValid
+
+void
+NonbondedForceEvaluator::buildNeighborList(NeighborList& nbr_list,
+                                           const double* const X_node,
+                                           const int num_local_nodes,
+                                           const int num_nodes,
+                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           LDataManager* const l_data_manager)
+{
+    nbr_list = NeighborList();
+    nbr_list.X_build.assign(X_node, X_node + NDIM * num_nodes);
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
 
-    // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(static_cast<int>(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
+    // Pairs are found by searching the cells of the Lagrangian index data up
+    // to interaction_radius + 2*regrid_alpha cells away from each node, and
+    // are kept if they are within that distance of each other.
+    const double list_radius = d_interaction_radius + 2.0 * d_regrid_alpha;
+    const double list_radius_sq = list_radius * list_radius;
+    IntVector<NDIM> grow_amount(static_cast<int>(std::ceil(list_radius)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
-    // iterate through levels.
+    // Displacements are measured in units of the mesh width of this level.
+    // This is computed from the grid geometry rather than from a patch so that
+    // it is also set on processes that own no patches of this level.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    for (int d = 0; d < NDIM; ++d) nbr_list.dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -172,74 +271,120 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
 
-        std::vector<int> cell_offset(NDIM);
         // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
+        // is the "master" cell.
+        double shift[NDIM];
         for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
         {
-            // get list of particles in this cell
             const hier::Index<NDIM>& first_cell_idx = *cit;
             LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            if (!mstr_node_set) continue;
+            Box<NDIM> search_box(first_cell_idx, first_cell_idx);
+            for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                const hier::Index<NDIM>& search_cell_idx = *scit;
+                LNodeSet* const search_node_set = current_idx_data->getItem(search_cell_idx);
+                if (!search_node_set) continue;
+
+                // Periodic shift of nodes in this search cell.
+                for (int k = 0; k < NDIM; ++k)
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const hier::Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
-                    {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
-                    }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    const double absolute_diff = search_cell_idx[k] * patch_dx[k];
+                    shift[k] = std::floor(absolute_diff / (x_upper[k] - x_lower[k])) * (x_upper[k] - x_lower[k]);
+                }
+
+                for (const auto& mstr_node_idx : *mstr_node_set)
+                {
+                    const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                    const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                    for (const auto& search_node_idx : *search_node_set)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (const auto& mstr_node_idx : *mstr_node_set)
+                        const int search_lag_idx = search_node_idx->getLagrangianIndex();
+                        const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                        const bool search_node_is_local = search_petsc_idx < num_local_nodes;
+
+                        // Pairs of local nodes are only stored once.
+                        if (search_node_is_local && mstr_lag_idx >= search_lag_idx) continue;
+
+                        double R_sq = 0.0;
+                        for (int k = 0; k < NDIM; ++k)
                         {
-                            // master nodes
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (const auto& search_node_idx : *search_node_set)
-                            {
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
+                            const double D = (X_node[NDIM * mstr_petsc_idx + k] -
+                                              X_node[NDIM * search_petsc_idx + k] - shift[k]) /
+                                             patch_dx[k];
+                            R_sq += D * D;
+                        }
+                        if (R_sq > list_radius_sq) continue;
+
+                        std::vector<int>& mstr_idxs =
+                            search_node_is_local ? nbr_list.local_mstr_idxs : nbr_list.ghost_mstr_idxs;
+                        std::vector<int>& search_idxs =
+                            search_node_is_local ? nbr_list.local_search_idxs : nbr_list.ghost_search_idxs;
+                        std::vector<double>& shifts = search_node_is_local ? nbr_list.local_shifts : nbr_list.ghost_shifts;
+                        mstr_idxs.push_back(mstr_petsc_idx);
+                        search_idxs.push_back(search_petsc_idx);
+                        shifts.insert(shifts.end(), shift, shift + NDIM);
+                    }
+                }
+            }
+        }
+    }
+    nbr_list.is_valid = true;
     return;
-} // computeLagrangianForce
+} // buildNeighborList
 
 void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+NonbondedForceEvaluator::evaluateForces(const std::vector<int>& mstr_idxs,
+                                        const std::vector<int>& search_idxs,
+                                        const std::vector<double>& shifts,
+                                        const bool apply_to_search_node,
+                                        const double* const X_node,
+                                        double* const F_node) const
 {
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    const int num_pairs = static_cast<int>(mstr_idxs.size());
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_force_evaluation)
+#endif
+    {
+        // The force function takes its parameters by value, so each thread
+        // works with its own copy of them.
+        Array<double> parameters(d_parameters.getSize());
+        for (int k = 0; k < d_parameters.getSize(); ++k)
+        {
+            parameters[k] = d_parameters[k];
+        }
+        double D[NDIM], nonbdd_force[NDIM];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int l = 0; l < num_pairs; ++l)
+        {
+            const int mstr_idx = mstr_idxs[l];
+            const int search_idx = search_idxs[l];
+            for (int k = 0; k < NDIM; ++k)
+            {
+                D[k] = X_node[NDIM * mstr_idx + k] - X_node[NDIM * search_idx + k] - shifts[NDIM * l + k];
+            }
+            (d_force_fcn_ptr)(D, parameters, nonbdd_force);
+            for (int k = 0; k < NDIM; ++k)
+            {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                F_node[NDIM * mstr_idx + k] += nonbdd_force[k];
+            }
+            if (!apply_to_search_node) continue;
+            for (int k = 0; k < NDIM; ++k)
+            {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                F_node[NDIM * search_idx + k] -= nonbdd_force[k];
+            }
+        }
+    }
     return;
-} // registerForceFcnPtr
+} // evaluateForces
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -637,6 +637,7 @@ AdvDiffHierarchyIntegrator::setHelmholtzSolver(Pointer<CellVariable<NDIM, double
 {
     d_helmholtz_solvers.resize(d_Q_var.size());
     d_helmholtz_solvers_need_init.resize(d_Q_var.size());
+    d_helmholtz_solvers_user_provided.resize(d_Q_var.size());
 #if !defined(NDEBUG)
     TBOX_ASSERT(std::find(d_Q_var.begin(), d_Q_var.end(), Q_var) != d_Q_var.end());
 #endif
@@ -646,6 +647,7 @@ AdvDiffHierarchyIntegrator::setHelmholtzSolver(Pointer<CellVariable<NDIM, double
 #endif
     d_helmholtz_solvers[l] = helmholtz_solver;
     d_helmholtz_solvers_need_init[l] = true;
+    d_helmholtz_solvers_user_provided[l] = true;
     return;
 } // setHelmholtzSolver
 
@@ -654,6 +656,7 @@ AdvDiffHierarchyIntegrator::getHelmholtzSolver(Pointer<CellVariable<NDIM, double
 {
     d_helmholtz_solvers.resize(d_Q_var.size());
     d_helmholtz_solvers_need_init.resize(d_Q_var.size());
+    d_helmholtz_solvers_user_provided.resize(d_Q_var.size());
 #if !defined(NDEBUG)
     TBOX_ASSERT(std::find(d_Q_var.begin(), d_Q_var.end(), Q_var) != d_Q_var.end());
 #endif
@@ -702,6 +705,7 @@ AdvDiffHierarchyIntegrator::setHelmholtzRHSOperator(Pointer<CellVariable<NDIM, d
 {
     d_helmholtz_rhs_ops.resize(d_Q_var.size());
     d_helmholtz_rhs_ops_need_init.resize(d_Q_var.size());
+    d_helmholtz_rhs_ops_user_provided.resize(d_Q_var.size());
 #if !defined(NDEBUG)
     TBOX_ASSERT(std::find(d_Q_var.begin(), d_Q_var.end(), Q_var) != d_Q_var.end());
 #endif
@@ -711,6 +715,7 @@ AdvDiffHierarchyIntegrator::setHelmholtzRHSOperator(Pointer<CellVariable<NDIM, d
 #endif
     d_helmholtz_rhs_ops[l] = helmholtz_op;
     d_helmholtz_rhs_ops_need_init[l] = true;
+    d_helmholtz_rhs_ops_user_provided[l] = true;
     return;
 } // setHelmholtzRHSOperator
 
@@ -719,6 +724,7 @@ AdvDiffHierarchyIntegrator::getHelmholtzRHSOperator(Pointer<CellVariable<NDIM, d
 {
     d_helmholtz_rhs_ops.resize(d_Q_var.size());
     d_helmholtz_rhs_ops_need_init.resize(d_Q_var.size());
+    d_helmholtz_rhs_ops_user_provided.resize(d_Q_var.size());
 #if !defined(NDEBUG)
     TBOX_ASSERT(std::find(d_Q_var.begin(), d_Q_var.end(), Q_var) != d_Q_var.end());
 #endif
@@ -805,6 +811,7 @@ AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy
     }
     d_helmholtz_solvers.resize(d_Q_var.size());
     d_helmholtz_solvers_need_init.resize(d_Q_var.size());
+    d_helmholtz_solvers_user_provided.resize(d_Q_var.size());
     for (const auto& Q_var : d_Q_var)
     {
         const size_t l = distance(d_Q_var.begin(), std::find(d_Q_var.begin(), d_Q_var.end(), Q_var));
@@ -812,6 +819,7 @@ AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy
     }
     d_helmholtz_rhs_ops.resize(d_Q_var.size());
     d_helmholtz_rhs_ops_need_init.resize(d_Q_var.size());
+    d_helmholtz_rhs_ops_user_provided.resize(d_Q_var.size());
     for (const auto& Q_var : d_Q_var)
     {
         const size_t l = distance(d_Q_var.begin(), std::find(d_Q_var.begin(), d_Q_var.end(), Q_var));
@@ -21,7 +21,10 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
+#include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
@@ -29,7 +32,10 @@
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
 #include "CellVariable.h"
 #include "FaceData.h"
 #include "FaceVariable.h"
@@ -45,6 +51,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -58,7 +65,9 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <cmath>
 #include <deque>
+#include <limits>
 #include <map>
 #include <ostream>
 #include <set>
@@ -93,6 +102,90 @@ namespace IBAMR
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 
+namespace
+{
+// Copy the data of a transported quantity to the components of the data used
+// for a batched Helmholtz solve that start at the specified depth.
+void
+copy_to_batch_data(const int batch_idx,
+                   const int depth_offset,
+                   const int Q_idx,
+                   const Pointer<PatchHierarchy<NDIM> >& hierarchy)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > batch_data = patch->getPatchData(batch_idx);
+            Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+            for (int d = 0; d < Q_data->getDepth(); ++d)
+            {
+                batch_data->copyDepth(depth_offset + d, *Q_data, d);
+            }
+        }
+    }
+    return;
+} // copy_to_batch_data
+
+// Copy the components of the data used for a batched Helmholtz solve that start
+// at the specified depth to the data of a transported quantity.
+void
+copy_from_batch_data(const int Q_idx,
+                     const int batch_idx,
+                     const int depth_offset,
+                     const Pointer<PatchHierarchy<NDIM> >& hierarchy)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+            Pointer<CellData<NDIM, double> > batch_data = patch->getPatchData(batch_idx);
+            for (int d = 0; d < Q_data->getDepth(); ++d)
+            {
+                Q_data->copyDepth(d, *batch_data, depth_offset + d);
+            }
+        }
+    }
+    return;
+} // copy_from_batch_data
+
+// Compute the discrete L2 norm of each depth of the cell-centered data used for
+// a batched Helmholtz solve.
+std::vector<double>
+compute_batch_depth_L2_norms(const int batch_idx, const int wgt_idx, const Pointer<PatchHierarchy<NDIM> >& hierarchy)
+{
+    Pointer<CellDataFactory<NDIM, double> > batch_factory =
+        VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor()->getPatchDataFactory(batch_idx);
+    std::vector<double> norms(batch_factory->getDefaultDepth(), 0.0);
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > batch_data = patch->getPatchData(batch_idx);
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < norms.size(); ++d)
+                {
+                    norms[d] += (*wgt_data)(i) * (*batch_data)(i, d) * (*batch_data)(i, d);
+                }
+            }
+        }
+    }
+    IBTK_MPI::sumReduction(norms.data(), static_cast<int>(norms.size()));
+    for (auto& norm : norms) norm = std::sqrt(norm);
+    return norms;
+} // compute_batch_depth_L2_norms
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(const std::string& object_name,
@@ -427,6 +520,10 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 
+    // Group together the quantities whose Helmholtz systems can be solved
+    // simultaneously.
+    setupHelmholtzBatches();
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -475,6 +572,9 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         d_finest_reset_ln = finest_ln;
     }
 
+    // Determine which batched Helmholtz solves can be used for this time step.
+    updateActiveHelmholtzBatches();
+
     // Allocate the scratch and new data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -512,103 +612,139 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         }
     }
 
-    // Setup the operators and solvers and compute the right-hand-side terms.
-    unsigned int l = 0;
-    for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
+    // Setup the operators and solvers for the batched Helmholtz solves and
+    // compute the corresponding right-hand-side terms.
+    for (unsigned int b = 0; b < d_helmholtz_batch_Q_idxs.size(); ++b)
     {
-        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
-        Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
-        Pointer<SideVariable<NDIM, double> > D_var = d_Q_diffusion_coef_variable[Q_var];
-        Pointer<SideVariable<NDIM, double> > D_rhs_var = d_diffusion_coef_rhs_map[D_var];
-        TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
-        const double lambda = d_Q_damping_coef[Q_var];
-        const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
-
-        const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
-        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
-        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
-        const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
-        const int D_current_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getCurrentContext()) : -1);
-        const int D_scratch_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getScratchContext()) : -1);
-        const int D_rhs_scratch_idx =
-            (D_rhs_var ? var_db->mapVariableAndContextToIndex(D_rhs_var, getScratchContext()) : -1);
-
-        // Setup the problem coefficients for the linear solve for Q(n+1).
-        double K = 0.0;
-        switch (diffusion_time_stepping_type)
+        if (!d_helmholtz_batch_active[b]) continue;
+        const std::vector<unsigned int>& Q_idxs = d_helmholtz_batch_Q_idxs[b];
+        Pointer<CellVariable<NDIM, double> > Q_lead_var = d_Q_var[Q_idxs.front()];
+        PoissonSpecifications solver_spec(d_object_name + "::solver_spec::helmholtz_batch_" + std::to_string(b));
+        PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::helmholtz_batch_" + std::to_string(b));
+        setHelmholtzSpecifications(solver_spec, rhs_op_spec, Q_lead_var, dt);
+
+        bool rhs_op_needs_init = d_helmholtz_batch_needs_init[b], solver_needs_init = d_helmholtz_batch_needs_init[b];
+        std::vector<RobinBcCoefStrategy<NDIM>*> batch_bc_coef;
+        for (const auto& l : Q_idxs)
         {
-        case BACKWARD_EULER:
-            K = 1.0;
-            break;
-        case FORWARD_EULER:
-            K = 0.0;
-            break;
-        case TRAPEZOIDAL_RULE:
-            K = 0.5;
-            break;
-        default:
-            TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
-                                     << "  unsupported diffusion time stepping type: "
-                                     << enum_to_string<TimeSteppingType>(diffusion_time_stepping_type) << " \n"
-                                     << "  valid choices are: BACKWARD_EULER, "
-                                        "FORWARD_EULER, TRAPEZOIDAL_RULE\n");
-        }
-        PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + Q_var->getName());
-        PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + Q_var->getName());
-        solver_spec.setCConstant(1.0 / dt + K * lambda);
-        rhs_op_spec.setCConstant(1.0 / dt - (1.0 - K) * lambda);
-        if (isDiffusionCoefficientVariable(Q_var))
-        {
-            // set -K*kappa in solver_spec
-            d_hier_sc_data_ops->scale(D_scratch_idx, -K, D_current_idx);
-            solver_spec.setDPatchDataId(D_scratch_idx);
-            // set (1.0-K)*kappa in rhs_op_spec
-            d_hier_sc_data_ops->scale(D_rhs_scratch_idx, (1.0 - K), D_current_idx);
-            rhs_op_spec.setDPatchDataId(D_rhs_scratch_idx);
-        }
-        else
-        {
-            const double kappa = d_Q_diffusion_coef[Q_var];
-            solver_spec.setDConstant(-K * kappa);
-            rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
+            rhs_op_needs_init = rhs_op_needs_init || d_helmholtz_rhs_ops_need_init[l];
+            solver_needs_init = solver_needs_init || d_helmholtz_solvers_need_init[l];
+            const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[d_Q_var[l]];
+            batch_bc_coef.insert(batch_bc_coef.end(), Q_bc_coef.begin(), Q_bc_coef.end());
         }
 
         // Initialize the RHS operator and compute the RHS vector.
-        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+        const int batch_sol_idx = d_helmholtz_batch_sol_vecs[b]->getComponentDescriptorIndex(0);
+        const int batch_rhs_idx = d_helmholtz_batch_rhs_vecs[b]->getComponentDescriptorIndex(0);
+        for (const auto& l : Q_idxs)
+        {
+            const int Q_current_idx = var_db->mapVariableAndContextToIndex(d_Q_var[l], getCurrentContext());
+            copy_to_batch_data(batch_sol_idx, d_Q_helmholtz_batch_depth_offset[l], Q_current_idx, d_hierarchy);
+        }
+        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_batch_rhs_ops[b];
         helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
-        helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
+        helmholtz_rhs_op->setPhysicalBcCoefs(batch_bc_coef);
         helmholtz_rhs_op->setHomogeneousBc(false);
         helmholtz_rhs_op->setSolutionTime(current_time);
         helmholtz_rhs_op->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_rhs_ops_need_init[l])
+        if (rhs_op_needs_init)
         {
             if (d_enable_logging)
             {
                 plog << d_object_name << ": "
-                     << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
+                     << "Initializing Helmholtz RHS operator for batch number " << b << "\n";
             }
-            helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_rhs_ops_need_init[l] = false;
+            helmholtz_rhs_op->initializeOperatorState(*d_helmholtz_batch_sol_vecs[b], *d_helmholtz_batch_rhs_vecs[b]);
+            for (const auto& l : Q_idxs) d_helmholtz_rhs_ops_need_init[l] = false;
+        }
+        helmholtz_rhs_op->apply(*d_helmholtz_batch_sol_vecs[b], *d_helmholtz_batch_rhs_vecs[b]);
+        for (const auto& l : Q_idxs)
+        {
+            const int Q_rhs_scratch_idx =
+                var_db->mapVariableAndContextToIndex(d_Q_Q_rhs_map[d_Q_var[l]], getScratchContext());
+            copy_from_batch_data(Q_rhs_scratch_idx, batch_rhs_idx, d_Q_helmholtz_batch_depth_offset[l], d_hierarchy);
         }
-        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
-        helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
 
         // Initialize the linear solver.
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_batch_solvers[b];
         helmholtz_solver->setPoissonSpecifications(solver_spec);
-        helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
+        helmholtz_solver->setPhysicalBcCoefs(batch_bc_coef);
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
+        if (solver_needs_init)
         {
             if (d_enable_logging)
             {
                 plog << d_object_name << ": "
-                     << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                     << "Initializing Helmholtz solvers for batch number " << b << "\n";
+            }
+            helmholtz_solver->initializeSolverState(*d_helmholtz_batch_sol_vecs[b], *d_helmholtz_batch_rhs_vecs[b]);
+            for (const auto& l : Q_idxs) d_helmholtz_solvers_need_init[l] = false;
+        }
+        d_helmholtz_batch_needs_init[b] = false;
+    }
+
+    // Setup the remaining operators and solvers and compute the
+    // right-hand-side terms.
+    unsigned int l = 0;
+    for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+        const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
+
+        const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
+        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+        const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
+
+        // Initialize the RHS operator and compute the RHS vector.  The RHS
+        // vectors of batched quantities were computed above.
+        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
+        const int batch_num = d_Q_helmholtz_batch[l];
+        if (batch_num == -1 || !d_helmholtz_batch_active[batch_num])
+        {
+            // Setup the problem coefficients for the linear solve for Q(n+1).
+            PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + Q_var->getName());
+            PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + Q_var->getName());
+            setHelmholtzSpecifications(solver_spec, rhs_op_spec, Q_var, dt);
+
+            Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+            helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+            helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_rhs_op->setHomogeneousBc(false);
+            helmholtz_rhs_op->setSolutionTime(current_time);
+            helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_rhs_ops_need_init[l])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
+                }
+                helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_rhs_ops_need_init[l] = false;
+            }
+            helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
+
+            // Initialize the linear solver.
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            helmholtz_solver->setPoissonSpecifications(solver_spec);
+            helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_solver->setHomogeneousBc(false);
+            helmholtz_solver->setSolutionTime(new_time);
+            helmholtz_solver->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_solvers_need_init[l])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                }
+                helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_solvers_need_init[l] = false;
             }
-            helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
         }
 
         // Account for the convective difference term.
@@ -804,7 +940,17 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
             d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, 1.0, F_scratch_idx, Q_rhs_scratch_idx);
         }
 
-        if (isDiffusionCoefficientVariable(Q_var) || (d_Q_diffusion_coef[Q_var] != 0.0))
+        const int batch_num = d_Q_helmholtz_batch[l];
+        if (batch_num != -1 && d_helmholtz_batch_active[batch_num])
+        {
+            // Q(n+1) is computed below, together with the other quantities in
+            // the batch.  Copy the RHS to the batch data.  The batch solution
+            // data already contain the most recent approximation to Q(n+1)
+            // (initially Q(n)), which is used as the initial guess.
+            const int batch_rhs_idx = d_helmholtz_batch_rhs_vecs[batch_num]->getComponentDescriptorIndex(0);
+            copy_to_batch_data(batch_rhs_idx, d_Q_helmholtz_batch_depth_offset[l], Q_rhs_scratch_idx, d_hierarchy);
+        }
+        else if (isDiffusionCoefficientVariable(Q_var) || (d_Q_diffusion_coef[Q_var] != 0.0))
         {
             // Solve for Q(n+1).
             Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
@@ -849,6 +995,57 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         }
     }
 
+    // Solve for Q(n+1) for the quantities whose Helmholtz systems are solved
+    // together.
+    for (unsigned int b = 0; b < d_helmholtz_batch_Q_idxs.size(); ++b)
+    {
+        if (!d_helmholtz_batch_active[b]) continue;
+        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_batch_solvers[b];
+
+        // The convergence criterion of the solver applies to the combined
+        // quantity, so a quantity with a small right-hand side would otherwise
+        // be solved less accurately than when it is advanced individually.
+        // Tighten the relative tolerance so that the residual is reduced
+        // relative to the smallest nonzero right-hand side of any data depth.
+        const double rel_residual_tol = helmholtz_solver->getRelativeTolerance();
+        const std::vector<double> rhs_norms =
+            compute_batch_depth_L2_norms(d_helmholtz_batch_rhs_vecs[b]->getComponentDescriptorIndex(0),
+                                         d_helmholtz_batch_rhs_vecs[b]->getControlVolumeIndex(0),
+                                         d_hierarchy);
+        double rhs_norm_sq = 0.0, min_rhs_norm = std::numeric_limits<double>::max();
+        for (const auto& rhs_norm : rhs_norms)
+        {
+            rhs_norm_sq += rhs_norm * rhs_norm;
+            if (rhs_norm > 0.0) min_rhs_norm = std::min(min_rhs_norm, rhs_norm);
+        }
+        if (rhs_norm_sq > 0.0)
+        {
+            helmholtz_solver->setRelativeTolerance(
+                std::min(rel_residual_tol,
+                         std::max(rel_residual_tol * min_rhs_norm / std::sqrt(rhs_norm_sq),
+                                  std::numeric_limits<double>::epsilon())));
+        }
+        helmholtz_solver->solveSystem(*d_helmholtz_batch_sol_vecs[b], *d_helmholtz_batch_rhs_vecs[b]);
+        helmholtz_solver->setRelativeTolerance(rel_residual_tol);
+        const int batch_sol_idx = d_helmholtz_batch_sol_vecs[b]->getComponentDescriptorIndex(0);
+        for (const auto& l : d_helmholtz_batch_Q_idxs[b])
+        {
+            const int Q_new_idx = var_db->mapVariableAndContextToIndex(d_Q_var[l], getNewContext());
+            copy_from_batch_data(Q_new_idx, batch_sol_idx, d_Q_helmholtz_batch_depth_offset[l], d_hierarchy);
+        }
+        if (d_enable_logging && d_enable_logging_solver_iterations)
+            plog << d_object_name << "::integrateHierarchy(): batched diffusion solve number of iterations = "
+                 << helmholtz_solver->getNumIterations() << "\n";
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): batched diffusion solve residual norm        = "
+                 << helmholtz_solver->getResidualNorm() << "\n";
+        if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+        {
+            pout << d_object_name << "::integrateHierarchy():"
+                 << "  WARNING: linear solver iterations == max iterations\n";
+        }
+    }
+
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
     return;
@@ -918,6 +1115,29 @@ AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         d_Q_convective_op_needs_init[Q_var] = true;
     }
     AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(base_hierarchy, coarsest_level, finest_level);
+
+    // Reset the solution and rhs vectors used for the batched Helmholtz solves.
+    // The corresponding operators and solvers are reinitialized along with
+    // those of the individual quantities.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    d_helmholtz_batch_sol_vecs.resize(d_helmholtz_batch_Q_idxs.size());
+    d_helmholtz_batch_rhs_vecs.resize(d_helmholtz_batch_Q_idxs.size());
+    for (unsigned int b = 0; b < d_helmholtz_batch_Q_idxs.size(); ++b)
+    {
+        const std::string name = "helmholtz_batch_" + std::to_string(b);
+        Pointer<CellVariable<NDIM, double> > sol_var = d_helmholtz_batch_sol_var[b];
+        const int sol_idx = var_db->mapVariableAndContextToIndex(sol_var, getScratchContext());
+        d_helmholtz_batch_sol_vecs[b] =
+            new SAMRAIVectorReal<NDIM, double>(d_object_name + "::sol_vec::" + name, d_hierarchy, 0, finest_hier_level);
+        d_helmholtz_batch_sol_vecs[b]->addComponent(sol_var, sol_idx, wgt_idx, d_hier_cc_data_ops);
+
+        Pointer<CellVariable<NDIM, double> > rhs_var = d_helmholtz_batch_rhs_var[b];
+        const int rhs_idx = var_db->mapVariableAndContextToIndex(rhs_var, getScratchContext());
+        d_helmholtz_batch_rhs_vecs[b] =
+            new SAMRAIVectorReal<NDIM, double>(d_object_name + "::rhs_vec::" + name, d_hierarchy, 0, finest_hier_level);
+        d_helmholtz_batch_rhs_vecs[b]->addComponent(rhs_var, rhs_idx, wgt_idx, d_hier_cc_data_ops);
+    }
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -935,6 +1155,222 @@ AdvDiffSemiImplicitHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Databas
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setHelmholtzSpecifications(PoissonSpecifications& solver_spec,
+                                                                   PoissonSpecifications& rhs_op_spec,
+                                                                   Pointer<CellVariable<NDIM, double> > Q_var,
+                                                                   const double dt)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<SideVariable<NDIM, double> > D_var = d_Q_diffusion_coef_variable[Q_var];
+    Pointer<SideVariable<NDIM, double> > D_rhs_var = d_diffusion_coef_rhs_map[D_var];
+    TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
+    const double lambda = d_Q_damping_coef[Q_var];
+
+    const int D_current_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getCurrentContext()) : -1);
+    const int D_scratch_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getScratchContext()) : -1);
+    const int D_rhs_scratch_idx =
+        (D_rhs_var ? var_db->mapVariableAndContextToIndex(D_rhs_var, getScratchContext()) : -1);
+
+    // Setup the problem coefficients for the linear solve for Q(n+1).
+    double K = 0.0;
+    switch (diffusion_time_stepping_type)
+    {
+    case BACKWARD_EULER:
+        K = 1.0;
+        break;
+    case FORWARD_EULER:
+        K = 0.0;
+        break;
+    case TRAPEZOIDAL_RULE:
+        K = 0.5;
+        break;
+    default:
+        TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
+                                 << "  unsupported diffusion time stepping type: "
+                                 << enum_to_string<TimeSteppingType>(diffusion_time_stepping_type) << " \n"
+                                 << "  valid choices are: BACKWARD_EULER, "
+                                    "FORWARD_EULER, TRAPEZOIDAL_RULE\n");
+    }
+    solver_spec.setCConstant(1.0 / dt + K * lambda);
+    rhs_op_spec.setCConstant(1.0 / dt - (1.0 - K) * lambda);
+    if (isDiffusionCoefficientVariable(Q_var))
+    {
+        // set -K*kappa in solver_spec
+        d_hier_sc_data_ops->scale(D_scratch_idx, -K, D_current_idx);
+        solver_spec.setDPatchDataId(D_scratch_idx);
+        // set (1.0-K)*kappa in rhs_op_spec
+        d_hier_sc_data_ops->scale(D_rhs_scratch_idx, (1.0 - K), D_current_idx);
+        rhs_op_spec.setDPatchDataId(D_rhs_scratch_idx);
+    }
+    else
+    {
+        const double kappa = d_Q_diffusion_coef[Q_var];
+        solver_spec.setDConstant(-K * kappa);
+        rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
+    }
+    return;
+} // setHelmholtzSpecifications
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setupHelmholtzBatches()
+{
+    d_Q_helmholtz_batch.assign(d_Q_var.size(), -1);
+    d_Q_helmholtz_batch_depth_offset.assign(d_Q_var.size(), 0);
+    d_helmholtz_batch_Q_idxs.clear();
+    d_helmholtz_batch_active.clear();
+    d_helmholtz_batch_needs_init.clear();
+    d_helmholtz_batch_sol_var.clear();
+    d_helmholtz_batch_rhs_var.clear();
+    d_helmholtz_batch_solvers.clear();
+    d_helmholtz_batch_rhs_ops.clear();
+    if (!d_batch_helmholtz_solves) return;
+
+    // Two quantities are grouped together when they require a linear solve and
+    // their Helmholtz operators are identical.  The boundary conditions, which
+    // are specified separately for each data depth, need not agree.
+    std::vector<std::vector<unsigned int> > groups;
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[l];
+        if (!isDiffusionCoefficientVariable(Q_var) && d_Q_diffusion_coef[Q_var] == 0.0) continue;
+
+        // Quantities whose Helmholtz solvers or right-hand side operators were
+        // provided by the user are always advanced with those objects.
+        if (d_helmholtz_solvers_user_provided[l] || d_helmholtz_rhs_ops_user_provided[l])
+        {
+            if (d_enable_logging)
+            {
+                plog << d_object_name << ": "
+                     << "solving the Helmholtz system for variable number " << l
+                     << " individually because its solver or right-hand side operator was provided by the user\n";
+            }
+            continue;
+        }
+        auto it = std::find_if(groups.begin(), groups.end(), [&](const std::vector<unsigned int>& group) {
+            return haveSameHelmholtzOperator(d_Q_var[group.front()], Q_var);
+        });
+        if (it != groups.end())
+        {
+            it->push_back(l);
+        }
+        else
+        {
+            groups.push_back(std::vector<unsigned int>(1, l));
+        }
+    }
+
+    // Setup the data, operators, and solvers for each group containing more
+    // than one quantity.
+    const IntVector<NDIM> cell_ghosts = CELLG;
+    for (const auto& group : groups)
+    {
+        if (group.size() < 2) continue;
+        const int b = static_cast<int>(d_helmholtz_batch_Q_idxs.size());
+        const std::string name = "helmholtz_batch_" + std::to_string(b);
+        d_helmholtz_batch_Q_idxs.push_back(group);
+        d_helmholtz_batch_active.push_back(true);
+        d_helmholtz_batch_needs_init.push_back(true);
+
+        int depth = 0;
+        for (const auto& l : group)
+        {
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = d_Q_var[l]->getPatchDataFactory();
+            d_Q_helmholtz_batch[l] = b;
+            d_Q_helmholtz_batch_depth_offset[l] = depth;
+            depth += Q_factory->getDefaultDepth();
+        }
+
+        Pointer<CellVariable<NDIM, double> > sol_var =
+            new CellVariable<NDIM, double>(d_object_name + "::" + name + "::sol", depth);
+        int sol_scratch_idx;
+        registerVariable(sol_scratch_idx, sol_var, cell_ghosts, getScratchContext());
+        d_helmholtz_batch_sol_var.push_back(sol_var);
+
+        Pointer<CellVariable<NDIM, double> > rhs_var =
+            new CellVariable<NDIM, double>(d_object_name + "::" + name + "::rhs", depth);
+        int rhs_scratch_idx;
+        registerVariable(rhs_scratch_idx, rhs_var, cell_ghosts, getScratchContext());
+        d_helmholtz_batch_rhs_var.push_back(rhs_var);
+
+        d_helmholtz_batch_solvers.push_back(
+            CCPoissonSolverManager::getManager()->allocateSolver(d_helmholtz_solver_type,
+                                                                 d_object_name + "::helmholtz_solver::" + name,
+                                                                 d_helmholtz_solver_db,
+                                                                 "adv_diff_batch_" + std::to_string(b) + "_",
+                                                                 d_helmholtz_precond_type,
+                                                                 d_object_name + "::helmholtz_precond::" + name,
+                                                                 d_helmholtz_precond_db,
+                                                                 "adv_diff_batch_pc_" + std::to_string(b) + "_"));
+        d_helmholtz_batch_rhs_ops.push_back(
+            new CCLaplaceOperator(d_object_name + "::helmholtz_rhs_op::" + name, /*homogeneous_bc*/ false));
+
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "solving the Helmholtz systems for variable numbers";
+            for (const auto& l : group) plog << " " << l;
+            plog << " together as batch number " << b << "\n";
+        }
+    }
+    return;
+} // setupHelmholtzBatches
+
+bool
+AdvDiffSemiImplicitHierarchyIntegrator::haveSameHelmholtzOperator(Pointer<CellVariable<NDIM, double> > Q1_var,
+                                                                  Pointer<CellVariable<NDIM, double> > Q2_var)
+{
+    // No linear solve is needed when the diffusion coefficient is zero.
+    if (!isDiffusionCoefficientVariable(Q1_var) && d_Q_diffusion_coef[Q1_var] == 0.0) return false;
+    if (!isDiffusionCoefficientVariable(Q2_var) && d_Q_diffusion_coef[Q2_var] == 0.0) return false;
+    if (d_Q_diffusion_time_stepping_type[Q1_var] != d_Q_diffusion_time_stepping_type[Q2_var]) return false;
+    if (d_Q_damping_coef[Q1_var] != d_Q_damping_coef[Q2_var]) return false;
+    if (isDiffusionCoefficientVariable(Q1_var) != isDiffusionCoefficientVariable(Q2_var)) return false;
+    if (isDiffusionCoefficientVariable(Q1_var))
+    {
+        return d_Q_diffusion_coef_variable[Q1_var] == d_Q_diffusion_coef_variable[Q2_var];
+    }
+    return d_Q_diffusion_coef[Q1_var] == d_Q_diffusion_coef[Q2_var];
+} // haveSameHelmholtzOperator
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::updateActiveHelmholtzBatches()
+{
+    for (unsigned int b = 0; b < d_helmholtz_batch_Q_idxs.size(); ++b)
+    {
+        const std::vector<unsigned int>& Q_idxs = d_helmholtz_batch_Q_idxs[b];
+        Pointer<CellVariable<NDIM, double> > Q_lead_var = d_Q_var[Q_idxs.front()];
+        const bool active = std::all_of(Q_idxs.begin(), Q_idxs.end(), [&](const unsigned int l) {
+            return haveSameHelmholtzOperator(Q_lead_var, d_Q_var[l]);
+        });
+        if (active == d_helmholtz_batch_active[b]) continue;
+        if (active)
+        {
+            // The batch operator and solver were not kept up to date while the
+            // quantities were advanced individually.
+            d_helmholtz_batch_needs_init[b] = true;
+        }
+        else
+        {
+            // The operators and solvers of the individual quantities were not
+            // kept up to date while the batch was used.
+            for (const auto& l : Q_idxs)
+            {
+                d_helmholtz_rhs_ops_need_init[l] = true;
+                d_helmholtz_solvers_need_init[l] = true;
+            }
+        }
+        d_helmholtz_batch_active[b] = active;
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << (active ? "resuming" : "suspending") << " the batched Helmholtz solves for batch number " << b
+                 << "\n";
+        }
+    }
+    return;
+} // updateActiveHelmholtzBatches
+
 void
 AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -983,6 +1419,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("batch_helmholtz_solves")) d_batch_helmholtz_solves = db->getBool("batch_helmholtz_solves");
     return;
 } // getFromInput
 
@@ -39,6 +39,7 @@
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
+#include "ibtk/SinglePrecisionGhostFill.h"
 
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
@@ -50,6 +51,8 @@
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
+#include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
@@ -148,6 +151,8 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
         if (input_db->isDatabase("coarse_solver_db")) d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
+        if (input_db->keyExists("use_single_precision_ghost_fill"))
+            d_use_single_precision_ghost_fill = input_db->getBool("use_single_precision_ghost_fill");
     }
 
     // Configure the coarse level solver.
@@ -355,6 +360,18 @@ StaggeredStokesFACPreconditionerStrategy::setRestrictionMethods(const std::strin
     return;
 } // setRestrictionMethods
 
+void
+StaggeredStokesFACPreconditionerStrategy::setUseSinglePrecisionGhostFill(const bool use_single_precision_ghost_fill)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setUseSinglePrecisionGhostFill()\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    d_use_single_precision_ghost_fill = use_single_precision_ghost_fill;
+    return;
+} // setUseSinglePrecisionGhostFill
+
 void
 StaggeredStokesFACPreconditionerStrategy::setToZero(SAMRAIVectorReal<NDIM, double>& vec, int level_num)
 {
@@ -831,6 +848,23 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
     d_synch_refine_schedules[d_coarsest_ln] =
         d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(d_coarsest_ln));
 
+    if (d_use_single_precision_ghost_fill)
+    {
+        if (!d_single_precision_ghost_fill_op)
+        {
+            d_single_precision_ghost_fill_op =
+                new SinglePrecisionGhostFill(d_object_name + "::single_precision_ghost_fill");
+        }
+        std::vector<int> data_idxs(2);
+        data_idxs[0] = d_side_scratch_idx;
+        data_idxs[1] = d_cell_scratch_idx;
+        std::vector<Pointer<VariableFillPattern<NDIM> > > fill_patterns(2);
+        fill_patterns[0] = d_U_op_stencil_fill_pattern;
+        fill_patterns[1] = d_P_op_stencil_fill_pattern;
+        d_single_precision_ghost_fill_op->initializeOperatorState(
+            data_idxs, fill_patterns, d_hierarchy, d_coarsest_ln, d_finest_ln);
+    }
+
     for (int dst_ln = d_coarsest_ln; dst_ln < d_finest_ln; ++dst_ln)
     {
         d_restriction_coarsen_schedules[dst_ln] = d_restriction_coarsen_algorithm->createSchedule(
@@ -869,6 +903,17 @@ StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()
         if (level->checkAllocated(d_side_scratch_idx)) level->deallocatePatchData(d_side_scratch_idx);
         if (level->checkAllocated(d_cell_scratch_idx)) level->deallocatePatchData(d_cell_scratch_idx);
     }
+    if (d_single_precision_ghost_fill_op)
+    {
+        if (d_in_initialize_operator_state)
+        {
+            d_single_precision_ghost_fill_op->deallocateOperatorState(coarsest_reset_ln, finest_reset_ln);
+        }
+        else
+        {
+            d_single_precision_ghost_fill_op->deallocateOperatorState();
+        }
+    }
 
     // Delete the solution and rhs vectors.
     d_solution->resetLevels(d_solution->getCoarsestLevelNumber(),
@@ -987,14 +1032,35 @@ StaggeredStokesFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const std
     d_P_bc_op->setPatchDataIndex(P_dst_idx);
     d_P_bc_op->setHomogeneousBc(true);
 
-    RefineAlgorithm<NDIM> refine_alg;
-    refine_alg.registerRefine(
-        U_dst_idx, U_dst_idx, U_dst_idx, Pointer<RefineOperator<NDIM> >(), d_U_op_stencil_fill_pattern);
-    refine_alg.registerRefine(
-        P_dst_idx, P_dst_idx, P_dst_idx, Pointer<RefineOperator<NDIM> >(), d_P_op_stencil_fill_pattern);
-    refine_alg.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
-    d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_new_time);
-    d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    if (d_use_single_precision_ghost_fill)
+    {
+        // Physical boundary conditions are set in double precision once the
+        // same-level ghost cell values have been filled.
+        std::vector<int> dst_idx_vec(2);
+        dst_idx_vec[0] = U_dst_idx;
+        dst_idx_vec[1] = P_dst_idx;
+        d_single_precision_ghost_fill_op->fillData(dst_idx_vec, dst_ln, d_new_time);
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+            {
+                d_U_P_bc_op->setPhysicalBoundaryConditions(*patch, d_new_time, d_gcw);
+            }
+        }
+    }
+    else
+    {
+        RefineAlgorithm<NDIM> refine_alg;
+        refine_alg.registerRefine(
+            U_dst_idx, U_dst_idx, U_dst_idx, Pointer<RefineOperator<NDIM> >(), d_U_op_stencil_fill_pattern);
+        refine_alg.registerRefine(
+            P_dst_idx, P_dst_idx, P_dst_idx, Pointer<RefineOperator<NDIM> >(), d_P_op_stencil_fill_pattern);
+        refine_alg.resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+        d_ghostfill_nocoarse_refine_schedules[dst_ln]->fillData(d_new_time);
+        d_ghostfill_nocoarse_refine_algorithm->resetSchedule(d_ghostfill_nocoarse_refine_schedules[dst_ln]);
+    }
     return;
 } // xeqScheduleGhostFillNoCoarse
 
@@ -0,0 +1,220 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/CIBMethod.h>
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that CIBMethod::copyVecToArray() and CIBMethod::copyArrayToVec(),
+// which reuse cached scatters, move the same values as a scatter that is
+// created for every call, both before and after the Lagrangian data are
+// redistributed by a regrid.
+
+// Provides the scatter that is created for every call as a reference.
+class TestCIBMethod : public CIBMethod
+{
+public:
+    TestCIBMethod(const std::string& object_name, Pointer<Database> input_db, const int no_structures)
+        : CIBMethod(object_name, input_db, no_structures)
+    {
+    }
+
+    void referenceCopy(Vec b,
+                       double* array,
+                       const std::vector<unsigned>& struct_ids,
+                       const int data_depth,
+                       const int array_rank,
+                       const bool to_array)
+    {
+        std::vector<int> map;
+        PetscInt total_nodes = 0;
+        for (const auto struct_id : struct_ids) total_nodes += getNumberOfNodes(struct_id);
+        map.reserve(total_nodes);
+        for (const auto struct_id : struct_ids)
+        {
+            for (unsigned j = 0; j < getNumberOfNodes(struct_id); ++j)
+            {
+                map.push_back(d_struct_lag_idx_range[struct_id].first + j);
+            }
+        }
+        d_l_data_manager->mapLagrangianToPETSc(map, getStructuresLevelNumber());
+
+        const PetscInt size = total_nodes * data_depth;
+        const PetscInt array_local_size = IBTK_MPI::getRank() == array_rank ? size : 0;
+        Vec array_vec;
+        VecCreateMPIWithArray(PETSC_COMM_WORLD, 1, array_local_size, PETSC_DECIDE, array, &array_vec);
+        std::vector<PetscInt> vec_indices, array_indices;
+        for (PetscInt j = 0; j < total_nodes; ++j)
+        {
+            for (int d = 0; d < data_depth; ++d)
+            {
+                array_indices.push_back(j * data_depth + d);
+                vec_indices.push_back(map[j] * data_depth + d);
+            }
+        }
+        IS is_vec, is_array;
+        ISCreateGeneral(PETSC_COMM_SELF, size, vec_indices.data(), PETSC_COPY_VALUES, &is_vec);
+        ISCreateGeneral(PETSC_COMM_SELF, size, array_indices.data(), PETSC_COPY_VALUES, &is_array);
+        VecScatter ctx;
+        if (to_array)
+        {
+            VecScatterCreate(b, is_vec, array_vec, is_array, &ctx);
+            VecScatterBegin(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
+            VecScatterEnd(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
+        }
+        else
+        {
+            VecScatterCreate(array_vec, is_array, b, is_vec, &ctx);
+            VecScatterBegin(ctx, array_vec, b, INSERT_VALUES, SCATTER_FORWARD);
+            VecScatterEnd(ctx, array_vec, b, INSERT_VALUES, SCATTER_FORWARD);
+        }
+        VecScatterDestroy(&ctx);
+        ISDestroy(&is_vec);
+        ISDestroy(&is_array);
+        VecDestroy(&array_vec);
+        return;
+    }
+};
+
+// Return the largest difference between the values copied with the cached
+// scatters and with the reference scatter, in both directions.
+double
+compare_copies(Pointer<TestCIBMethod> ib_method_ops, const int array_rank)
+{
+    const std::vector<unsigned> struct_ids = { 0 };
+    const int size = ib_method_ops->getNumberOfNodes(0) * NDIM;
+    const bool has_array = IBTK_MPI::getRank() == array_rank;
+    const int struct_ln = ib_method_ops->getStructuresLevelNumber();
+    Vec X = ib_method_ops->getLDataManager()->getLData(LDataManager::POSN_DATA_NAME, struct_ln)->getVec();
+
+    // Copy the positions into arrays.  The cached scatter is used twice.
+    std::vector<double> array(has_array ? size : 0), array_again(array.size()), ref_array(array.size());
+    ib_method_ops->copyVecToArray(X, array.data(), struct_ids, NDIM, array_rank);
+    ib_method_ops->copyVecToArray(X, array_again.data(), struct_ids, NDIM, array_rank);
+    ib_method_ops->referenceCopy(X, ref_array.data(), struct_ids, NDIM, array_rank, /*to_array*/ true);
+    double max_diff = 0.0;
+    for (std::size_t k = 0; k < array.size(); ++k)
+    {
+        max_diff = std::max({ max_diff, std::abs(array[k] - ref_array[k]), std::abs(array_again[k] - ref_array[k]) });
+    }
+
+    // Copy an array into vectors.
+    for (std::size_t k = 0; k < array.size(); ++k) array[k] = std::sin(1.0 + k);
+    Vec b, ref_b;
+    VecDuplicate(X, &b);
+    VecDuplicate(X, &ref_b);
+    VecSet(b, 0.0);
+    VecSet(ref_b, 0.0);
+    ib_method_ops->copyArrayToVec(b, array.data(), struct_ids, NDIM, array_rank);
+    ib_method_ops->referenceCopy(ref_b, array.data(), struct_ids, NDIM, array_rank, /*to_array*/ false);
+    VecAXPY(b, -1.0, ref_b);
+    double vec_diff;
+    VecNorm(b, NORM_INFINITY, &vec_diff);
+    VecDestroy(&b);
+    VecDestroy(&ref_b);
+
+    return std::max(IBTK_MPI::maxReduction(max_diff), vec_diff);
+} // compare_copies
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // The structure file is expected in the current working directory.
+    if (IBTK_MPI::getRank() == 0)
+    {
+        std::ifstream plate_vertex_stream(SOURCE_DIR "/plate2d.vertex");
+        std::ofstream plate_vertex_cwd("plate2d.vertex");
+        plate_vertex_cwd << plate_vertex_stream.rdbuf();
+    }
+    IBTK_MPI::barrier();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cib_array_scatter_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<INSStaggeredHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<TestCIBMethod> ib_method_ops =
+            new TestCIBMethod("CIBMethod", app_initializer->getComponentDatabase("CIBMethod"), 1);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        const int last_rank = IBTK_MPI::getNodes() - 1;
+        output << "number of markers: " << ib_method_ops->getNumberOfNodes(0) << '\n';
+        output << "max difference with array on the first rank: " << compare_copies(ib_method_ops, 0) << '\n';
+        output << "max difference with array on the last rank: " << compare_copies(ib_method_ops, last_rank) << '\n';
+
+        // The cached scatters must be rebuilt after the Lagrangian data are
+        // redistributed.
+        time_integrator->regridHierarchy();
+        output << "max difference after regridding: " << compare_copies(ib_method_ops, 0) << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
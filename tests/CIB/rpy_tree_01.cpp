@@ -0,0 +1,127 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/MobilityFunctions.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Compare the tree code approximation of the RPY mobility operator with the
+// product of the dense RPY mobility matrix and a force vector, and verify that
+// dividing the target markers among processes gives the same velocities as a
+// serial evaluation.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "rpy_tree_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const std::string kernel_fcn = input_db->getString("IB_DELTA_FUNCTION");
+        const int num_nodes = input_db->getInteger("NUM_MARKERS");
+        const double mu = input_db->getDouble("MU");
+        const double dx = input_db->getDouble("DX");
+        const double periodic_correction = input_db->getDouble("PERIODIC_CORRECTION");
+        const double opening_angle = input_db->getDouble("OPENING_ANGLE");
+        const int size = num_nodes * NDIM;
+
+        // Every process generates the same markers and forces.
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::vector<double> X(size), F(size);
+        for (int i = 0; i < size; ++i)
+        {
+            X[i] = unit(generator);
+            F[i] = 2.0 * unit(generator) - 1.0;
+        }
+
+        // Dense matrix-vector product.  The matrix is stored in column-major
+        // order.
+        std::vector<double> MM(static_cast<std::size_t>(size) * size);
+        MobilityFunctions::constructRPYMobilityMatrix(
+            kernel_fcn.c_str(), mu, dx, X.data(), num_nodes, periodic_correction, MM.data());
+        std::vector<double> U_dense(size, 0.0);
+        for (int col = 0; col < size; ++col)
+        {
+            for (int row = 0; row < size; ++row)
+            {
+                U_dense[row] += MM[static_cast<std::size_t>(col) * size + row] * F[col];
+            }
+        }
+
+        // Tree code evaluated for all targets on every process.
+        std::vector<double> U_tree(size, 0.0);
+        MobilityFunctions::applyRPYMobilityOperator(
+            kernel_fcn.c_str(), mu, dx, X.data(), num_nodes, periodic_correction, opening_angle, F.data(), U_tree.data());
+
+        // Tree code with the targets divided among the processes.
+        const int rank = IBTK_MPI::getRank();
+        const int nodes = IBTK_MPI::getNodes();
+        std::vector<double> U_dist(size, 0.0);
+        MobilityFunctions::applyRPYMobilityOperator(kernel_fcn.c_str(),
+                                                    mu,
+                                                    dx,
+                                                    X.data(),
+                                                    num_nodes,
+                                                    periodic_correction,
+                                                    opening_angle,
+                                                    F.data(),
+                                                    U_dist.data(),
+                                                    (num_nodes * rank) / nodes,
+                                                    (num_nodes * (rank + 1)) / nodes);
+        IBTK_MPI::sumReduction(U_dist.data(), size);
+
+        double U_norm = 0.0, error_norm = 0.0, max_dist_diff = 0.0;
+        for (int i = 0; i < size; ++i)
+        {
+            U_norm += U_dense[i] * U_dense[i];
+            error_norm += (U_tree[i] - U_dense[i]) * (U_tree[i] - U_dense[i]);
+            max_dist_diff = std::max(max_dist_diff, std::abs(U_dist[i] - U_tree[i]));
+        }
+        const double rel_error = std::sqrt(error_norm / U_norm);
+        plog << "relative l2 error of the tree code: " << rel_error << '\n';
+
+        std::ofstream output;
+        if (rank == 0) output.open("output");
+        if (opening_angle == 0.0)
+        {
+            output << "relative l2 error of the tree code: " << rel_error << '\n';
+        }
+        else
+        {
+            const double tol = input_db->getDouble("ERROR_TOLERANCE");
+            output << "relative l2 error of the tree code is below " << tol << ": "
+                   << (rel_error < tol ? "true" : "false") << '\n';
+        }
+        output << "max difference between distributed and serial evaluation: " << max_dist_diff << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
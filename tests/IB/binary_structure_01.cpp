@@ -0,0 +1,274 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBStandardInitializer.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that a structure written in the binary structure file format is read
+// back with exactly the same data as the equivalent ASCII input files, and that
+// files whose spring records are shorter than their parameters or that end
+// before their last section are rejected.
+
+// A small closed ring of vertices connected by springs, with target points at
+// every fourth vertex.
+struct Ring
+{
+    std::vector<std::array<double, NDIM> > vertices;
+    std::vector<std::array<int, 3> > springs; // idx0, idx1, force_fcn_idx
+    std::vector<std::array<double, 3> > spring_params; // kappa, rest length, extra parameter
+    std::vector<int> targets;
+    std::vector<std::array<double, 2> > target_params; // kappa, eta
+};
+
+Ring
+make_ring(const int num_vertices)
+{
+    Ring ring;
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_vertices;
+        std::array<double, NDIM> X;
+        X.fill(0.5);
+        X[0] += 0.25 * std::cos(theta);
+        X[1] += 0.25 * std::sin(theta);
+        ring.vertices.push_back(X);
+
+        // Odd springs use a third parameter and a different force function so
+        // that variable-length spring records are exercised.
+        ring.springs.push_back({ { k, (k + 1) % num_vertices, k % 2 } });
+        ring.spring_params.push_back({ { 1.0 + 0.1 * k, 0.5 * M_PI / num_vertices, k % 2 ? 0.25 * k : 0.0 } });
+
+        if (k % 4 == 0)
+        {
+            ring.targets.push_back(k);
+            ring.target_params.push_back({ { 10.0 + k, 0.125 * k } });
+        }
+    }
+    return ring;
+} // make_ring
+
+void
+write_ascii_files(const std::string& base_filename, const Ring& ring)
+{
+    std::ofstream vertex_stream(base_filename + ".vertex");
+    vertex_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    vertex_stream << ring.vertices.size() << "\n";
+    for (const auto& X : ring.vertices)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d) vertex_stream << X[d] << (d + 1 < NDIM ? " " : "\n");
+    }
+
+    std::ofstream spring_stream(base_filename + ".spring");
+    spring_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    spring_stream << ring.springs.size() << "\n";
+    for (unsigned int k = 0; k < ring.springs.size(); ++k)
+    {
+        spring_stream << ring.springs[k][0] << " " << ring.springs[k][1] << " " << ring.spring_params[k][0] << " "
+                      << ring.spring_params[k][1] << " " << ring.springs[k][2];
+        if (ring.springs[k][2] == 1) spring_stream << " " << ring.spring_params[k][2];
+        spring_stream << "\n";
+    }
+
+    std::ofstream target_stream(base_filename + ".target");
+    target_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    target_stream << ring.targets.size() << "\n";
+    for (unsigned int k = 0; k < ring.targets.size(); ++k)
+    {
+        target_stream << ring.targets[k] << " " << ring.target_params[k][0] << " " << ring.target_params[k][1] << "\n";
+    }
+    return;
+} // write_ascii_files
+
+template <typename T>
+void
+write_value(std::vector<char>& buf, const T value)
+{
+    const char* const bytes = reinterpret_cast<const char*>(&value);
+    buf.insert(buf.end(), bytes, bytes + sizeof(T));
+    return;
+} // write_value
+
+// Write the ring in the binary structure file format.  If spring_record_size
+// is positive, it replaces the size of the spring records that is stored in
+// the section table.  If num_truncated_bytes is positive, that many bytes are
+// dropped from the end of the file.
+void
+write_binary_file(const std::string& filename,
+                  const Ring& ring,
+                  const std::int64_t spring_record_size = 0,
+                  const int num_truncated_bytes = 0)
+{
+    const std::int32_t num_spring_params = 3;
+    std::vector<char> vertex_data, spring_data, target_data;
+    for (const auto& X : ring.vertices)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d) write_value<double>(vertex_data, X[d]);
+    }
+    for (unsigned int k = 0; k < ring.springs.size(); ++k)
+    {
+        write_value<std::int32_t>(spring_data, ring.springs[k][0]);
+        write_value<std::int32_t>(spring_data, ring.springs[k][1]);
+        write_value<std::int32_t>(spring_data, ring.springs[k][2]);
+        write_value<std::int32_t>(spring_data, ring.springs[k][2] == 1 ? 3 : 2);
+        for (int p = 0; p < num_spring_params; ++p) write_value<double>(spring_data, ring.spring_params[k][p]);
+    }
+    for (unsigned int k = 0; k < ring.targets.size(); ++k)
+    {
+        write_value<std::int32_t>(target_data, ring.targets[k]);
+        write_value<std::int32_t>(target_data, 0);
+        write_value<double>(target_data, ring.target_params[k][0]);
+        write_value<double>(target_data, ring.target_params[k][1]);
+    }
+
+    std::vector<char> file_data;
+    const char magic[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+    file_data.insert(file_data.end(), magic, magic + 8);
+    write_value<std::int32_t>(file_data, 1);    // version
+    write_value<std::int32_t>(file_data, NDIM); // ndim
+    write_value<std::int32_t>(file_data, 3);    // num_sections
+    write_value<std::int32_t>(file_data, 0);    // reserved
+    std::int64_t offset = 24 + 3 * 32;
+    auto write_section = [&](const std::int32_t type,
+                             const std::int32_t num_params,
+                             const std::int64_t num_records,
+                             const std::int64_t record_size,
+                             const std::vector<char>& data) {
+        write_value<std::int32_t>(file_data, type);
+        write_value<std::int32_t>(file_data, num_params);
+        write_value<std::int64_t>(file_data, num_records);
+        write_value<std::int64_t>(file_data, offset);
+        write_value<std::int64_t>(file_data, record_size);
+        offset += data.size();
+    };
+    write_section(1, 0, ring.vertices.size(), NDIM * sizeof(double), vertex_data);
+    write_section(2,
+                  num_spring_params,
+                  ring.springs.size(),
+                  spring_record_size > 0 ? spring_record_size : 16 + 8 * num_spring_params,
+                  spring_data);
+    write_section(6, 0, ring.targets.size(), 24, target_data);
+    file_data.insert(file_data.end(), vertex_data.begin(), vertex_data.end());
+    file_data.insert(file_data.end(), spring_data.begin(), spring_data.end());
+    file_data.insert(file_data.end(), target_data.begin(), target_data.end());
+    file_data.resize(file_data.size() - num_truncated_bytes);
+
+    std::ofstream file_stream(filename, std::ios::out | std::ios::binary);
+    file_stream.write(file_data.data(), file_data.size());
+    return;
+} // write_binary_file
+
+// Provides access to the structure data that were read by the initializer.
+class StructureReader : public IBStandardInitializer
+{
+public:
+    StructureReader(const std::string& object_name, Pointer<Database> input_db)
+        : IBStandardInitializer(object_name, input_db)
+    {
+        init();
+    }
+
+    bool verticesAgree(const StructureReader& that) const
+    {
+        return d_num_vertex == that.d_num_vertex && d_vertex_posn == that.d_vertex_posn;
+    }
+
+    bool springsAgree(const StructureReader& that) const
+    {
+        if (d_spring_edge_map != that.d_spring_edge_map) return false;
+        const auto& springs = d_spring_spec_data[0][0];
+        const auto& that_springs = that.d_spring_spec_data[0][0];
+        if (springs.size() != that_springs.size()) return false;
+        for (auto it = springs.begin(), that_it = that_springs.begin(); it != springs.end(); ++it, ++that_it)
+        {
+            if (it->first != that_it->first || it->second.parameters != that_it->second.parameters ||
+                it->second.force_fcn_idx != that_it->second.force_fcn_idx)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool targetPointsAgree(const StructureReader& that) const
+    {
+        const auto& targets = d_target_spec_data[0][0];
+        const auto& that_targets = that.d_target_spec_data[0][0];
+        if (targets.size() != that_targets.size()) return false;
+        for (unsigned int k = 0; k < targets.size(); ++k)
+        {
+            if (targets[k].stiffness != that_targets[k].stiffness || targets[k].damping != that_targets[k].damping)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "binary_structure_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const Ring ring = make_ring(input_db->getInteger("NUM_VERTICES"));
+        if (IBTK_MPI::getRank() == 0)
+        {
+            write_ascii_files("ring", ring);
+            write_binary_file("ring.ibstruct", ring);
+            write_binary_file("ring_short_records.ibstruct", ring, /*spring_record_size*/ 16);
+            write_binary_file("ring_truncated.ibstruct", ring, 0, /*num_truncated_bytes*/ 8);
+        }
+        IBTK_MPI::barrier();
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        auto check = [](const std::string& filename) {
+            return IBStandardInitializer::checkBinaryStructureFile(filename).empty() ? "accepted" : "rejected";
+        };
+        output << "binary file: " << check("ring.ibstruct") << "\n";
+        output << "binary file with short spring records: " << check("ring_short_records.ibstruct") << "\n";
+        output << "truncated binary file: " << check("ring_truncated.ibstruct") << "\n";
+
+        StructureReader ascii_reader("ASCIIInitializer", app_initializer->getComponentDatabase("ASCIIInitializer"));
+        StructureReader binary_reader("BinaryInitializer", app_initializer->getComponentDatabase("BinaryInitializer"));
+        output << "vertices agree: " << (binary_reader.verticesAgree(ascii_reader) ? "true" : "false") << "\n";
+        output << "springs agree: " << (binary_reader.springsAgree(ascii_reader) ? "true" : "false") << "\n";
+        output << "target points agree: " << (binary_reader.targetPointsAgree(ascii_reader) ? "true" : "false")
+               << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,289 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <boost/multi_array.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify the Lagrangian force computed by IBStandardForceGen, which computes
+// the target point forces while the ghost values of the positions required by
+// the spring forces are communicated, against a force that is computed
+// directly from the positions of all nodes.
+
+// An elliptical ring of springs with target points at every third node.
+int finest_ln;
+int num_nodes;
+double spring_stiffness, spring_rest_length, target_stiffness;
+
+void
+initial_position(const int k, IBTK::Point& X)
+{
+    const double theta = 2.0 * M_PI * k / num_nodes;
+    X.setConstant(0.5);
+    X(0) += 0.3 * std::cos(theta);
+    X(1) += 0.2 * std::sin(theta);
+    return;
+} // initial_position
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = ln == finest_ln ? num_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k) initial_position(k, vertex_posn[k]);
+    return;
+} // generate_structure
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::Edge e;
+        e.first = k;
+        e.second = (k + 1) % num_nodes;
+        if (e.first > e.second) std::swap(e.first, e.second);
+        spring_map.insert(std::make_pair(e.first, e));
+        IBRedundantInitializer::SpringSpec spec_data;
+        spec_data.parameters = { spring_stiffness, spring_rest_length };
+        spec_data.force_fcn_idx = 0;
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+void
+generate_targets(const unsigned int& /*strct_num*/,
+                 const int& ln,
+                 std::multimap<int, IBRedundantInitializer::TargetSpec>& tg_pt_spec)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; k += 3)
+    {
+        IBRedundantInitializer::TargetSpec spec_data;
+        spec_data.stiffness = target_stiffness;
+        spec_data.damping = 0.0;
+        tg_pt_spec.insert(std::make_pair(k, spec_data));
+    }
+    return;
+} // generate_targets
+
+// Provides access to the current Lagrangian data.
+class TestIBMethod : public IBMethod
+{
+public:
+    using IBMethod::IBMethod;
+
+    Pointer<LData> getCurrentPositionData(const int ln)
+    {
+        return d_X_current_data[ln];
+    }
+
+    Pointer<LData> getCurrentForceData(const int ln)
+    {
+        return d_F_current_data[ln];
+    }
+};
+
+// Copy the values of the local nodes into an array that is indexed by the
+// Lagrangian indices and is assembled on every process.
+std::vector<double>
+gather_lagrangian_values(Pointer<LData> data, Pointer<LMesh> mesh)
+{
+    std::vector<double> vals(num_nodes * NDIM, 0.0);
+    const boost::multi_array_ref<double, 2>& local_vals = *data->getLocalFormVecArray();
+    for (const LNode* const node : mesh->getLocalNodes())
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            vals[node->getLagrangianIndex() * NDIM + d] = local_vals[node->getLocalPETScIndex()][d];
+        }
+    }
+    data->restoreArrays();
+    IBTK_MPI::sumReduction(vals.data(), static_cast<int>(vals.size()));
+    return vals;
+} // gather_lagrangian_values
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "overlap_force_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_nodes = input_db->getInteger("NUM_NODES");
+        spring_stiffness = input_db->getDouble("SPRING_STIFFNESS");
+        spring_rest_length = input_db->getDouble("SPRING_REST_LENGTH");
+        target_stiffness = input_db->getDouble("TARGET_STIFFNESS");
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<TestIBMethod> ib_method_ops =
+            new TestIBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "ring" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitSpringDataFunction(generate_springs);
+        ib_initializer->registerInitTargetPtFunction(generate_targets);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        const double current_time = time_integrator->getIntegratorTime();
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->preprocessIntegrateHierarchy(current_time, current_time + dt, 1);
+
+        // Displace the nodes from the target points and recompute the force.
+        const int ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<LMesh> mesh = ib_method_ops->getLDataManager()->getLMesh(ln);
+        Pointer<LData> X_data = ib_method_ops->getCurrentPositionData(ln);
+        {
+            boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+            for (const LNode* const node : mesh->getLocalNodes())
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[node->getLocalPETScIndex()][d] += 0.01 * std::sin(7.0 * node->getLagrangianIndex() + d);
+                }
+            }
+            X_data->restoreArrays();
+        }
+        ib_method_ops->computeLagrangianForce(current_time);
+
+        // Compute the force directly.
+        const std::vector<double> X = gather_lagrangian_values(X_data, mesh);
+        const std::vector<double> F = gather_lagrangian_values(ib_method_ops->getCurrentForceData(ln), mesh);
+        std::vector<double> F_ref(num_nodes * NDIM, 0.0);
+        for (int k = 0; k < num_nodes; ++k)
+        {
+            const int mastr = std::min(k, (k + 1) % num_nodes), slave = std::max(k, (k + 1) % num_nodes);
+            double D[NDIM], R = 0.0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                D[d] = X[slave * NDIM + d] - X[mastr * NDIM + d];
+                R += D[d] * D[d];
+            }
+            R = std::sqrt(R);
+            const double T = spring_stiffness * (R - spring_rest_length);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F_ref[mastr * NDIM + d] += T / R * D[d];
+                F_ref[slave * NDIM + d] -= T / R * D[d];
+            }
+        }
+        double max_target_force = 0.0;
+        for (int k = 0; k < num_nodes; k += 3)
+        {
+            IBTK::Point X0;
+            initial_position(k, X0);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                const double F_target = target_stiffness * (X0(d) - X[k * NDIM + d]);
+                F_ref[k * NDIM + d] += F_target;
+                max_target_force = std::max(max_target_force, std::abs(F_target));
+            }
+        }
+        double max_F_ref = 0.0, max_diff = 0.0;
+        for (int i = 0; i < num_nodes * NDIM; ++i)
+        {
+            max_F_ref = std::max(max_F_ref, std::abs(F_ref[i]));
+            max_diff = std::max(max_diff, std::abs(F[i] - F_ref[i]));
+        }
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        output << "number of nodes: " << num_nodes << '\n';
+        output << "target point force is nonzero: " << (max_target_force > 0.0 ? "true" : "false") << '\n';
+        output << "max relative difference of the force: " << max_diff / max_F_ref << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,239 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the linear spring kernel of IBStandardForceGen, which reads the
+// stiffnesses and rest lengths from contiguous arrays, computes the same
+// solution as the generic path that calls a registered spring force function
+// through a pointer for every spring.
+
+// An elliptical ring of springs that relaxes towards a circle.
+int finest_ln;
+int num_nodes;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = ln == finest_ln ? num_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_vertices;
+        IBTK::Point& X = vertex_posn[k];
+        X.setConstant(0.5);
+        X(0) += 0.3 * std::cos(theta);
+        X(1) += 0.2 * std::sin(theta);
+    }
+    return;
+} // generate_structure
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    if (ln != finest_ln) return;
+    const double ds = 2.0 * M_PI * 0.25 / num_nodes;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::Edge e;
+        e.first = k;
+        e.second = (k + 1) % num_nodes;
+        if (e.first > e.second) std::swap(e.first, e.second);
+        spring_map.insert(std::make_pair(e.first, e));
+        IBRedundantInitializer::SpringSpec spec_data;
+        spec_data.parameters = { 1.0 / ds, 0.5 * ds }; // spring constant, resting length
+        spec_data.force_fcn_idx = 0;
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+// The linear spring force law, registered under its own address so that
+// IBStandardForceGen evaluates it through the function pointer.
+double
+generic_linear_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    return params[0] * (R - params[1]);
+} // generic_linear_spring_force
+
+struct SimulationResults
+{
+    std::vector<double> X;
+    double U_max_norm, U_l2_norm;
+};
+
+// Run the simulation with all objects prefixed by the specified name and
+// return the final structure positions and velocity norms.
+SimulationResults
+run_simulation(Pointer<AppInitializer> app_initializer, const std::string& prefix, const bool use_generic_path)
+{
+    Pointer<Database> ib_db = app_initializer->getComponentDatabase("IBHierarchyIntegrator");
+
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator(prefix + "::INSStaggeredHierarchyIntegrator",
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            false);
+    Pointer<IBMethod> ib_method_ops =
+        new IBMethod(prefix + "::IBMethod", app_initializer->getComponentDatabase("IBMethod"), false);
+    Pointer<IBHierarchyIntegrator> time_integrator = new IBExplicitHierarchyIntegrator(
+        prefix + "::IBHierarchyIntegrator", ib_db, ib_method_ops, navier_stokes_integrator, false);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        prefix + "::CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(prefix + "::PatchHierarchy", grid_geometry, false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(prefix + "::StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>(prefix + "::LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(prefix + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Configure the IB solver.
+    Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+        prefix + "::IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+    ib_initializer->setStructureNamesOnLevel(finest_ln, { "ring" });
+    ib_initializer->registerInitStructureFunction(generate_structure);
+    ib_initializer->registerInitSpringDataFunction(generate_springs);
+    ib_method_ops->registerLInitStrategy(ib_initializer);
+    Pointer<IBStandardForceGen> ib_force_fcn =
+        new IBStandardForceGen(app_initializer->getComponentDatabase("IBStandardForceGen"));
+    if (use_generic_path) ib_force_fcn->registerSpringForceFunction(0, &generic_linear_spring_force);
+    ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+    // Initialize the patch hierarchy and advance the solution.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    ib_method_ops->freeLInitStrategy();
+    ib_initializer.setNull();
+
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+
+    // Collect the results. Both simulations use the same partitioning, so the
+    // locally owned structure positions can be compared directly.
+    SimulationResults results;
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Pointer<LData> X_data = ib_method_ops->getLDataManager()->getLData(LDataManager::POSN_DATA_NAME, ln);
+    Vec X_vec = X_data->getVec();
+    PetscInt local_size;
+    VecGetLocalSize(X_vec, &local_size);
+    const double* X_vals;
+    VecGetArrayRead(X_vec, &X_vals);
+    results.X.assign(X_vals, X_vals + local_size);
+    VecRestoreArrayRead(X_vec, &X_vals);
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int u_idx = var_db->mapVariableAndContextToIndex(navier_stokes_integrator->getVelocityVariable(),
+                                                           navier_stokes_integrator->getCurrentContext());
+    HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy);
+    results.U_max_norm = hier_sc_data_ops.maxNorm(u_idx);
+    results.U_l2_norm = hier_sc_data_ops.L2Norm(u_idx);
+    return results;
+} // run_simulation
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "spring_force_kernel_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_nodes = input_db->getInteger("NUM_NODES");
+
+        const SimulationResults linear = run_simulation(app_initializer, "Linear", false);
+        const SimulationResults generic = run_simulation(app_initializer, "Generic", true);
+
+        int X_sizes_agree = linear.X.size() == generic.X.size();
+        double max_X_diff = 0.0;
+        for (std::size_t k = 0; X_sizes_agree && k < linear.X.size(); ++k)
+        {
+            max_X_diff = std::max(max_X_diff, std::abs(linear.X[k] - generic.X[k]));
+        }
+        X_sizes_agree = IBTK_MPI::minReduction(X_sizes_agree);
+        max_X_diff = IBTK_MPI::maxReduction(max_X_diff);
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        output << "velocity is nonzero: " << (linear.U_max_norm > 0.0 ? "true" : "false") << '\n';
+        output << "structure sizes agree: " << (X_sizes_agree ? "true" : "false") << '\n';
+        output << "max position difference: " << max_X_diff << '\n';
+        output << "relative velocity max-norm difference: "
+               << std::abs(linear.U_max_norm - generic.U_max_norm) / linear.U_max_norm << '\n';
+        output << "relative velocity L2-norm difference: "
+               << std::abs(linear.U_l2_norm - generic.U_l2_norm) / linear.U_l2_norm << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
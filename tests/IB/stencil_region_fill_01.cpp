@@ -0,0 +1,237 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that restricting the velocity ghost cell filling to the regions in
+// which IBMethod interpolates (use_stencil_region_ghost_fill = TRUE) yields
+// the same interpolated velocities and structure positions as filling all
+// ghost cells, including across regrids and processor boundaries.
+
+// An elliptical ring of springs that relaxes towards a circle.
+int finest_ln;
+int num_nodes;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    num_vertices = ln == finest_ln ? num_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_vertices;
+        IBTK::Point& X = vertex_posn[k];
+        X.setConstant(0.5);
+        X(0) += 0.3 * std::cos(theta);
+        X(1) += 0.2 * std::sin(theta);
+    }
+    return;
+} // generate_structure
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    if (ln != finest_ln) return;
+    const double ds = 2.0 * M_PI * 0.25 / num_nodes;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::Edge e;
+        e.first = k;
+        e.second = (k + 1) % num_nodes;
+        if (e.first > e.second) std::swap(e.first, e.second);
+        spring_map.insert(std::make_pair(e.first, e));
+        IBRedundantInitializer::SpringSpec spec_data;
+        spec_data.parameters = { 1.0 / ds, 0.0 }; // spring constant, resting length
+        spec_data.force_fcn_idx = 0;
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+struct SimulationResults
+{
+    std::vector<double> X, U;
+    int num_regrids;
+};
+
+// Copy the locally owned values of the specified Lagrangian quantity.
+std::vector<double>
+get_local_values(LDataManager* l_data_manager, const std::string& quantity_name, const int ln)
+{
+    Vec vec = l_data_manager->getLData(quantity_name, ln)->getVec();
+    PetscInt local_size;
+    VecGetLocalSize(vec, &local_size);
+    const double* vals;
+    VecGetArrayRead(vec, &vals);
+    std::vector<double> local_values(vals, vals + local_size);
+    VecRestoreArrayRead(vec, &vals);
+    return local_values;
+} // get_local_values
+
+// Run the simulation with all objects prefixed by the specified name and
+// return the final structure positions and interpolated velocities.
+SimulationResults
+run_simulation(Pointer<AppInitializer> app_initializer, const std::string& prefix, const bool use_stencil_region)
+{
+    Pointer<Database> ib_db = app_initializer->getComponentDatabase("IBHierarchyIntegrator");
+    ib_db->putBool("use_stencil_region_ghost_fill", use_stencil_region);
+
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator(prefix + "::INSStaggeredHierarchyIntegrator",
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            false);
+    Pointer<IBMethod> ib_method_ops =
+        new IBMethod(prefix + "::IBMethod", app_initializer->getComponentDatabase("IBMethod"), false);
+    Pointer<IBHierarchyIntegrator> time_integrator = new IBExplicitHierarchyIntegrator(
+        prefix + "::IBHierarchyIntegrator", ib_db, ib_method_ops, navier_stokes_integrator, false);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        prefix + "::CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(prefix + "::PatchHierarchy", grid_geometry, false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(prefix + "::StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>(prefix + "::LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(prefix + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Configure the IB solver.
+    Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+        prefix + "::IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+    ib_initializer->setStructureNamesOnLevel(finest_ln, { "ring" });
+    ib_initializer->registerInitStructureFunction(generate_structure);
+    ib_initializer->registerInitSpringDataFunction(generate_springs);
+    ib_method_ops->registerLInitStrategy(ib_initializer);
+    Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+    ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+    // Initialize the patch hierarchy and advance the solution.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    ib_method_ops->freeLInitStrategy();
+    ib_initializer.setNull();
+
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    int num_regrids = 0;
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        if (time_integrator->atRegridPoint()) ++num_regrids;
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+
+    // Collect the results. Both simulations use the same partitioning, so the
+    // locally owned Lagrangian values can be compared directly.
+    SimulationResults results;
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    results.X = get_local_values(ib_method_ops->getLDataManager(), LDataManager::POSN_DATA_NAME, ln);
+    results.U = get_local_values(ib_method_ops->getLDataManager(), LDataManager::VEL_DATA_NAME, ln);
+    results.num_regrids = num_regrids;
+    return results;
+} // run_simulation
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stencil_region_fill_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_nodes = input_db->getInteger("NUM_NODES");
+
+        const SimulationResults full = run_simulation(app_initializer, "FullGhostFill", false);
+        const SimulationResults restricted = run_simulation(app_initializer, "StencilRegionGhostFill", true);
+
+        // Compare the locally owned values on each process.
+        const auto max_difference = [](const std::vector<double>& a, const std::vector<double>& b) {
+            if (a.size() != b.size()) return std::numeric_limits<double>::max();
+            double max_diff = 0.0;
+            for (std::size_t k = 0; k < a.size(); ++k) max_diff = std::max(max_diff, std::abs(a[k] - b[k]));
+            return max_diff;
+        };
+        const double max_X_diff = IBTK_MPI::maxReduction(max_difference(full.X, restricted.X));
+        const double max_U_diff = IBTK_MPI::maxReduction(max_difference(full.U, restricted.U));
+        double max_U = 0.0;
+        for (const double u : full.U) max_U = std::max(max_U, std::abs(u));
+        max_U = IBTK_MPI::maxReduction(max_U);
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        output << "hierarchy was regridded: " << (full.num_regrids > 0 ? "true" : "false") << '\n';
+        output << "interpolated velocity is nonzero: " << (max_U > 0.0 ? "true" : "false") << '\n';
+        output << "max difference of the interpolated velocities: " << max_U_diff << '\n';
+        output << "max difference of the structure positions: " << max_X_diff << '\n';
+        plog << "number of regrids: " << full.num_regrids << " " << restricted.num_regrids << '\n';
+        plog << "max interpolated velocity: " << max_U << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,205 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBStandardInitializer.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the structure cache of IBStandardInitializer round-trips: the
+// data loaded from a cache agree with the data parsed from the input files, a
+// cache is only read with the key it was written with, and a cache written
+// for different input files is ignored.
+
+// Write a closed ring of vertices connected by springs, with target points at
+// every fourth vertex.
+void
+write_ring(const std::string& base_filename, const int num_vertices, const double radius)
+{
+    std::ofstream vertex_stream(base_filename + ".vertex");
+    vertex_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    vertex_stream << num_vertices << "\n";
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_vertices;
+        vertex_stream << 0.5 + radius * std::cos(theta) << " " << 0.5 + radius * std::sin(theta);
+        for (int d = 2; d < NDIM; ++d) vertex_stream << " " << 0.5;
+        vertex_stream << "\n";
+    }
+
+    std::ofstream spring_stream(base_filename + ".spring");
+    spring_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    spring_stream << num_vertices << "\n";
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        spring_stream << k << " " << (k + 1) % num_vertices << " " << 1.0 + 0.1 * k << " "
+                      << 2.0 * M_PI * radius / num_vertices << "\n";
+    }
+
+    std::ofstream target_stream(base_filename + ".target");
+    target_stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    target_stream << (num_vertices + 3) / 4 << "\n";
+    for (int k = 0; k < num_vertices; k += 4)
+    {
+        target_stream << k << " " << 10.0 + k << " " << 0.125 * k << "\n";
+    }
+    return;
+} // write_ring
+
+// Provides access to the structure data that were read by the initializer.
+class StructureReader : public IBStandardInitializer
+{
+public:
+    StructureReader(const std::string& object_name, Pointer<Database> input_db)
+        : IBStandardInitializer(object_name, input_db)
+    {
+        init();
+    }
+
+    bool dataAgree(const StructureReader& that) const
+    {
+        if (d_num_vertex != that.d_num_vertex || d_vertex_posn != that.d_vertex_posn) return false;
+        if (d_spring_edge_map != that.d_spring_edge_map) return false;
+        const auto& springs = d_spring_spec_data[0][0];
+        const auto& that_springs = that.d_spring_spec_data[0][0];
+        if (springs.size() != that_springs.size()) return false;
+        for (auto it = springs.begin(), that_it = that_springs.begin(); it != springs.end(); ++it, ++that_it)
+        {
+            if (it->first != that_it->first || it->second.parameters != that_it->second.parameters ||
+                it->second.force_fcn_idx != that_it->second.force_fcn_idx)
+            {
+                return false;
+            }
+        }
+        const auto& targets = d_target_spec_data[0][0];
+        const auto& that_targets = that.d_target_spec_data[0][0];
+        if (targets.size() != that_targets.size()) return false;
+        for (unsigned int k = 0; k < targets.size(); ++k)
+        {
+            if (targets[k].stiffness != that_targets[k].stiffness || targets[k].damping != that_targets[k].damping)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Discard the vertex, spring and target point data and read them again
+    // from the cache with the given key.
+    bool reloadFromCache(const std::string& filename, const std::string& key)
+    {
+        for (auto& X : d_vertex_posn[0][0]) X.setZero();
+        d_spring_edge_map[0][0].clear();
+        d_spring_spec_data[0][0].clear();
+        d_target_spec_data[0][0].clear();
+        return readStructureCache(filename, key);
+    }
+};
+
+// Read the key that is stored in the header of a structure cache file: an
+// eight character magic string, the format version and the spatial dimension
+// followed by the length of the key and the key itself.
+std::string
+read_cache_key(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::in | std::ios::binary);
+    char magic[8];
+    std::int32_t version = 0, ndim = 0;
+    std::uint64_t key_size = 0;
+    is.read(magic, sizeof(magic));
+    is.read(reinterpret_cast<char*>(&version), sizeof(version));
+    is.read(reinterpret_cast<char*>(&ndim), sizeof(ndim));
+    is.read(reinterpret_cast<char*>(&key_size), sizeof(key_size));
+    std::string key(key_size, '\0');
+    is.read(&key[0], key_size);
+    return is ? key : std::string();
+} // read_cache_key
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "structure_cache_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> scratch_db = app_initializer->getComponentDatabase("ScratchInitializer");
+        Pointer<Database> cache_db = app_initializer->getComponentDatabase("CacheInitializer");
+        const std::string cache_filename = cache_db->getString("structure_cache_filename");
+        const int num_vertices = input_db->getInteger("NUM_VERTICES");
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            write_ring("ring", num_vertices, 0.25);
+            std::remove(cache_filename.c_str());
+        }
+        IBTK_MPI::barrier();
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+
+        // The first initializer that uses the cache writes it.
+        StructureReader parsed_reader("ScratchInitializer", scratch_db);
+        StructureReader writing_reader("CacheInitializer", cache_db);
+        IBTK_MPI::barrier();
+        output << "cache file written: " << (std::ifstream(cache_filename).good() ? "true" : "false") << "\n";
+        output << "data of the writing initializer agree with parsed data: "
+               << (writing_reader.dataAgree(parsed_reader) ? "true" : "false") << "\n";
+
+        // The second one loads the cached data.
+        StructureReader loading_reader("CacheInitializer", cache_db);
+        output << "data loaded from the cache agree with parsed data: "
+               << (loading_reader.dataAgree(parsed_reader) ? "true" : "false") << "\n";
+
+        // Read the cache again explicitly, so that the data cannot have come
+        // from the input files.
+        const std::string key = read_cache_key(cache_filename);
+        output << "cache read with a different key: "
+               << (loading_reader.reloadFromCache(cache_filename, key + "modified") ? "true" : "false") << "\n";
+        output << "cache read with its key: "
+               << (loading_reader.reloadFromCache(cache_filename, key) ? "true" : "false") << "\n";
+        output << "reloaded data agree with parsed data: "
+               << (loading_reader.dataAgree(parsed_reader) ? "true" : "false") << "\n";
+
+        // A cache written for other input files must be ignored.
+        if (IBTK_MPI::getRank() == 0) write_ring("ring", num_vertices, 0.3);
+        IBTK_MPI::barrier();
+        StructureReader modified_parsed_reader("ScratchInitializer", scratch_db);
+        StructureReader modified_cache_reader("CacheInitializer", cache_db);
+        output << "stale cache ignored: "
+               << (modified_cache_reader.dataAgree(modified_parsed_reader) &&
+                           !modified_cache_reader.dataAgree(parsed_reader) ?
+                       "true" :
+                       "false")
+               << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
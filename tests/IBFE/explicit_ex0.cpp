@@ -94,6 +94,36 @@ PK1_stress_function(TensorValue<double>& PP,
     }
     return;
 } // PK1_stress_function
+
+// Batched version of PK1_stress_function(), which evaluates the stress at all
+// quadrature points of an element at once.
+void
+PK1_stress_batch_function(double* PP,
+                          const double* FF,
+                          const double* /*X*/,
+                          const double* /*s*/,
+                          const unsigned int n_qp,
+                          Elem* const /*elem*/,
+                          const std::vector<const double*>& /*var_data*/,
+                          const std::vector<const double*>& /*grad_var_data*/,
+                          double /*time*/,
+                          void* /*ctx*/)
+{
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            double* const PP_ij = PP + (i * NDIM + j) * n_qp;
+            const double* const FF_ij = FF + (i * NDIM + j) * n_qp;
+            const bool zero_component = smooth_case && j == 1;
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
+                PP_ij[qp] = zero_component ? 0.0 : (mu / w) * FF_ij[qp];
+            }
+        }
+    }
+    return;
+} // PK1_stress_batch_function
 } // namespace ModelData
 using namespace ModelData;
 
@@ -265,7 +295,14 @@ main(int argc, char** argv)
         ib_method_ops->initializeFEEquationSystems();
         FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager();
         ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
-        ib_method_ops->registerPK1StressFunction(PK1_stress_function);
+        if (input_db->getBoolWithDefault("USE_BATCHED_STRESS_FUNCTION", false))
+        {
+            ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_stress_batch_function));
+        }
+        else
+        {
+            ib_method_ops->registerPK1StressFunction(PK1_stress_function);
+        }
         if (input_db->getBoolWithDefault("ELIMINATE_PRESSURE_JUMPS", false))
         {
             ib_method_ops->registerStressNormalizationPart();
@@ -0,0 +1,271 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// other samrai stuff
+#include <HierarchyDataOpsManager.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LibMeshSystemVectors.h>
+#include <ibtk/StableCentroidPartitioner.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the element quadrature data that FEDataManager::spread() and
+// FEDataManager::interpWeighted() share give the same interpolated velocity and
+// spread force as quadrature data that are computed anew for every operation,
+// both when the cached data are reused and after the structure moves.
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = s(0) + 0.6;
+    X(1) = s(1) + 0.5;
+#if (NDIM == 3)
+    X(2) = s(2) + 0.5;
+#endif
+    return;
+} // coordinate_mapping_function
+
+// Provides access to the structure positions.
+class TestIBFEMethod : public IBFEMethod
+{
+public:
+    using IBFEMethod::IBFEMethod;
+
+    PetscVector<double>& getCoordinatesVector(const std::string& name)
+    {
+        return d_X_vecs->get(name, 0);
+    }
+};
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // set up options for the linear solver to not depend on the parallel partitioning
+    PetscOptionsSetValue(nullptr, "-ksp_rtol", "1e-14");
+    PetscOptionsSetValue(nullptr, "-ksp_atol", "1e-12");
+    PetscOptionsSetValue(nullptr, "-ksp_type", "cg");
+    PetscOptionsSetValue(nullptr, "-pc_type", "jacobi");
+    PetscOptionsSetValue(nullptr, "-pc_jacobi_type", "diagonal");
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a simple FE mesh.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const string elem_type = input_db->getString("ELEM_TYPE");
+        const double R = 0.2;
+        const int n_refinements = int(std::log2(R / dx));
+        MeshTools::Generation::build_sphere(mesh, R, n_refinements, Utility::string_to_enum<ElemType>(elem_type), 10);
+        mesh.prepare_for_use();
+        IBTK::StableCentroidPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+            new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry, false);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+            false);
+        Pointer<TestIBFEMethod> ib_method_ops =
+            new TestIBFEMethod("IBFEMethod",
+                               app_initializer->getComponentDatabase("IBFEMethod"),
+                               &mesh,
+                               app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                               false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator,
+                                              false);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer,
+                                        false);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Set up a velocity field with ghost data and force fields.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<SAMRAI::hier::Variable<NDIM> > u_var = time_integrator->getVelocityVariable();
+        const Pointer<SAMRAI::hier::Variable<NDIM> > f_var = time_integrator->getBodyForceVariable();
+        const int n_ghosts = 3;
+        const int u_ghost_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("u_ghost"), n_ghosts);
+        const int f_ref_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("f_ref"), n_ghosts);
+        const int f_cached_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("f_cached"), n_ghosts);
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_ghost_idx);
+            level->allocatePatchData(f_ref_idx);
+            level->allocatePatchData(f_cached_idx);
+        }
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        u_init->setDataOnPatchHierarchy(u_ghost_idx, u_var, patch_hierarchy, 0.0);
+
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        std::vector<InterpolationTransactionComponent> ghost_cell_components(1);
+        ghost_cell_components[0] = InterpolationTransactionComponent(u_ghost_idx,
+                                                                     "CONSERVATIVE_LINEAR_REFINE",
+                                                                     true,
+                                                                     "CONSERVATIVE_COARSEN",
+                                                                     "LINEAR",
+                                                                     false,
+                                                                     {}, // u_bc_coefs
+                                                                     nullptr);
+        HierarchyGhostCellInterpolation ghost_fill_op;
+        ghost_fill_op.initializeOperatorState(ghost_cell_components, patch_hierarchy);
+        ghost_fill_op.fillData(/*time*/ 0.0);
+
+        // Set a nonzero Lagrangian force that is copied to the current force
+        // vector when the time step begins.
+        EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+        System& force_system = equation_systems->get_system(IBFEMethod::FORCE_SYSTEM_NAME);
+        for (dof_id_type i = force_system.solution->first_local_index(); i < force_system.solution->last_local_index();
+             ++i)
+        {
+            force_system.solution->set(i, 1.0 + 0.125 * (i % 7));
+        }
+        force_system.solution->close();
+
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->preprocessIntegrateHierarchy(
+            time_integrator->getIntegratorTime(), time_integrator->getIntegratorTime() + dt, 1);
+
+        System& velocity_system = equation_systems->get_system(IBFEMethod::VELOCITY_SYSTEM_NAME);
+        FEDataManager* const fe_data_manager = ib_method_ops->getFEDataManager();
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, patch_hierarchy, true);
+        const double current_time = time_integrator->getIntegratorTime();
+
+        // Interpolate the velocity and spread the force. The spread force is
+        // added to the Eulerian force, so the force is zeroed first.
+        auto interpolate_and_spread = [&](const int f_idx) {
+            hier_data_ops->setToScalar(f_idx, 0.0);
+            ib_method_ops->interpolateVelocity(u_ghost_idx, {}, {}, current_time);
+            ib_method_ops->spreadForce(f_idx, nullptr, {}, current_time);
+            return velocity_system.current_local_solution->clone();
+        };
+
+        // Compare the results obtained with cached quadrature data with the
+        // results obtained with quadrature data that are computed for every
+        // operation. Disabling the cache discards the cached data.
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        auto compare = [&](const std::string& label,
+                           const NumericVector<double>& U_ref,
+                           const NumericVector<double>& U_cached) {
+            double max_U_diff = 0.0;
+            for (dof_id_type i = U_ref.first_local_index(); i < U_ref.last_local_index(); ++i)
+            {
+                max_U_diff = std::max(max_U_diff, std::abs(U_cached(i) - U_ref(i)));
+            }
+            const double max_U = IBTK_MPI::maxReduction(U_ref.linfty_norm());
+            max_U_diff = IBTK_MPI::maxReduction(max_U_diff);
+            const double max_f = hier_data_ops->maxNorm(f_ref_idx);
+            hier_data_ops->subtract(f_cached_idx, f_cached_idx, f_ref_idx);
+            const double max_f_diff = hier_data_ops->maxNorm(f_cached_idx);
+
+            output << label << ":\n";
+            output << "  interpolated velocity is nonzero: " << (max_U > 0.0 ? "true" : "false") << '\n';
+            output << "  spread force is nonzero: " << (max_f > 0.0 ? "true" : "false") << '\n';
+            output << "  max relative velocity difference: " << max_U_diff / max_U << '\n';
+            output << "  max relative force difference: " << max_f_diff / max_f << '\n';
+        };
+
+        fe_data_manager->setQuadratureDataCachingEnabled(false);
+        std::unique_ptr<NumericVector<double> > U_ref = interpolate_and_spread(f_ref_idx);
+
+        // The first operations fill the cache and the next ones reuse it.
+        fe_data_manager->setQuadratureDataCachingEnabled(true);
+        std::unique_ptr<NumericVector<double> > U_cached = interpolate_and_spread(f_cached_idx);
+        compare("quadrature data computed", *U_ref, *U_cached);
+        U_cached = interpolate_and_spread(f_cached_idx);
+        compare("quadrature data reused", *U_ref, *U_cached);
+
+        // Stretch and shift the structure: the cached data must be discarded.
+        PetscVector<double>& X_vec = ib_method_ops->getCoordinatesVector("current");
+        for (dof_id_type i = X_vec.first_local_index(); i < X_vec.last_local_index(); ++i)
+        {
+            X_vec.set(i, 1.05 * X_vec(i) - 0.02);
+        }
+        X_vec.close();
+        U_cached = interpolate_and_spread(f_cached_idx);
+        fe_data_manager->setQuadratureDataCachingEnabled(false);
+        U_ref = interpolate_and_spread(f_ref_idx);
+        compare("structure moved", *U_ref, *U_cached);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
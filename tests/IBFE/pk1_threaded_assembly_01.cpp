@@ -0,0 +1,222 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LibMeshSystemVectors.h>
+#include <ibtk/StableCentroidPartitioner.h>
+#include <ibtk/libmesh_utilities.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the threaded assembly of the PK1 stress contributions to the
+// interior force density (use_threaded_force_assembly = TRUE) computes the same
+// right-hand side and force vectors as the serial assembly.
+
+// Coordinate mapping function: a sheared and stretched disk.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    X(0) = 1.2 * s(0) + 0.1 * s(1) + 0.5;
+    X(1) = 0.9 * s(1) + 0.5;
+#if (NDIM == 3)
+    X(2) = s(2) + 0.5;
+#endif
+    return;
+} // coordinate_mapping_function
+
+// Neo-Hookean type stress tensor function.
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*X*/,
+                    const libMesh::Point& /*s*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    TensorValue<double> FF_inv_trans;
+    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+    PP = FF - FF_inv_trans + std::log(FF.det()) * FF_inv_trans;
+    return;
+} // PK1_stress_function
+
+// Provides access to the force assembly setting and the force vectors.
+class TestIBFEMethod : public IBFEMethod
+{
+public:
+    using IBFEMethod::IBFEMethod;
+
+    void setThreadedForceAssembly(const bool use_threads)
+    {
+        d_use_threaded_force_assembly = use_threads;
+    }
+
+    PetscVector<double>& getForceVector(const std::string& name)
+    {
+        return d_F_vecs->get(name, 0);
+    }
+};
+
+// Return the largest difference between two vectors relative to the largest
+// entry of the first one.
+double
+relative_difference(const PetscVector<double>& a, const PetscVector<double>& b)
+{
+    double max_a = 0.0, max_diff = 0.0;
+    for (dof_id_type i = a.first_local_index(); i < a.last_local_index(); ++i)
+    {
+        max_a = std::max(max_a, std::abs(a(i)));
+        max_diff = std::max(max_diff, std::abs(a(i) - b(i)));
+    }
+    return IBTK_MPI::maxReduction(max_diff) / IBTK_MPI::maxReduction(max_a);
+} // relative_difference
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // set up options for the linear solver to not depend on the parallel partitioning
+    PetscOptionsSetValue(nullptr, "-ksp_rtol", "1e-14");
+    PetscOptionsSetValue(nullptr, "-ksp_atol", "1e-12");
+    PetscOptionsSetValue(nullptr, "-ksp_type", "cg");
+    PetscOptionsSetValue(nullptr, "-pc_type", "jacobi");
+    PetscOptionsSetValue(nullptr, "-pc_jacobi_type", "diagonal");
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+#ifdef _OPENMP
+        omp_set_num_threads(input_db->getInteger("NUM_THREADS"));
+#endif
+
+        // Create a simple FE mesh.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const string elem_type = input_db->getString("ELEM_TYPE");
+        const double R = 0.2;
+        const int n_refinements = int(std::log2(R / dx));
+        MeshTools::Generation::build_sphere(mesh, R, n_refinements, Utility::string_to_enum<ElemType>(elem_type), 10);
+        mesh.prepare_for_use();
+        IBTK::StableCentroidPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+            new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry, false);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+            false);
+        Pointer<TestIBFEMethod> ib_method_ops =
+            new TestIBFEMethod("IBFEMethod",
+                               app_initializer->getComponentDatabase("IBFEMethod"),
+                               &mesh,
+                               app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                               false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator,
+                                              false);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer,
+                                        false);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->registerPK1StressFunction(PK1_stress_function);
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        const double current_time = time_integrator->getIntegratorTime();
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->preprocessIntegrateHierarchy(current_time, current_time + dt, 1);
+
+        // Compute the force serially and with threads.
+        ib_method_ops->setThreadedForceAssembly(false);
+        ib_method_ops->computeLagrangianForce(current_time);
+        std::unique_ptr<NumericVector<double> > F_rhs_serial = ib_method_ops->getForceVector("RHS Vector").clone();
+        std::unique_ptr<NumericVector<double> > F_serial = ib_method_ops->getForceVector("current").clone();
+
+        ib_method_ops->setThreadedForceAssembly(true);
+        ib_method_ops->computeLagrangianForce(current_time);
+        const PetscVector<double>& F_rhs_threaded = ib_method_ops->getForceVector("RHS Vector");
+        const PetscVector<double>& F_threaded = ib_method_ops->getForceVector("current");
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        output << "force is nonzero: " << (IBTK_MPI::maxReduction(F_serial->linfty_norm()) > 0.0 ? "true" : "false")
+               << '\n';
+        output << "max relative difference of the right-hand side: "
+               << relative_difference(dynamic_cast<PetscVector<double>&>(*F_rhs_serial), F_rhs_threaded) << '\n';
+        output << "max relative difference of the force: "
+               << relative_difference(dynamic_cast<PetscVector<double>&>(*F_serial), F_threaded) << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
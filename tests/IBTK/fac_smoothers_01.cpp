@@ -0,0 +1,276 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that a cell-centered (data_centering = "CELL") or side-centered
+// (data_centering = "SIDE") FAC preconditioner configured with the settings in
+// precond_db converges and computes the same solution as the preconditioner
+// configured with the settings in baseline_precond_db.  The relative residuals
+// of both solutions and the relative difference between them are written to
+// the output.  The physical boundary conditions of each data depth are read
+// from the databases BcCoefs_0, BcCoefs_1, ..., if present.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fac_smoothers_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        const std::string data_centering = input_db->getStringWithDefault("data_centering", "CELL");
+        const bool use_side_centering = data_centering == "SIDE";
+        Pointer<Variable<NDIM> > u_var, v_var, f_var, r_var;
+        if (use_side_centering)
+        {
+            u_var = new SideVariable<NDIM, double>("u_sc");
+            v_var = new SideVariable<NDIM, double>("v_sc");
+            f_var = new SideVariable<NDIM, double>("f_sc");
+            r_var = new SideVariable<NDIM, double>("r_sc");
+        }
+        else
+        {
+            u_var = new CellVariable<NDIM, double>("u_cc");
+            v_var = new CellVariable<NDIM, double>("v_cc");
+            f_var = new CellVariable<NDIM, double>("f_cc");
+            r_var = new CellVariable<NDIM, double>("r_cc");
+        }
+
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int v_idx = var_db->registerVariableAndContext(v_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int r_idx = var_db->registerVariableAndContext(r_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(v_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(r_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_idx = use_side_centering ? hier_math_ops.getSideWeightPatchDescriptorIndex() :
+                                               hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_var, u_idx, h_idx);
+        v_vec.addComponent(v_var, v_idx, h_idx);
+        f_vec.addComponent(f_var, f_idx, h_idx);
+        r_vec.addComponent(r_var, r_idx, h_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_idx, f_var, patch_hierarchy, 0.0);
+
+        // Set up the physical boundary conditions.
+        const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift();
+        std::vector<std::unique_ptr<RobinBcCoefStrategy<NDIM> > > bc_coef_ptrs;
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(use_side_centering ? NDIM : 1, nullptr);
+        for (unsigned int d = 0; d < bc_coefs.size(); ++d)
+        {
+            const std::string bc_coefs_db_name = "BcCoefs_" + std::to_string(d);
+            if (!input_db->isDatabase(bc_coefs_db_name)) continue;
+            bc_coef_ptrs.emplace_back(
+                new muParserRobinBcCoefs(bc_coefs_db_name, input_db->getDatabase(bc_coefs_db_name), grid_geometry));
+            bc_coefs[d] = bc_coef_ptrs.back().get();
+        }
+
+        // Ensure that the right-hand-side vector has no components in the
+        // nullspace of the operator when the problem is singular.
+        const double C = input_db->getDoubleWithDefault("C", 0.0);
+        const bool has_nullspace = C == 0.0 && periodic_shift.min() > 0;
+        const auto remove_constant = [&](SAMRAIVectorReal<NDIM, double>& x_vec) {
+            r_vec.setToScalar(1.0);
+            x_vec.addScalar(Pointer<SAMRAIVectorReal<NDIM, double> >(&x_vec, false),
+                            -x_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)) /
+                                r_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)));
+        };
+        if (has_nullspace) remove_constant(f_vec);
+
+        // Solve (C*I - L)*u = f with both preconditioner configurations.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        if (C != 0.0)
+        {
+            poisson_spec.setCConstant(C);
+        }
+        else
+        {
+            poisson_spec.setCZero();
+        }
+        poisson_spec.setDConstant(-1.0);
+
+        const std::string solver_type = input_db->getString("solver_type");
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        const std::string precond_type = input_db->getString("precond_type");
+        const auto solve = [&](SAMRAIVectorReal<NDIM, double>& x_vec, const std::string& name) {
+            Pointer<PoissonSolver> poisson_solver;
+            if (use_side_centering)
+            {
+                poisson_solver =
+                    SCPoissonSolverManager::getManager()->allocateSolver(solver_type,
+                                                                         name + "_solver",
+                                                                         solver_db,
+                                                                         "",
+                                                                         precond_type,
+                                                                         name + "_precond",
+                                                                         input_db->getDatabase(name + "_db"),
+                                                                         "");
+            }
+            else
+            {
+                poisson_solver =
+                    CCPoissonSolverManager::getManager()->allocateSolver(solver_type,
+                                                                         name + "_solver",
+                                                                         solver_db,
+                                                                         "",
+                                                                         precond_type,
+                                                                         name + "_precond",
+                                                                         input_db->getDatabase(name + "_db"),
+                                                                         "");
+            }
+            poisson_solver->setPoissonSpecifications(poisson_spec);
+            poisson_solver->setPhysicalBcCoefs(bc_coefs);
+            poisson_solver->initializeSolverState(x_vec, f_vec);
+            x_vec.setToScalar(0.0);
+            const bool converged = poisson_solver->solveSystem(x_vec, f_vec);
+            plog << name << " iterations: " << poisson_solver->getNumIterations() << "\n";
+            return converged;
+        };
+        const bool baseline_converged = solve(u_vec, "baseline_precond");
+        const bool converged = solve(v_vec, "precond");
+
+        // Compute the relative residual of each solution with the operator
+        // that the preconditioners approximate.
+        Pointer<LaplaceOperator> laplace_op;
+        if (use_side_centering)
+        {
+            laplace_op = new SCLaplaceOperator("laplace_op");
+        }
+        else
+        {
+            laplace_op = new CCLaplaceOperator("laplace_op");
+        }
+        laplace_op->setPoissonSpecifications(poisson_spec);
+        laplace_op->setPhysicalBcCoefs(bc_coefs);
+        laplace_op->initializeOperatorState(u_vec, r_vec);
+        const double f_norm = f_vec.L2Norm();
+        const auto relative_residual = [&](SAMRAIVectorReal<NDIM, double>& x_vec) {
+            laplace_op->apply(x_vec, r_vec);
+            r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+            return r_vec.L2Norm() / f_norm;
+        };
+        const double baseline_residual = relative_residual(u_vec);
+        const double residual = relative_residual(v_vec);
+
+        // Compare the solutions, which are only determined up to a constant
+        // when the problem is singular.
+        if (has_nullspace)
+        {
+            remove_constant(u_vec);
+            remove_constant(v_vec);
+        }
+        const double u_norm = u_vec.L2Norm();
+        r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&v_vec, false));
+        const double relative_diff = r_vec.L2Norm() / u_norm;
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        output << "baseline solver converged: " << (baseline_converged ? "true" : "false") << '\n';
+        output << "solver converged: " << (converged ? "true" : "false") << '\n';
+        output << "solution is nonzero: " << (u_norm > 0.0 ? "true" : "false") << '\n';
+        output << "relative residual of the baseline solution: " << baseline_residual << '\n';
+        output << "relative residual of the solution: " << residual << '\n';
+        output << "relative difference of the solutions: " << relative_diff << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
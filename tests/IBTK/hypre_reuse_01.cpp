@@ -0,0 +1,273 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <ProcessorMapping.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonHypreLevelSolver.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/SCPoissonHypreLevelSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that a cell-centered (data_centering = "CELL") or side-centered
+// (data_centering = "SIDE") hypre level solver that reuses its hypre data
+// structures and solver setup (reuse_solver_db) computes the same solutions as
+// solvers that are set up from scratch (fresh_solver_db).  The reusing solver
+// is reinitialized after changes of the constant C in (C*I - L)*u = f, after
+// the level is replaced by one with the same patch boxes, and after the level
+// is replaced by one with different patch boxes.  The physical boundary
+// conditions of each data depth are read from the databases BcCoefs_0,
+// BcCoefs_1, ..., if present.
+
+// Split the physical domain into num_boxes slabs along the first coordinate
+// direction.
+BoxArray<NDIM>
+make_slab_boxes(const Box<NDIM>& domain_box, const int num_boxes)
+{
+    BoxArray<NDIM> boxes(num_boxes);
+    const int num_cells = domain_box.numberCells(0);
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        Box<NDIM> box = domain_box;
+        box.lower()(0) = domain_box.lower()(0) + (k * num_cells) / num_boxes;
+        box.upper()(0) = domain_box.lower()(0) + ((k + 1) * num_cells) / num_boxes - 1;
+        boxes[k] = box;
+    }
+    return boxes;
+} // make_slab_boxes
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "hypre_reuse_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        const std::string data_centering = input_db->getStringWithDefault("data_centering", "CELL");
+        const bool use_side_centering = data_centering == "SIDE";
+        Pointer<Variable<NDIM> > u_var, v_var, f_var, r_var;
+        if (use_side_centering)
+        {
+            u_var = new SideVariable<NDIM, double>("u_sc");
+            v_var = new SideVariable<NDIM, double>("v_sc");
+            f_var = new SideVariable<NDIM, double>("f_sc");
+            r_var = new SideVariable<NDIM, double>("r_sc");
+        }
+        else
+        {
+            u_var = new CellVariable<NDIM, double>("u_cc");
+            v_var = new CellVariable<NDIM, double>("v_cc");
+            f_var = new CellVariable<NDIM, double>("f_cc");
+            r_var = new CellVariable<NDIM, double>("r_cc");
+        }
+
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int v_idx = var_db->registerVariableAndContext(v_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int r_idx = var_db->registerVariableAndContext(r_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the patch hierarchy, which has only one level.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_idx = use_side_centering ? hier_math_ops.getSideWeightPatchDescriptorIndex() :
+                                               hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        // Allocate and initialize data on the level.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        const auto initialize_level_data = [&]() {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(v_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(r_idx, 0.0);
+            f_fcn.setDataOnPatchHierarchy(f_idx, f_var, patch_hierarchy, 0.0);
+        };
+        initialize_level_data();
+
+        // Replace the level by a new level with the specified patch boxes, as
+        // is done when the hierarchy is regridded.
+        const auto regrid_level = [&](const BoxArray<NDIM>& boxes, const ProcessorMapping& mapping) {
+            patch_hierarchy->makeNewPatchLevel(0, IntVector<NDIM>(1), boxes, mapping);
+            hier_math_ops.resetLevels(0, 0);
+            initialize_level_data();
+        };
+
+        // Setup vector objects.
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, 0);
+
+        u_vec.addComponent(u_var, u_idx, h_idx);
+        v_vec.addComponent(v_var, v_idx, h_idx);
+        f_vec.addComponent(f_var, f_idx, h_idx);
+        r_vec.addComponent(r_var, r_idx, h_idx);
+
+        // Set up the physical boundary conditions.
+        std::vector<std::unique_ptr<RobinBcCoefStrategy<NDIM> > > bc_coef_ptrs;
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(use_side_centering ? NDIM : 1, nullptr);
+        for (unsigned int d = 0; d < bc_coefs.size(); ++d)
+        {
+            const std::string bc_coefs_db_name = "BcCoefs_" + std::to_string(d);
+            if (!input_db->isDatabase(bc_coefs_db_name)) continue;
+            bc_coef_ptrs.emplace_back(
+                new muParserRobinBcCoefs(bc_coefs_db_name, input_db->getDatabase(bc_coefs_db_name), grid_geometry));
+            bc_coefs[d] = bc_coef_ptrs.back().get();
+        }
+
+        // The solver that reuses its hypre data is kept for all solves, and a
+        // new solver is set up from scratch for each comparison.
+        const auto allocate_solver = [&](const std::string& name) {
+            Pointer<PoissonSolver> solver;
+            if (use_side_centering)
+            {
+                solver = new SCPoissonHypreLevelSolver(name, input_db->getDatabase(name + "_db"), "");
+            }
+            else
+            {
+                solver = new CCPoissonHypreLevelSolver(name, input_db->getDatabase(name + "_db"), "");
+            }
+            solver->setPhysicalBcCoefs(bc_coefs);
+            return solver;
+        };
+        Pointer<PoissonSolver> reuse_solver = allocate_solver("reuse_solver");
+
+        // Solve (C*I - L)*u = f with both solvers and write the relative
+        // residual of the solution computed by the reusing solver and its
+        // relative difference from the solution computed by the new solver.
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        const auto compare_solvers = [&](const std::string& stage, const double C) {
+            PoissonSpecifications poisson_spec("poisson_spec");
+            poisson_spec.setCConstant(C);
+            poisson_spec.setDConstant(-1.0);
+
+            const auto solve = [&](PoissonSolver& solver, SAMRAIVectorReal<NDIM, double>& x_vec) {
+                solver.setPoissonSpecifications(poisson_spec);
+                solver.initializeSolverState(x_vec, f_vec);
+                x_vec.setToScalar(0.0);
+                const bool converged = solver.solveSystem(x_vec, f_vec);
+                plog << stage << ": " << solver.getName() << " iterations: " << solver.getNumIterations() << "\n";
+                return converged;
+            };
+            Pointer<PoissonSolver> fresh_solver = allocate_solver("fresh_solver");
+            const bool fresh_converged = solve(*fresh_solver, u_vec);
+            const bool reuse_converged = solve(*reuse_solver, v_vec);
+
+            Pointer<LaplaceOperator> laplace_op;
+            if (use_side_centering)
+            {
+                laplace_op = new SCLaplaceOperator("laplace_op");
+            }
+            else
+            {
+                laplace_op = new CCLaplaceOperator("laplace_op");
+            }
+            laplace_op->setPoissonSpecifications(poisson_spec);
+            laplace_op->setPhysicalBcCoefs(bc_coefs);
+            laplace_op->initializeOperatorState(v_vec, r_vec);
+            laplace_op->apply(v_vec, r_vec);
+            r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+            const double residual = r_vec.L2Norm() / f_vec.L2Norm();
+
+            const double u_norm = u_vec.L2Norm();
+            r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&v_vec, false));
+            const double relative_diff = r_vec.L2Norm() / u_norm;
+
+            output << stage << ":\n";
+            output << "  solvers converged: " << (fresh_converged && reuse_converged ? "true" : "false") << '\n';
+            output << "  solution is nonzero: " << (u_norm > 0.0 ? "true" : "false") << '\n';
+            output << "  relative residual of the solution: " << residual << '\n';
+            output << "  relative difference from a fresh setup: " << relative_diff << '\n';
+        };
+
+        // The hypre data are reused after the coefficients change.  The solver
+        // setup is also reused for up to solver_setup_reuse_interval
+        // reinitializations.
+        std::vector<double> C(3);
+        input_db->getDoubleArray("C", C.data(), 3);
+        compare_solvers("initial setup", C[0]);
+        compare_solvers("first coefficient change", C[1]);
+        compare_solvers("second coefficient change", C[2]);
+
+        // A regrid that does not change the patch boxes keeps the hypre grid,
+        // but a regrid that changes them requires new hypre data.
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        regrid_level(level->getBoxes(), level->getProcessorMapping());
+        compare_solvers("regrid with unchanged patch boxes", C[0]);
+
+        const int num_regrid_boxes = input_db->getInteger("NUM_REGRID_BOXES");
+        ProcessorMapping mapping(num_regrid_boxes);
+        for (int k = 0; k < num_regrid_boxes; ++k) mapping.setProcessorAssignment(k, k % IBTK_MPI::getNodes());
+        regrid_level(make_slab_boxes(grid_geometry->getPhysicalDomain()[0], num_regrid_boxes), mapping);
+        compare_solvers("regrid with new patch boxes", C[1]);
+        compare_solvers("coefficient change after the regrid", C[2]);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,156 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideIterator.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that the threaded, tile-colored spreading path of LEInteractor
+// computes the same Eulerian values, including the values spread into ghost
+// cells, as the serial spreading path.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "le_spread_threaded_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        const std::string kernel_fcn = input_db->getString("IB_DELTA_FUNCTION");
+        const int num_markers = input_db->getInteger("NUM_MARKERS_PER_PATCH");
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        const IntVector<NDIM> ghosts(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        const int f_serial_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("serial"), ghosts);
+        const int f_threaded_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("threaded"), ghosts);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(f_serial_idx, 0.0);
+        level->allocatePatchData(f_threaded_idx, 0.0);
+
+        // Spread the same randomly placed point forces with both code paths.
+        Pointer<Database> serial_db = new MemoryDatabase("serial_db");
+        serial_db->putInteger("num_spread_threads", 1);
+        Pointer<Database> threaded_db = new MemoryDatabase("threaded_db");
+        threaded_db->putInteger("num_spread_threads", input_db->getInteger("NUM_SPREAD_THREADS"));
+        threaded_db->putInteger("min_threaded_spread_size", 1);
+
+        double max_f = 0.0, max_f_diff = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const x_upper = pgeom->getXUpper();
+
+            // Seed the generator with the patch location so that the markers do
+            // not depend on the number of processes.
+            std::mt19937 generator(patch_box.lower()(0) + 1000 * patch_box.lower()(1));
+            std::uniform_real_distribution<double> unit(0.0, 1.0);
+            std::vector<double> X(NDIM * num_markers), F(NDIM * num_markers);
+            for (int k = 0; k < num_markers; ++k)
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[NDIM * k + d] = x_lower[d] + (x_upper[d] - x_lower[d]) * unit(generator);
+                    F[NDIM * k + d] = 2.0 * unit(generator) - 1.0;
+                }
+            }
+
+            Pointer<SideData<NDIM, double> > f_serial_data = patch->getPatchData(f_serial_idx);
+            Pointer<SideData<NDIM, double> > f_threaded_data = patch->getPatchData(f_threaded_idx);
+            f_serial_data->fillAll(0.0);
+            f_threaded_data->fillAll(0.0);
+            LEInteractor::setFromDatabase(serial_db);
+            LEInteractor::spread(f_serial_data, F, NDIM, X, NDIM, patch, patch_box, kernel_fcn);
+            LEInteractor::setFromDatabase(threaded_db);
+            LEInteractor::spread(f_threaded_data, F, NDIM, X, NDIM, patch, patch_box, kernel_fcn);
+
+            for (int axis = 0; axis < NDIM; ++axis)
+            {
+                for (SideIterator<NDIM> i(f_serial_data->getGhostBox(), axis); i; i++)
+                {
+                    const double f_serial = (*f_serial_data)(i());
+                    const double f_threaded = (*f_threaded_data)(i());
+                    max_f = std::max(max_f, std::abs(f_serial));
+                    max_f_diff = std::max(max_f_diff, std::abs(f_serial - f_threaded));
+                }
+            }
+        }
+        max_f = IBTK_MPI::maxReduction(max_f);
+        max_f_diff = IBTK_MPI::maxReduction(max_f_diff);
+
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        output << "spread values are nonzero: " << (max_f > 0.0 ? "true" : "false") << '\n';
+        output << "max relative difference between threaded and serial spreading: " << max_f_diff / max_f << '\n';
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
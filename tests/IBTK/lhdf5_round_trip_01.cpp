@@ -0,0 +1,190 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LHDF5DataWriter.h>
+
+#include <petscao.h>
+
+#include <boost/multi_array.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that the datasets written by LHDF5DataWriter can be read back: two
+// marker clouds, which are registered on different processes when the test is
+// run in parallel, are written into the same level datasets and every row of
+// the datasets is compared with the values that were plotted.
+
+double
+X_value(const int lag_idx, const int d, const int step)
+{
+    return std::sin(0.1 * lag_idx + d + step);
+} // X_value
+
+double
+U_value(const int lag_idx, const int step)
+{
+    return std::cos(0.3 * lag_idx - step);
+} // U_value
+
+void
+set_plot_data(LData& X_data, LData& U_data, const int first_lag_idx, const int step)
+{
+    boost::multi_array_ref<double, 2>& X = *X_data.getLocalFormVecArray();
+    boost::multi_array_ref<double, 1>& U = *U_data.getLocalFormArray();
+    for (unsigned int k = 0; k < X_data.getLocalNodeCount(); ++k)
+    {
+        for (int d = 0; d < NDIM; ++d) X[k][d] = X_value(first_lag_idx + k, d, step);
+        U[k] = U_value(first_lag_idx + k, step);
+    }
+    X_data.restoreArrays();
+    U_data.restoreArrays();
+    return;
+} // set_plot_data
+
+// Read a two-dimensional double precision dataset.
+std::vector<double>
+read_dataset(hid_t file_id, const std::string& path, hsize_t dims[2])
+{
+    const hid_t dataset_id = H5Dopen2(file_id, path.c_str(), H5P_DEFAULT);
+    const hid_t space_id = H5Dget_space(dataset_id);
+    dims[0] = dims[1] = 0;
+    H5Sget_simple_extent_dims(space_id, dims, nullptr);
+    std::vector<double> vals(dims[0] * dims[1]);
+    H5Dread(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, vals.data());
+    H5Sclose(space_id);
+    H5Dclose(dataset_id);
+    return vals;
+} // read_dataset
+
+// Read the level datasets of a dump on the root process and write their
+// dimensions and the largest differences to the plotted values.
+void
+check_dump(std::ostream& output, const std::string& dump_directory_name, const int step)
+{
+    char temp_buf[128];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", step);
+    const std::string file_name = dump_directory_name + "/lag_data.cycle_" + temp_buf + ".h5";
+    const hid_t file_id = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file_id < 0)
+    {
+        output << "dump " << step << ": could not open " << file_name << '\n';
+        return;
+    }
+    hsize_t X_dims[2], U_dims[2];
+    const std::vector<double> X = read_dataset(file_id, "/level_0/X", X_dims);
+    const std::vector<double> U = read_dataset(file_id, "/level_0/U", U_dims);
+    H5Fclose(file_id);
+
+    double max_X_diff = 0.0, max_U_diff = 0.0;
+    for (hsize_t k = 0; k < X_dims[0]; ++k)
+    {
+        for (hsize_t d = 0; d < X_dims[1]; ++d)
+        {
+            max_X_diff = std::max(max_X_diff, std::abs(X[k * X_dims[1] + d] - X_value(k, d, step)));
+        }
+    }
+    for (hsize_t k = 0; k < U_dims[0]; ++k)
+    {
+        max_U_diff = std::max(max_U_diff, std::abs(U[k] - U_value(k, step)));
+    }
+    output << "dump " << step << ": X is " << X_dims[0] << " x " << X_dims[1] << ", U is " << U_dims[0] << " x "
+           << U_dims[1] << '\n';
+    output << "dump " << step << ": max position difference: " << max_X_diff
+           << ", max variable difference: " << max_U_diff << '\n';
+
+    std::ifstream xdmf_file(dump_directory_name + "/lag_data.cycle_" + temp_buf + ".xmf");
+    std::string line;
+    int num_grids = 0;
+    while (std::getline(xdmf_file, line))
+    {
+        if (line.find("<Grid Name=\"cloud_") != std::string::npos) ++num_grids;
+    }
+    output << "dump " << step << ": cloud grids in the XDMF file: " << num_grids << '\n';
+    return;
+} // check_dump
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "lhdf5_round_trip_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_markers = input_db->getInteger("NUM_MARKERS");
+        const int num_dumps = input_db->getInteger("NUM_DUMPS");
+        const std::string dump_directory_name = input_db->getString("DUMP_DIRECTORY");
+
+        // Distribute the markers contiguously. The Lagrangian and PETSc
+        // orderings are the same.
+        const int rank = IBTK_MPI::getRank();
+        const int nodes = IBTK_MPI::getNodes();
+        const int first_lag_idx = (num_markers * rank) / nodes;
+        const int num_local_markers = (num_markers * (rank + 1)) / nodes - first_lag_idx;
+        std::vector<int> lag_idxs(num_local_markers);
+        for (int k = 0; k < num_local_markers; ++k) lag_idxs[k] = first_lag_idx + k;
+        AO ao;
+        AOCreateMapping(PETSC_COMM_WORLD, num_local_markers, lag_idxs.data(), lag_idxs.data(), &ao);
+
+        Pointer<LData> X_data = new LData("X", num_local_markers, NDIM);
+        Pointer<LData> U_data = new LData("U", num_local_markers, 1);
+
+        LHDF5DataWriter data_writer("LHDF5DataWriter", dump_directory_name, /*register_for_restart*/ false);
+        data_writer.setChunkSize(input_db->getInteger("CHUNK_SIZE"));
+        data_writer.setCompressionLevel(input_db->getInteger("COMPRESSION_LEVEL"));
+
+        // The first half of the markers is plotted by the first process and
+        // the second half by the last one, so that the rows of the datasets
+        // are in Lagrangian order.
+        const int num_first_markers = num_markers / 2;
+        if (rank == 0) data_writer.registerMarkerCloud("cloud_0", num_first_markers, 0, 0);
+        if (rank == nodes - 1)
+        {
+            data_writer.registerMarkerCloud("cloud_1", num_markers - num_first_markers, num_first_markers, 0);
+        }
+        data_writer.registerCoordsData(X_data, 0);
+        data_writer.registerVariableData("U", U_data, 0);
+        data_writer.registerLagrangianAO(ao, 0);
+
+        std::ofstream output;
+        if (rank == 0) output.open("output");
+        for (int step = 1; step <= num_dumps; ++step)
+        {
+            set_plot_data(*X_data, *U_data, first_lag_idx, step);
+            data_writer.writePlotData(step, 0.1 * step);
+            if (rank == 0) check_dump(output, dump_directory_name, step);
+            IBTK_MPI::barrier();
+        }
+        AODestroy(&ao);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,186 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LSiloDataWriter.h>
+
+#include <petscao.h>
+
+#include <boost/multi_array.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <silo.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that LSiloDataWriter writes consecutive dumps correctly when the
+// dumps are written asynchronously: every dump is read back and compared with
+// the data that were plotted, even though the plotted data are overwritten as
+// soon as writePlotData() returns.
+
+// Values of the plotted data at a given step. All values are exactly
+// representable in single precision, which Silo uses to store them.
+double
+X_value(const int lag_idx, const int d, const int step)
+{
+    return (lag_idx + 4 * step + 64 * d) / 8.0;
+} // X_value
+
+double
+U_value(const int lag_idx, const int step)
+{
+    return (lag_idx - 3 * step) / 4.0;
+} // U_value
+
+void
+set_plot_data(LData& X_data, LData& U_data, const int first_lag_idx, const int step)
+{
+    boost::multi_array_ref<double, 2>& X = *X_data.getLocalFormVecArray();
+    boost::multi_array_ref<double, 1>& U = *U_data.getLocalFormArray();
+    for (unsigned int k = 0; k < X_data.getLocalNodeCount(); ++k)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            X[k][d] = step >= 0 ? X_value(first_lag_idx + k, d, step) : -1.0;
+        }
+        U[k] = step >= 0 ? U_value(first_lag_idx + k, step) : -1.0;
+    }
+    X_data.restoreArrays();
+    U_data.restoreArrays();
+    return;
+} // set_plot_data
+
+// Read the marker cloud of a dump, which is written by the root process, and
+// write the number of markers and the largest differences to the plotted
+// values.
+void
+check_dump(std::ostream& output, const std::string& dump_directory_name, const int step)
+{
+    char temp_buf[128];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", step);
+    const std::string file_name = dump_directory_name + "/lag_data.cycle_" + temp_buf + "/lag_data.proc_0000.silo";
+    DBfile* dbfile = DBOpen(file_name.c_str(), DB_UNKNOWN, DB_READ);
+    if (!dbfile)
+    {
+        output << "dump " << step << ": could not open " << file_name << '\n';
+        return;
+    }
+    DBSetDir(dbfile, "level_0_cloud_0");
+    DBpointmesh* mesh = DBGetPointmesh(dbfile, "mesh");
+    DBmeshvar* var = DBGetPointvar(dbfile, "U");
+    double max_X_diff = 0.0, max_U_diff = 0.0;
+    for (int k = 0; k < mesh->nels; ++k)
+    {
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double X = static_cast<const float*>(mesh->coords[d])[k];
+            max_X_diff = std::max(max_X_diff, std::abs(X - X_value(k, d, step)));
+        }
+        const double U = static_cast<const float*>(var->vals[0])[k];
+        max_U_diff = std::max(max_U_diff, std::abs(U - U_value(k, step)));
+    }
+    output << "dump " << step << ": " << mesh->nels << " markers, max position difference: " << max_X_diff
+           << ", max variable difference: " << max_U_diff << '\n';
+    DBFreePointmesh(mesh);
+    DBFreeMeshvar(var);
+    DBClose(dbfile);
+    return;
+} // check_dump
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "lsilo_async_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_markers = input_db->getInteger("NUM_MARKERS");
+        const int num_dumps = input_db->getInteger("NUM_DUMPS");
+        const std::string dump_directory_name = input_db->getString("DUMP_DIRECTORY");
+
+        // Distribute the markers contiguously. The Lagrangian and PETSc
+        // orderings are the same.
+        const int rank = IBTK_MPI::getRank();
+        const int nodes = IBTK_MPI::getNodes();
+        const int first_lag_idx = (num_markers * rank) / nodes;
+        const int num_local_markers = (num_markers * (rank + 1)) / nodes - first_lag_idx;
+        std::vector<int> lag_idxs(num_local_markers);
+        for (int k = 0; k < num_local_markers; ++k) lag_idxs[k] = first_lag_idx + k;
+        AO ao;
+        AOCreateMapping(PETSC_COMM_WORLD, num_local_markers, lag_idxs.data(), lag_idxs.data(), &ao);
+
+        Pointer<LData> X_data = new LData("X", num_local_markers, NDIM);
+        Pointer<LData> U_data = new LData("U", num_local_markers, 1);
+
+        std::ofstream output;
+        if (rank == 0) output.open("output");
+        {
+            LSiloDataWriter data_writer("LSiloDataWriter",
+                                        dump_directory_name,
+                                        /*register_for_restart*/ false,
+                                        app_initializer->getComponentDatabase("LSiloDataWriter"));
+            if (rank == 0) data_writer.registerMarkerCloud("cloud", num_markers, 0, 0);
+            data_writer.registerCoordsData(X_data, 0);
+            data_writer.registerVariableData("U", U_data, 0);
+            data_writer.registerLagrangianAO(ao, 0);
+            output << "asynchronous writes: " << (data_writer.getAsynchronousWritesEnabled() ? "true" : "false")
+                   << '\n';
+
+            // Overwrite the plotted data as soon as each dump has been
+            // started.
+            for (int step = 1; step <= num_dumps; ++step)
+            {
+                set_plot_data(*X_data, *U_data, first_lag_idx, step);
+                data_writer.writePlotData(step, 0.1 * step);
+                set_plot_data(*X_data, *U_data, first_lag_idx, -1);
+
+                // Wait for the pending writes into the dump directory and read
+                // the first dump while the writer is still in use.
+                if (step == 1)
+                {
+                    LSiloDataWriter::waitForPendingWrites(dump_directory_name);
+                    IBTK_MPI::barrier();
+                    if (rank == 0) check_dump(output, dump_directory_name, step);
+                }
+            }
+        } // the destructor waits for the last dump
+        IBTK_MPI::barrier();
+
+        if (rank == 0)
+        {
+            for (int step = 1; step <= num_dumps; ++step) check_dump(output, dump_directory_name, step);
+            output << "dumps file:\n";
+            std::ifstream dumps_file(dump_directory_name + "/lag_data.visit");
+            std::string line;
+            while (std::getline(dumps_file, line)) output << line << '\n';
+        }
+        AODestroy(&ao);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,264 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/RegionOfInterestDataWriter.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hdf5.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify the contents of the regions written by RegionOfInterestDataWriter.
+// The side-centered velocity is the position of the faces, so that the
+// written velocity of every coarsened cell is its center, and the
+// cell-centered quantity is a linear function of position, which the
+// coarsening reproduces exactly. The cells read back from the file are
+// compared with the coarsened cells of each level whose centers lie in one of
+// the (overlapping) regions of interest.
+
+double
+Q_value(const double* const X)
+{
+    double Q = 1.0;
+    for (int d = 0; d < NDIM; ++d) Q += (d + 2.0) * X[d];
+    return Q;
+} // Q_value
+
+// Read a two-dimensional double precision dataset.
+std::vector<double>
+read_dataset(hid_t file_id, const std::string& path, hsize_t dims[2])
+{
+    const hid_t dataset_id = H5Dopen2(file_id, path.c_str(), H5P_DEFAULT);
+    const hid_t space_id = H5Dget_space(dataset_id);
+    dims[0] = dims[1] = 0;
+    H5Sget_simple_extent_dims(space_id, dims, nullptr);
+    std::vector<double> vals(dims[0] * dims[1]);
+    H5Dread(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, vals.data());
+    H5Sclose(space_id);
+    H5Dclose(dataset_id);
+    return vals;
+} // read_dataset
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "roi_data_writer_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const std::string dump_directory_name = input_db->getString("DUMP_DIRECTORY");
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q");
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U");
+        const int Q_idx = var_db->registerVariableAndContext(Q_var, ctx, IntVector<NDIM>(0));
+        const int U_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Set the data.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(Q_idx, 0.0);
+            level->allocatePatchData(U_idx, 0.0);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const x_lower = pgeom->getXLower();
+                const double* const dx = pgeom->getDx();
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+                Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_idx);
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+                {
+                    const CellIndex<NDIM>& i = ic();
+                    double X[NDIM];
+                    for (int d = 0; d < NDIM; ++d) X[d] = x_lower[d] + dx[d] * (i(d) - patch_box.lower(d) + 0.5);
+                    (*Q_data)(i) = Q_value(X);
+                }
+                for (int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                    {
+                        const Index<NDIM>& i = b();
+                        (*U_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower)) =
+                            x_lower[axis] + dx[axis] * (i(axis) - patch_box.lower(axis));
+                    }
+                }
+            }
+        }
+
+        // Write the regions of interest.
+        Pointer<Database> writer_db = app_initializer->getComponentDatabase("RegionOfInterestDataWriter");
+        RegionOfInterestDataWriter roi_data_writer("RegionOfInterestDataWriter", dump_directory_name, writer_db);
+        roi_data_writer.registerPlotQuantity("Q", Q_idx);
+        roi_data_writer.registerPlotQuantity("U", U_idx);
+        roi_data_writer.writePlotData(patch_hierarchy, 1, 0.0);
+
+        // Determine the coarsened cells of each level whose centers lie in a
+        // region of interest, and compare them with the cells read back on
+        // the root process.
+        const int coarsening_factor = writer_db->getInteger("coarsening_factor");
+        std::vector<std::pair<std::array<double, NDIM>, std::array<double, NDIM> > > regions;
+        const Array<std::string> keys = writer_db->getAllKeys();
+        for (int k = 0; k < keys.size(); ++k)
+        {
+            if (!writer_db->isDatabase(keys[k])) continue;
+            std::pair<std::array<double, NDIM>, std::array<double, NDIM> > region;
+            writer_db->getDatabase(keys[k])->getDoubleArray("x_lo", region.first.data(), NDIM);
+            writer_db->getDatabase(keys[k])->getDoubleArray("x_up", region.second.data(), NDIM);
+            regions.push_back(region);
+        }
+        const double* const domain_x_lower = grid_geometry->getXLower();
+        const hid_t file_id =
+            IBTK_MPI::getRank() == 0 ?
+                H5Fopen((dump_directory_name + "/roi_data.cycle_000001.h5").c_str(), H5F_ACC_RDONLY, H5P_DEFAULT) :
+                -1;
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            std::array<double, NDIM> dx;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                dx[d] = coarsening_factor * grid_geometry->getDx()[d] / level->getRatio()(d);
+            }
+
+            std::map<std::array<int, NDIM>, int> expected_cells;
+            const BoxArray<NDIM>& level_boxes = level->getBoxes();
+            for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+            {
+                const Box<NDIM> box = Box<NDIM>::coarsen(level_boxes[k], IntVector<NDIM>(coarsening_factor));
+                for (CellIterator<NDIM> ic(box); ic; ic++)
+                {
+                    std::array<int, NDIM> cell;
+                    std::array<double, NDIM> X;
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        cell[d] = ic()(d);
+                        X[d] = domain_x_lower[d] + dx[d] * (cell[d] + 0.5);
+                    }
+                    bool in_region = false;
+                    for (const auto& region : regions)
+                    {
+                        bool in_this_region = true;
+                        for (int d = 0; d < NDIM; ++d)
+                        {
+                            in_this_region = in_this_region && region.first[d] < X[d] && X[d] < region.second[d];
+                        }
+                        in_region = in_region || in_this_region;
+                    }
+                    if (in_region) expected_cells[cell] = 0;
+                }
+            }
+            if (IBTK_MPI::getRank() != 0) continue;
+
+            hsize_t Q_dims[2], U_dims[2];
+            const std::string level_path = "/level_" + std::to_string(ln);
+            const std::vector<double> Q = read_dataset(file_id, level_path + "/Q", Q_dims);
+            const std::vector<double> U = read_dataset(file_id, level_path + "/U", U_dims);
+            int num_unexpected = 0;
+            double max_Q_diff = 0.0, max_U_diff = 0.0;
+            for (hsize_t k = 0; k < U_dims[0]; ++k)
+            {
+                const double* const X = &U[k * NDIM];
+                std::array<int, NDIM> cell;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    cell[d] = static_cast<int>(std::floor((X[d] - domain_x_lower[d]) / dx[d]));
+                    max_U_diff = std::max(max_U_diff, std::abs(X[d] - (domain_x_lower[d] + dx[d] * (cell[d] + 0.5))));
+                }
+                max_Q_diff = std::max(max_Q_diff, std::abs(Q[k] - Q_value(X)));
+                auto it = expected_cells.find(cell);
+                if (it == expected_cells.end())
+                    ++num_unexpected;
+                else
+                    ++it->second;
+            }
+            int num_missing = 0, num_duplicated = 0;
+            for (const auto& cell : expected_cells)
+            {
+                if (cell.second == 0) ++num_missing;
+                if (cell.second > 1) ++num_duplicated;
+            }
+            output << "level " << ln << ": cells written: " << U_dims[0] << ", expected: " << expected_cells.size()
+                   << ", missing: " << num_missing << ", duplicated: " << num_duplicated
+                   << ", outside the regions: " << num_unexpected << '\n';
+            output << "level " << ln << ": rows of Q: " << Q_dims[0] << ", max difference of Q: " << max_Q_diff
+                   << ", max difference of U from the cell centers: " << max_U_diff << '\n';
+        }
+        if (file_id >= 0) H5Fclose(file_id);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
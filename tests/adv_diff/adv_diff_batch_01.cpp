@@ -0,0 +1,200 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that AdvDiffSemiImplicitHierarchyIntegrator computes the same
+// solution when the Helmholtz systems of quantities with identical operators
+// are solved together (batch_helmholtz_solves = TRUE) as when they are solved
+// individually.  The diffusion coefficient of one of the batched quantities is
+// temporarily changed so that the batched quantities are also advanced
+// individually for part of the simulation.  Another quantity with the same
+// operator uses a Helmholtz solver provided by the application and is
+// therefore never batched.
+
+// Run the simulation with all objects prefixed by the specified name and
+// return the final values of each transported quantity.
+std::vector<std::vector<double> >
+run_simulation(Pointer<AppInitializer> app_initializer, const std::string& prefix, const bool batch)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+    Pointer<Database> adv_diff_db = app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator");
+    adv_diff_db->putBool("batch_helmholtz_solves", batch);
+
+    Pointer<AdvDiffSemiImplicitHierarchyIntegrator> time_integrator = new AdvDiffSemiImplicitHierarchyIntegrator(
+        prefix + "::AdvDiffSemiImplicitHierarchyIntegrator", adv_diff_db, false);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        prefix + "::CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(prefix + "::PatchHierarchy", grid_geometry, false);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(prefix + "::StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>(prefix + "::LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(prefix + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Set up the transported quantities.  Q0, Q1, and Q3 have identical
+    // Helmholtz operators, and Q2 has a different diffusion coefficient.
+    Pointer<FaceVariable<NDIM, double> > u_adv_var = new FaceVariable<NDIM, double>(prefix + "::u_adv");
+    time_integrator->registerAdvectionVelocity(u_adv_var);
+    time_integrator->setAdvectionVelocityFunction(
+        u_adv_var,
+        new muParserCartGridFunction(
+            "u_fcn", app_initializer->getComponentDatabase("AdvectionVelocityFunction"), grid_geometry));
+
+    const double kappa = input_db->getDouble("KAPPA");
+    const std::vector<std::string> Q_names = { "Q0", "Q1", "Q2", "Q3" };
+    const std::vector<int> Q_depths = { 1, NDIM, 1, 1 };
+    const std::vector<double> Q_kappas = { kappa, kappa, 2.0 * kappa, kappa };
+    std::vector<Pointer<CellVariable<NDIM, double> > > Q_vars;
+    for (unsigned int k = 0; k < Q_names.size(); ++k)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var =
+            new CellVariable<NDIM, double>(prefix + "::" + Q_names[k], Q_depths[k]);
+        time_integrator->registerTransportedQuantity(Q_var);
+        time_integrator->setDiffusionCoefficient(Q_var, Q_kappas[k]);
+        time_integrator->setAdvectionVelocity(Q_var, u_adv_var);
+        time_integrator->setInitialConditions(
+            Q_var,
+            new muParserCartGridFunction(
+                Q_names[k] + "_init", app_initializer->getComponentDatabase(Q_names[k] + "Init"), grid_geometry));
+        Q_vars.push_back(Q_var);
+    }
+    time_integrator->setHelmholtzSolver(
+        Q_vars[3],
+        CCPoissonSolverManager::getManager()->allocateSolver(adv_diff_db->getString("helmholtz_solver_type"),
+                                                             prefix + "::Q3_helmholtz_solver",
+                                                             adv_diff_db->getDatabase("helmholtz_solver_db"),
+                                                             "Q3_",
+                                                             adv_diff_db->getString("helmholtz_precond_type"),
+                                                             prefix + "::Q3_helmholtz_precond",
+                                                             adv_diff_db->getDatabase("helmholtz_precond_db"),
+                                                             "Q3_pc_"));
+
+    // Initialize the patch hierarchy and advance the solution.  The diffusion
+    // coefficient of Q1 differs from that of Q0 for some of the time steps.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    const int change_step = input_db->getInteger("CHANGE_STEP");
+    const int restore_step = input_db->getInteger("RESTORE_STEP");
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const int iteration_num = time_integrator->getIntegratorStep();
+        if (iteration_num == change_step) time_integrator->setDiffusionCoefficient(Q_vars[1], 1.5 * kappa);
+        if (iteration_num == restore_step) time_integrator->setDiffusionCoefficient(Q_vars[1], kappa);
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+
+    // Collect the results.  Both simulations use the same partitioning, so the
+    // locally owned values can be compared directly.
+    std::vector<std::vector<double> > results(Q_vars.size());
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (unsigned int k = 0; k < Q_vars.size(); ++k)
+    {
+        const int Q_idx = var_db->mapVariableAndContextToIndex(Q_vars[k], time_integrator->getCurrentContext());
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+                for (int d = 0; d < Q_data->getDepth(); ++d)
+                {
+                    for (CellIterator<NDIM> ci(patch->getBox()); ci; ci++)
+                    {
+                        results[k].push_back((*Q_data)(ci(), d));
+                    }
+                }
+            }
+        }
+    }
+    return results;
+} // run_simulation
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff_batch_01.log");
+
+        const std::vector<std::vector<double> > individual = run_simulation(app_initializer, "Individual", false);
+        const std::vector<std::vector<double> > batched = run_simulation(app_initializer, "Batched", true);
+
+        // Write the largest difference of each quantity relative to its
+        // largest value.
+        std::ofstream output;
+        if (IBTK_MPI::getRank() == 0) output.open("output");
+        for (unsigned int k = 0; k < individual.size(); ++k)
+        {
+            int sizes_agree = individual[k].size() == batched[k].size();
+            double max_Q = 0.0, max_Q_diff = 0.0;
+            for (std::size_t i = 0; sizes_agree && i < individual[k].size(); ++i)
+            {
+                max_Q = std::max(max_Q, std::abs(individual[k][i]));
+                max_Q_diff = std::max(max_Q_diff, std::abs(individual[k][i] - batched[k][i]));
+            }
+            sizes_agree = IBTK_MPI::minReduction(sizes_agree);
+            max_Q = IBTK_MPI::maxReduction(max_Q);
+            max_Q_diff = IBTK_MPI::maxReduction(max_Q_diff);
+            output << "Q" << k << " is nonzero: " << (max_Q > 0.0 ? "true" : "false") << '\n';
+            output << "Q" << k << " data layouts agree: " << (sizes_agree ? "true" : "false") << '\n';
+            output << "Q" << k << " relative difference: " << (max_Q > 0.0 ? max_Q_diff / max_Q : max_Q_diff) << '\n';
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main